@@ -0,0 +1,238 @@
+#include "phase_benchmark.h"
+#include "source_generator.h"
+
+#include "lexer/char_by_char_lexer/char_by_char_lexer.h"
+#include "lexer/simd_lexer/simd_lexer.h"
+
+using namespace sigma::types;
+
+namespace {
+	struct lexer_result {
+		sigma::token_list tokens;
+		double best_time; // fastest run, in milliseconds
+	};
+
+	/**
+	 * \brief Tokenizes the given file \a iterations times using \a lexer_type.
+	 * \param path Source file to tokenize
+	 * \param iterations Number of measured runs
+	 * \return Token list of the last run and the fastest measured time, or an error.
+	 */
+	template<typename lexer_type>
+	std::expected<lexer_result, sigma::error_msg> run_lexer(
+		const sigma::filepath& path,
+		u64 iterations
+	) {
+		lexer_result result{ {}, std::numeric_limits<double>::max() };
+
+		for (u64 i = 0; i < iterations; i++) {
+			const auto lexer = std::make_shared<lexer_type>();
+			lexer->set_symbol_table(std::make_shared<sigma::symbol_table>());
+
+			if (auto set_source_error = lexer->set_source_filepath(path)) {
+				return std::unexpected(set_source_error.value()); // return on failure
+			}
+
+			const auto start = std::chrono::steady_clock::now();
+
+			if (auto tokenization_error = lexer->tokenize()) {
+				return std::unexpected(tokenization_error.value()); // return on failure
+			}
+
+			const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+			result.best_time = std::min(result.best_time, duration.count());
+			result.tokens = lexer->get_token_list();
+		}
+
+		return result;
+	}
+
+	/**
+	 * \brief Checks whether both token lists contain the same tokens, values and locations.
+	 * \return Index of the first mismatching token, or -1 if the lists are identical.
+	 */
+	i64 find_mismatch(
+		sigma::token_list left,
+		sigma::token_list right
+	) {
+		for (i64 index = 0;; index++) {
+			const sigma::token_data a = left.get_token();
+			const sigma::token_data b = right.get_token();
+			const sigma::file_position a_location = a.get_token_location();
+			const sigma::file_position b_location = b.get_token_location();
+
+			if (
+				a.get_token() != b.get_token() ||
+				a.get_value() != b.get_value() ||
+				a_location.get_line_number() != b_location.get_line_number() ||
+				a_location.get_character_number() != b_location.get_character_number()
+			) {
+				return index;
+			}
+
+			if (a.get_token() == sigma::token::end_of_file) {
+				return -1;
+			}
+		}
+	}
+
+	void print_throughput(
+		const std::string& name,
+		double time,
+		u64 byte_count
+	) {
+		const double megabytes = static_cast<double>(byte_count) / (1024.0 * 1024.0);
+
+		sigma::console::out
+			<< name
+			<< ": "
+			<< time
+			<< "ms ("
+			<< megabytes / (time / 1000.0)
+			<< " MB/s)\n";
+	}
+
+	void print_usage() {
+		sigma::console::out
+			<< sigma::color::red
+			<< "usage: benchmark <source file> [iterations] [results file] [optimization level]\n"
+			<< "       benchmark generate <output file> [functions] [expression depth] [loop length] [globals] [string length]\n"
+			<< sigma::color::white;
+	}
+
+	/**
+	 * \brief Generates a synthetic source file, the generator settings are read from the remaining arguments.
+	 */
+	i32 generate(
+		const std::vector<std::string>& arguments
+	) {
+		if (arguments.empty()) {
+			print_usage();
+			return 1;
+		}
+
+		sigma::source_generator_settings settings;
+		u64* parameters[] = {
+			&settings.function_count,
+			&settings.expression_depth,
+			&settings.loop_length,
+			&settings.global_count,
+			&settings.string_length
+		};
+
+		for (u64 i = 1; i < arguments.size() && i <= std::size(parameters); ++i) {
+			*parameters[i - 1] = std::stoull(arguments[i]);
+		}
+
+		std::ofstream file(arguments[0], std::ios::trunc);
+		if (!file.is_open()) {
+			sigma::error::emit<1000>(arguments[0])->print();
+			return 1;
+		}
+
+		file << sigma::generate_source(settings);
+		return 0;
+	}
+
+	/**
+	 * \brief Measures every compilation phase separately and writes the results into a JSON file, then
+	 * compares the available lexers.
+	 */
+	i32 benchmark(
+		const std::vector<std::string>& arguments
+	) {
+		const sigma::filepath path = arguments[0];
+		const u64 iterations = arguments.size() > 1 ? std::stoull(arguments[1]) : 10;
+		const sigma::filepath results_path = arguments.size() > 2 ? arguments[2] : "benchmark_results.json";
+		const u64 byte_count = std::filesystem::file_size(path);
+
+		sigma::compiler_settings settings;
+		if (arguments.size() > 3) {
+			settings.optimization_level = static_cast<sigma::optimization_level>(std::stoi(arguments[3]));
+		}
+
+		// run the phase benchmark first, so that its peak memory usage isn't skewed by the lexer benchmark
+		const auto phase_results = sigma::run_phase_benchmark(path, iterations, settings);
+		if (!phase_results) {
+			phase_results.error()->print();
+			return 1;
+		}
+
+		const auto char_by_char = run_lexer<sigma::char_by_char_lexer>(path, iterations);
+		if (!char_by_char) {
+			char_by_char.error()->print();
+			return 1;
+		}
+
+		const auto simd = run_lexer<sigma::simd_lexer>(path, iterations);
+		if (!simd) {
+			simd.error()->print();
+			return 1;
+		}
+
+		print_throughput("char_by_char_lexer", char_by_char->best_time, byte_count);
+		print_throughput("simd_lexer", simd->best_time, byte_count);
+
+		const i64 mismatch = find_mismatch(char_by_char->tokens, simd->tokens);
+		if (mismatch != -1) {
+			sigma::console::out
+				<< sigma::color::red
+				<< "token streams differ at token "
+				<< mismatch
+				<< '\n'
+				<< sigma::color::white;
+			return 1;
+		}
+
+		sigma::console::out << "token streams are identical\n";
+
+		for (const sigma::phase_result& result : phase_results.value()) {
+			sigma::console::out << std::format(
+				"{:<52} {:>10.3f}ms {:>14.0f} {}/s (peak memory {} MB, {} allocations)\n",
+				result.name,
+				result.best_time,
+				static_cast<double>(result.item_count) / (result.best_time / 1000.0),
+				result.unit,
+				result.peak_memory / (1024 * 1024),
+				result.allocation_count
+			);
+		}
+
+		if (auto write_error = sigma::write_phase_results(
+			results_path,
+			path,
+			iterations,
+			phase_results.value()
+		)) {
+			write_error.value()->print();
+			return 1;
+		}
+
+		return 0;
+	}
+}
+
+/**
+ * \brief Runs the benchmarks on the given file (\a argv[1]) a given number of times (\a argv[2], 10 by
+ * default): measures every compilation phase separately and writes the results into a JSON file (\a argv[3],
+ * benchmark_results.json by default), then compares the throughput of the available lexers and verifies that
+ * they produce identical token streams. Alternatively generates a synthetic source file when invoked with
+ * 'generate'.
+ * \param argc Argument count
+ * \param argv Argument values
+ * \return Status code.
+ */
+i32 main(i32 argc, char* argv[]) {
+	sigma::console::init();
+
+	if (argc < 2) {
+		print_usage();
+		return 1;
+	}
+
+	if (std::string_view(argv[1]) == "generate") {
+		return generate({ argv + 2, argv + argc });
+	}
+
+	return benchmark({ argv + 1, argv + argc });
+}
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include "phase_benchmark.h"
+
+#include "lexer/char_by_char_lexer/char_by_char_lexer.h"
+#include "parser/recursive_descent_parser/recursive_descent_parser.h"
+#include "code_generator/constant_folder/constant_folder.h"
+#include "code_generator/expression_flattener/expression_flattener.h"
+#include "code_generator/basic_code_generator/basic_code_generator.h"
+
+#ifdef __linux__
+#include <sys/resource.h>
+#else
+#include <psapi.h>
+#endif
+
+#include <atomic>
+
+namespace {
+	std::atomic<sigma::u64> allocation_counter = 0;
+}
+
+// count every heap allocation made by the benchmark, the array and nothrow forms forward to these by default
+void* operator new(std::size_t size) {
+	allocation_counter.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+		return memory;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t size) noexcept {
+	(void)size;
+	std::free(memory);
+}
+
+namespace sigma {
+	namespace {
+		/**
+		 * \brief Measures a single invocation of the given \a function, and updates the \a result.
+		 * \return Result of the invoked function.
+		 */
+		template<typename function_type>
+		auto measure(
+			phase_result& result,
+			function_type&& function
+		) {
+			const u64 allocation_count = get_allocation_count();
+			const auto start = std::chrono::steady_clock::now();
+			auto function_result = function();
+			const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+			result.allocation_count = get_allocation_count() - allocation_count;
+			result.best_time = std::min(result.best_time, duration.count());
+			result.peak_memory = std::max(result.peak_memory, get_peak_memory_usage());
+			return function_result;
+		}
+	}
+
+	std::expected<std::vector<phase_result>, error_msg> run_phase_benchmark(
+		const filepath& path,
+		u64 iterations,
+		const compiler_settings& settings
+	) {
+		phase_result lexer_result{ "char_by_char_lexer::tokenize", "tokens" };
+		phase_result parser_result{ "recursive_descent_parser::parse", "nodes" };
+		phase_result constant_folder_result{ "constant_folder::fold", "nodes" };
+		phase_result code_generator_result{ "basic_code_generator::generate", "instructions" };
+		phase_result expression_flattener_result{ "expression_flattener::flatten", "expressions" };
+		phase_result flat_code_generator_result{ "basic_code_generator::generate (flat expressions)", "instructions" };
+		phase_result compile_module_result{ "compiler::compile_module", "instructions" };
+
+		const compiler compiler(settings);
+		const compilation_context context{ path };
+		std::vector<object_buffer> objects(compiler.get_codegen_thread_count());
+
+		// every iteration runs the entire pipeline, since later phases consume the results of earlier ones
+		for (u64 i = 0; i < iterations; i++) {
+			const auto symbols = std::make_shared<symbol_table>();
+			const auto lexer = std::make_shared<char_by_char_lexer>();
+			lexer->set_symbol_table(symbols);
+
+			if (auto set_source_error = lexer->set_source_filepath(path)) {
+				return std::unexpected(set_source_error.value()); // return on failure
+			}
+
+			if (auto tokenization_error = measure(lexer_result, [&] { return lexer->tokenize(); })) {
+				return std::unexpected(tokenization_error.value()); // return on failure
+			}
+
+			lexer_result.item_count = lexer->get_token_count();
+
+			recursive_descent_parser parser;
+			parser.set_token_list(lexer->get_token_list());
+
+			if (auto parser_error = measure(parser_result, [&] { return parser.parse(); })) {
+				return std::unexpected(parser_error.value()); // return on failure
+			}
+
+			parser_result.item_count = parser.get_abstract_syntax_tree()->get_node_count();
+
+			// the code generator relies on literals converted by the folder
+			constant_folder folder(parser.get_abstract_syntax_tree());
+
+			if (auto folding_error = measure(constant_folder_result, [&] { return folder.fold(); })) {
+				return std::unexpected(folding_error.value()); // return on failure
+			}
+
+			constant_folder_result.item_count = folder.get_folded_node_count();
+
+			// the tree is generated twice, once with every expression in the tree and once with operator
+			// expressions moved into the flat expression table (compiler_settings::flatten_expressions)
+			basic_code_generator tree_code_generator;
+			tree_code_generator.set_abstract_syntax_tree(parser.get_abstract_syntax_tree());
+			tree_code_generator.set_symbol_table(symbols);
+
+			if (auto code_generator_error = measure(code_generator_result, [&] { return tree_code_generator.generate(); })) {
+				return std::unexpected(code_generator_error.value()); // return on failure
+			}
+
+			code_generator_result.item_count = tree_code_generator.get_llvm_context()->get_module()->getInstructionCount();
+
+			expression_flattener flattener(parser.get_abstract_syntax_tree());
+			expression_flattener_result.item_count = measure(expression_flattener_result, [&] {
+				flattener.flatten();
+				return flattener.get_flattened_expression_count();
+			});
+
+			basic_code_generator code_generator;
+			code_generator.set_abstract_syntax_tree(parser.get_abstract_syntax_tree());
+			code_generator.set_symbol_table(symbols);
+
+			if (auto code_generator_error = measure(flat_code_generator_result, [&] { return code_generator.generate(); })) {
+				return std::unexpected(code_generator_error.value()); // return on failure
+			}
+
+			const std::shared_ptr<llvm_context> llvm_context = code_generator.get_llvm_context();
+			flat_code_generator_result.item_count = llvm_context->get_module()->getInstructionCount();
+			compile_module_result.item_count = flat_code_generator_result.item_count;
+
+			if (auto compilation_error = measure(compile_module_result, [&] {
+				return compiler.compile_module(context, llvm_context, objects);
+			})) {
+				return std::unexpected(compilation_error.value()); // return on failure
+			}
+		}
+
+		return std::vector{
+			lexer_result,
+			parser_result,
+			constant_folder_result,
+			code_generator_result,
+			expression_flattener_result,
+			flat_code_generator_result,
+			compile_module_result
+		};
+	}
+
+	error_result write_phase_results(
+		const filepath& results_path,
+		const filepath& source_path,
+		u64 iterations,
+		const std::vector<phase_result>& results
+	) {
+		std::ofstream file(results_path, std::ios::trunc);
+		if (!file.is_open()) {
+			return error::emit<1000>(results_path);
+		}
+
+		// paths may contain backslashes, which have to be escaped
+		std::string source;
+		for (const char c : source_path.string()) {
+			if (c == '\\' || c == '"') {
+				source.push_back('\\');
+			}
+
+			source.push_back(c);
+		}
+
+		file << std::format(
+			"{{\n\t\"source\": \"{}\",\n\t\"bytes\": {},\n\t\"iterations\": {},\n\t\"phases\": [",
+			source,
+			std::filesystem::file_size(source_path),
+			iterations
+		);
+
+		for (u64 i = 0; i < results.size(); ++i) {
+			const phase_result& result = results[i];
+
+			file << (i == 0 ? "\n" : ",\n") << std::format(
+				"\t\t{{ \"name\": \"{}\", \"unit\": \"{}\", \"count\": {}, \"time_ms\": {:.3f}, \"per_second\": {:.1f}, \"peak_memory_bytes\": {}, \"allocations\": {} }}",
+				result.name,
+				result.unit,
+				result.item_count,
+				result.best_time,
+				static_cast<double>(result.item_count) / (result.best_time / 1000.0),
+				result.peak_memory,
+				result.allocation_count
+			);
+		}
+
+		file << "\n\t]\n}\n";
+
+		if (!file.good()) {
+			return error::emit<1000>(results_path);
+		}
+
+		return {};
+	}
+
+	u64 get_peak_memory_usage() {
+#ifdef __linux__
+		rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		return static_cast<u64>(usage.ru_maxrss) * 1024; // kilobytes
+#else
+		PROCESS_MEMORY_COUNTERS counters;
+		GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+		return counters.PeakWorkingSetSize;
+#endif
+	}
+
+	u64 get_allocation_count() {
+		return allocation_counter.load(std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
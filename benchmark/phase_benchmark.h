@@ -0,0 +1,64 @@
+#pragma once
+#include "compiler/compiler.h"
+
+namespace sigma {
+	/**
+	 * \brief Measurements of a single compilation phase.
+	 */
+	struct phase_result {
+		std::string name;
+		// name of the items processed by the phase (ie. tokens)
+		std::string unit;
+		// fastest measured run, in milliseconds
+		double best_time = std::numeric_limits<double>::max();
+		// number of items processed in a single run
+		u64 item_count = 0;
+		// peak memory usage of the process after the phase, in bytes
+		u64 peak_memory = 0;
+		// number of heap allocations performed by a single run
+		u64 allocation_count = 0;
+	};
+
+	/**
+	 * \brief Runs every compilation phase on the given file \a iterations times and measures each of them
+	 * separately: tokenization, parsing, constant folding, code generation of the tree, expression flattening, code
+	 * generation of the flattened tree and compile_module (optimization and emission).
+	 * \param path Source file to compile
+	 * \param iterations Number of measured runs
+	 * \param settings Compiler settings used by compile_module
+	 * \return Results of all phases, in order, or an error.
+	 */
+	std::expected<std::vector<phase_result>, error_msg> run_phase_benchmark(
+		const filepath& path,
+		u64 iterations,
+		const compiler_settings& settings
+	);
+
+	/**
+	 * \brief Writes the given benchmark \a results into a JSON file.
+	 * \param results_path Path of the JSON file
+	 * \param source_path Path of the benchmarked source file
+	 * \param iterations Number of measured runs
+	 * \param results Results to write
+	 * \return Optional error message containing information about a potential error.
+	 */
+	error_result write_phase_results(
+		const filepath& results_path,
+		const filepath& source_path,
+		u64 iterations,
+		const std::vector<phase_result>& results
+	);
+
+	/**
+	 * \brief Gets the peak memory usage (resident set size) of the current process.
+	 * \return Peak memory usage in bytes.
+	 */
+	u64 get_peak_memory_usage();
+
+	/**
+	 * \brief Gets the number of heap allocations performed by the process so far, counted by the global
+	 * operator new replacement of the benchmark.
+	 * \return Number of allocations.
+	 */
+	u64 get_allocation_count();
+}
\ No newline at end of file
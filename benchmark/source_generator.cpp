@@ -0,0 +1,114 @@
+#include "source_generator.h"
+
+#include <random>
+
+namespace sigma {
+	namespace {
+		class source_generator {
+		public:
+			source_generator(
+				const source_generator_settings& settings
+			) : m_settings(settings),
+			m_random(settings.seed) {}
+
+			std::string generate() {
+				for (u64 i = 0; i < m_settings.global_count; ++i) {
+					m_source += std::format("i32 global_{} = {};\n", i, m_random() % 1000);
+				}
+
+				for (u64 i = 0; i < m_settings.function_count; ++i) {
+					generate_function(i);
+				}
+
+				m_source += "i32 main() {\n";
+
+				if (m_settings.function_count > 0) {
+					m_source += std::format("\treturn function_{}(1, 2);\n", m_settings.function_count - 1);
+				}
+				else {
+					m_source += "\treturn 0;\n";
+				}
+
+				m_source += "}\n";
+				return std::move(m_source);
+			}
+		private:
+			void generate_function(
+				u64 index
+			) {
+				m_source += std::format("i32 function_{}(i32 a, i32 b) {{\n", index);
+				m_source += std::format("\ti32 x = {};\n", generate_expression(m_settings.expression_depth));
+
+				m_source += std::format("\tfor (i32 i = 0; i < {}; i++) {{\n", m_random() % 100 + 1);
+				for (u64 i = 0; i < m_settings.loop_length; ++i) {
+					m_source += std::format("\t\tx = {};\n", generate_expression(m_settings.expression_depth));
+				}
+
+				m_source += "\t}\n";
+
+				if (m_settings.string_length > 0) {
+					m_source += "\tchar* text = \"";
+					for (u64 i = 0; i < m_settings.string_length; ++i) {
+						m_source += static_cast<char>('a' + m_random() % 26);
+					}
+
+					m_source += "\";\n";
+				}
+
+				// functions can only call functions which have been declared before them
+				if (index > 0) {
+					m_source += std::format(
+						"\tif (x > a) {{\n\t\tx = x - function_{}(a, b);\n\t}}\n",
+						m_random() % index
+					);
+				}
+
+				m_source += "\treturn x;\n}\n";
+			}
+
+			std::string generate_expression(
+				u64 depth
+			) {
+				if (depth == 0) {
+					return generate_operand();
+				}
+
+				static constexpr const char* operators[] = { "+", "-", "*" };
+
+				// draw random numbers in a fixed order, argument evaluation order is unspecified
+				const std::string left = generate_expression(depth - 1);
+				const char* operation = operators[m_random() % std::size(operators)];
+				const std::string right = m_random() % 2 ? generate_expression(depth - 1) : generate_operand();
+
+				return std::format("({} {} {})", left, operation, right);
+			}
+
+			std::string generate_operand() {
+				switch (m_random() % 4) {
+				case 0:
+					return "a";
+				case 1:
+					return "b";
+				case 2:
+					if (m_settings.global_count > 0) {
+						return std::format("global_{}", m_random() % m_settings.global_count);
+					}
+
+					return "a";
+				default:
+					return std::to_string(m_random() % 100);
+				}
+			}
+		private:
+			const source_generator_settings& m_settings;
+			std::mt19937_64 m_random;
+			std::string m_source;
+		};
+	}
+
+	std::string generate_source(
+		const source_generator_settings& settings
+	) {
+		return source_generator(settings).generate();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+#include "utility/macros.h"
+
+namespace sigma {
+	struct source_generator_settings {
+		// number of generated functions, every function calls the previous one
+		u64 function_count = 1000;
+		// nesting depth of the generated arithmetic expressions
+		u64 expression_depth = 6;
+		// number of statements inside the loop body of every function
+		u64 loop_length = 16;
+		// number of generated global variables
+		u64 global_count = 100;
+		// length of the string literal declared in every function
+		u64 string_length = 64;
+		// seed used for choosing operators and operands
+		u64 seed = 0;
+	};
+
+	/**
+	 * \brief Generates a synthetic, valid sigma program whose size and shape is controlled by the given
+	 * \a settings. The same settings always produce the same program.
+	 * \param settings Generator settings
+	 * \return Source code of the generated program.
+	 */
+	std::string generate_source(
+		const source_generator_settings& settings
+	);
+}
\ No newline at end of file
@@ -1,10 +1,14 @@
 
 #include "source/compiler/compiler.h"
+#include "source/compiler/compile_server/compile_server.h"
 
 using namespace sigma::types;
 
 /**
- * \brief Runs the compiler. Generates an exe from the given file (\a argv[1]) at the given location (\a argv[2])
+ * \brief Runs the compiler. Generates an exe from the given file at the given location, or runs the given file
+ * in-process using the JIT when the first argument is "run". "serve" and "stop" start and stop a compile server,
+ * which compilations are forwarded to using --server=<socket>. Options (--tiered, --server=<socket>,
+ * --profile-generate=<file>, --profile-use=<file>, --flatten-expressions) may appear anywhere
  * \param argc Argument count
  * \param argv Argument values
  * \return Status code.
@@ -30,10 +34,89 @@ i32 main(i32 argc, char* argv[]) {
 	settings.size_optimization_level = sigma::size_optimization_level::high;
 	settings.vectorize = true;
 
+	// sigma run [--tiered] <file>
+	// sigma serve <socket>
+	// sigma stop <socket>
+	// sigma [--server=<socket>] [--profile-generate=<file>] [--profile-use=<file>] [--flatten-expressions]
+	//       [<file> <executable directory>]
+	std::vector<std::string_view> arguments;
+	filepath server_socket_path;
+
+	for(i32 i = 1; i < argc; ++i) {
+		const std::string_view argument = argv[i];
+
+		if(argument == "--tiered") {
+			settings.tiered_jit = true;
+		}
+		else if(argument.starts_with("--profile-generate=")) {
+			settings.profile_generate = argument.substr(argument.find('=') + 1);
+		}
+		else if(argument.starts_with("--profile-use=")) {
+			settings.profile_use = argument.substr(argument.find('=') + 1);
+		}
+		else if(argument == "--flatten-expressions") {
+			settings.flatten_expressions = true;
+		}
+		else if(argument.starts_with("--server=")) {
+			server_socket_path = argument.substr(argument.find('=') + 1);
+		}
+		else {
+			arguments.push_back(argument);
+		}
+	}
+
+	if(arguments.size() == 2 && arguments[0] == "serve") {
+		if(const auto serve_result = sigma::compile_server::serve(arguments[1])) {
+			serve_result.value()->print();
+			return 1;
+		}
+
+		return 0;
+	}
+
+	if(arguments.size() == 2 && arguments[0] == "stop") {
+		if(const auto stop_result = sigma::compile_server::stop(arguments[1])) {
+			stop_result.value()->print();
+			return 1;
+		}
+
+		return 0;
+	}
+
+	const bool run = arguments.size() == 2 && arguments[0] == "run";
 	sigma::compiler compiler(settings);
 
+	if(run) {
+		const auto run_result = compiler.run(arguments[1]);
+		if(!run_result) {
+			run_result.error()->print();
+			return 1;
+		}
+
+		return run_result.value();
+	}
+
 	// check for compilation errors
-	if(const auto compilation_result = compiler.compile(".\\test\\main.ch", ".\\test\\")) {
+	const filepath source_path = arguments.size() == 2 ? arguments[0] : ".\\test\\main.ch";
+	const filepath executable_directory = arguments.size() == 2 ? arguments[1] : ".\\test\\";
+
+	// forward the compilation to a running compile server
+	if(!server_socket_path.empty()) {
+		const auto send_result = sigma::compile_server::send(
+			server_socket_path,
+			{ source_path, executable_directory, settings }
+		);
+
+		if(!send_result) {
+			send_result.error()->print();
+			return 1;
+		}
+
+		send_result.value().print();
+		return send_result.value().status;
+	}
+
+	if(const auto compilation_result = compiler.compile(source_path, executable_directory)) {
 		compilation_result.value()->print();
 		return 1;
 	}
@@ -13,6 +13,18 @@ namespace sigma {
 		}
 	}
 
+	u64 abstract_syntax_tree::get_node_count() const {
+		return m_node_count;
+	}
+
+	expression_table& abstract_syntax_tree::get_expression_table() {
+		return m_expression_table;
+	}
+
+	const expression_table& abstract_syntax_tree::get_expression_table() const {
+		return m_expression_table;
+	}
+
 	std::vector<node*>::iterator abstract_syntax_tree::begin() {
 		return m_nodes.begin();
 	}
@@ -1,20 +1,66 @@
 #pragma once
-#include "code_generator/abstract_syntax_tree/node.h"
+#include "code_generator/abstract_syntax_tree/expressions/expression_table.h"
+#include "utility/containers/memory_arena.h"
 
 namespace sigma {
+	/**
+	 * \brief Abstract syntax tree, owns all of its nodes. Nodes are allocated from a single memory arena and are
+	 * all released at once when the tree is destroyed. Expressions which have been flattened are stored in the
+	 * expression table of the tree (see expression_flattener).
+	 */
 	class abstract_syntax_tree {
 	public:
 		abstract_syntax_tree() = default;
 
+		abstract_syntax_tree(const abstract_syntax_tree&) = delete;
+		abstract_syntax_tree& operator=(const abstract_syntax_tree&) = delete;
+
+		/**
+		 * \brief Constructs a new node of type \a node_type inside the node arena of this tree.
+		 * \tparam node_type Type of the node to construct
+		 * \param args Node constructor arguments
+		 * \return Pointer to the constructed node, valid for the lifetime of the tree.
+		 */
+		template <typename node_type, typename... Args>
+		node_type* make(
+			Args&&... args
+		);
+
 		void add_node(
 			node* node
 		);
 
 		void print_nodes() const;
 
+		/**
+		 * \brief Gets the number of nodes which have been constructed by this tree.
+		 * \return Node count.
+		 */
+		u64 get_node_count() const;
+
+		/**
+		 * \brief Gets the table which holds the flattened expressions of the tree.
+		 * \return Expression table.
+		 */
+		expression_table& get_expression_table();
+		const expression_table& get_expression_table() const;
+
 		std::vector<node*>::iterator begin();
 		std::vector<node*>::iterator end();
 	private:
+		memory_arena m_node_arena;
 		std::vector<node*> m_nodes;
+		expression_table m_expression_table;
+		u64 m_node_count = 0;
 	};
+
+	template<typename node_type, typename... Args>
+	node_type* abstract_syntax_tree::make(
+		Args&&... args
+	) {
+		m_node_count++;
+		return m_node_arena.emplace<node_type>(
+			std::forward<Args>(args)...
+		);
+	}
 }
@@ -0,0 +1,121 @@
+#include "expression_table.h"
+
+namespace sigma {
+	expression_index expression_table::add_binary_operation(
+		node_kind kind,
+		const file_position& location,
+		expression_index left_operand,
+		expression_index right_operand
+	) {
+		m_binary_operations.push_back({ left_operand, right_operand });
+		return add_expression(kind, location, m_binary_operations.size() - 1);
+	}
+
+	expression_index expression_table::add_unary_operation(
+		node_kind kind,
+		const file_position& location,
+		expression_index operand
+	) {
+		m_unary_operations.push_back(operand);
+		return add_expression(kind, location, m_unary_operations.size() - 1);
+	}
+
+	expression_index expression_table::add_constant(
+		const file_position& location,
+		const constant& value,
+		const std::vector<implicit_cast>& implicit_casts
+	) {
+		m_constants.push_back(value);
+		m_constant_implicit_casts.emplace_back(
+			static_cast<u32>(m_implicit_casts.size()),
+			static_cast<u32>(implicit_casts.size())
+		);
+
+		m_implicit_casts.insert(m_implicit_casts.end(), implicit_casts.begin(), implicit_casts.end());
+		return add_expression(node_kind::constant, location, m_constants.size() - 1);
+	}
+
+	expression_index expression_table::add_variable_access(
+		const file_position& location,
+		symbol variable_identifier
+	) {
+		m_variable_accesses.push_back(variable_identifier);
+		return add_expression(node_kind::variable_access, location, m_variable_accesses.size() - 1);
+	}
+
+	expression_index expression_table::add_node(
+		node* target
+	) {
+		m_nodes.push_back(target);
+		return add_expression(target->get_kind(), target->get_declared_location(), m_nodes.size() - 1);
+	}
+
+	expression_table::expression expression_table::get_expression(
+		expression_index index
+	) const {
+		return m_expressions[index];
+	}
+
+	const file_position& expression_table::get_location(
+		expression_index index
+	) const {
+		return m_locations[index];
+	}
+
+	const expression_table::binary_operation& expression_table::get_binary_operation(
+		u32 data_index
+	) const {
+		return m_binary_operations[data_index];
+	}
+
+	expression_index expression_table::get_unary_operand(
+		u32 data_index
+	) const {
+		return m_unary_operations[data_index];
+	}
+
+	const constant& expression_table::get_constant(
+		u32 data_index
+	) const {
+		return m_constants[data_index];
+	}
+
+	std::span<const implicit_cast> expression_table::get_implicit_casts(
+		u32 data_index
+	) const {
+		const auto [first_cast, cast_count] = m_constant_implicit_casts[data_index];
+		return { m_implicit_casts.data() + first_cast, cast_count };
+	}
+
+	symbol expression_table::get_variable_identifier(
+		u32 data_index
+	) const {
+		return m_variable_accesses[data_index];
+	}
+
+	node* expression_table::get_node(
+		u32 data_index
+	) const {
+		return m_nodes[data_index];
+	}
+
+	expression_index expression_table::get_expression_count() const {
+		return static_cast<expression_index>(m_expressions.size());
+	}
+
+	expression_index expression_table::add_expression(
+		node_kind kind,
+		const file_position& location,
+		u64 data_index
+	) {
+		// operands are referenced by 32-bit indices
+		ASSERT(
+			m_expressions.size() < std::numeric_limits<expression_index>::max(),
+			"expression table is full"
+		);
+
+		m_expressions.push_back({ kind, static_cast<u32>(data_index) });
+		m_locations.push_back(location);
+		return static_cast<expression_index>(m_expressions.size() - 1);
+	}
+}
\ No newline at end of file
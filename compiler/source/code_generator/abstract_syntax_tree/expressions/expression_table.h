@@ -0,0 +1,136 @@
+#pragma once
+#include "code_generator/abstract_syntax_tree/keywords/types/constant_node.h"
+
+#include <span>
+
+namespace sigma {
+	/**
+	 * \brief Index of an expression inside of an expression table.
+	 */
+	using expression_index = u32;
+
+	/**
+	 * \brief Flat storage of expressions. Every expression consists of a kind tag and an index into the array of
+	 * its kind, operands are referenced by their 32-bit expression indices. Expressions are stored in post-order,
+	 * operands therefore always precede the operator which uses them, and a single expression tree occupies a
+	 * contiguous range of indices. Locations are kept in a separate array, since they are only read by diagnostics.
+	 */
+	class expression_table {
+	public:
+		/**
+		 * \brief Kind tag of an expression. Operands which can't be flattened (ie. function calls) keep the kind of
+		 * their node, and are stored in the node array.
+		 */
+		struct expression {
+			node_kind kind;
+			// index into the array of the kind of the expression
+			u32 data_index;
+		};
+
+		struct binary_operation {
+			expression_index left_operand;
+			expression_index right_operand;
+		};
+
+		expression_table() = default;
+
+		expression_table(const expression_table&) = delete;
+		expression_table& operator=(const expression_table&) = delete;
+
+		expression_index add_binary_operation(
+			node_kind kind,
+			const file_position& location,
+			expression_index left_operand,
+			expression_index right_operand
+		);
+
+		expression_index add_unary_operation(
+			node_kind kind,
+			const file_position& location,
+			expression_index operand
+		);
+
+		expression_index add_constant(
+			const file_position& location,
+			const constant& value,
+			const std::vector<implicit_cast>& implicit_casts = {}
+		);
+
+		expression_index add_variable_access(
+			const file_position& location,
+			symbol variable_identifier
+		);
+
+		/**
+		 * \brief Adds an operand which stays in the abstract syntax tree.
+		 * \param target Node of the operand
+		 * \return Index of the added expression.
+		 */
+		expression_index add_node(
+			node* target
+		);
+
+		expression get_expression(
+			expression_index index
+		) const;
+
+		const file_position& get_location(
+			expression_index index
+		) const;
+
+		const binary_operation& get_binary_operation(
+			u32 data_index
+		) const;
+
+		expression_index get_unary_operand(
+			u32 data_index
+		) const;
+
+		const constant& get_constant(
+			u32 data_index
+		) const;
+
+		/**
+		 * \brief Gets the implicit casts of the operands which have been folded into the given constant.
+		 * \param data_index Index of the constant
+		 * \return Implicit casts, in generation order.
+		 */
+		std::span<const implicit_cast> get_implicit_casts(
+			u32 data_index
+		) const;
+
+		symbol get_variable_identifier(
+			u32 data_index
+		) const;
+
+		node* get_node(
+			u32 data_index
+		) const;
+
+		/**
+		 * \brief Gets the number of expressions which have been added to the table, which is also the index of the
+		 * next added expression.
+		 * \return Expression count.
+		 */
+		expression_index get_expression_count() const;
+	private:
+		expression_index add_expression(
+			node_kind kind,
+			const file_position& location,
+			u64 data_index
+		);
+	private:
+		std::vector<expression> m_expressions;
+		std::vector<file_position> m_locations;
+
+		// expression data, one array per kind
+		std::vector<binary_operation> m_binary_operations;
+		std::vector<expression_index> m_unary_operations;
+		std::vector<constant> m_constants;
+		// range of the implicit casts of every constant (first cast, cast count)
+		std::vector<std::pair<u32, u32>> m_constant_implicit_casts;
+		std::vector<implicit_cast> m_implicit_casts;
+		std::vector<symbol> m_variable_accesses;
+		std::vector<node*> m_nodes;
+	};
+}
\ No newline at end of file
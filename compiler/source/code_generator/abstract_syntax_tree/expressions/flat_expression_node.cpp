@@ -0,0 +1,162 @@
+#include "flat_expression_node.h"
+
+namespace sigma {
+	namespace {
+		const char* get_operator_symbol(
+			node_kind kind
+		) {
+			switch (kind) {
+			// unary
+			case node_kind::operator_bitwise_not:
+				return "~";
+			case node_kind::operator_not:
+				return "!";
+			// binary
+			case node_kind::operator_addition:
+				return "+";
+			case node_kind::operator_subtraction:
+				return "-";
+			case node_kind::operator_multiplication:
+				return "*";
+			case node_kind::operator_division:
+				return "/";
+			case node_kind::operator_modulo:
+				return "%";
+			case node_kind::operator_bitwise_and:
+				return "&";
+			case node_kind::operator_bitwise_or:
+				return "|";
+			case node_kind::operator_bitwise_left_shift:
+				return "<<";
+			case node_kind::operator_bitwise_right_shift:
+				return ">>";
+			case node_kind::operator_bitwise_xor:
+				return "^";
+			case node_kind::operator_conjunction:
+				return "&&";
+			case node_kind::operator_disjunction:
+				return "||";
+			case node_kind::operator_greater_than:
+				return ">";
+			case node_kind::operator_greater_than_equal_to:
+				return ">=";
+			case node_kind::operator_less_than:
+				return "<";
+			case node_kind::operator_less_than_equal_to:
+				return "<=";
+			case node_kind::operator_equals:
+				return "==";
+			case node_kind::operator_not_equals:
+				return "!=";
+			default:
+				return "";
+			}
+		}
+	}
+
+	flat_expression_node::flat_expression_node(
+		const file_position& location,
+		const expression_table& table,
+		expression_index first_expression,
+		expression_index root_expression
+	) : node(node_kind::flat_expression, location),
+	m_expression_table(table),
+	m_first_expression(first_expression),
+	m_root_expression(root_expression) {}
+
+	void flat_expression_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
+		// the node itself is transparent, the expression is printed in place of it
+		print_expression(m_root_expression, depth, prefix, is_last);
+	}
+
+	const expression_table& flat_expression_node::get_expression_table() const {
+		return m_expression_table;
+	}
+
+	expression_index flat_expression_node::get_first_expression() const {
+		return m_first_expression;
+	}
+
+	expression_index flat_expression_node::get_root_expression() const {
+		return m_root_expression;
+	}
+
+	void flat_expression_node::print_expression(
+		expression_index index,
+		u64 depth,
+		const std::wstring& prefix,
+		bool is_last
+	) const {
+		const expression_table::expression expression = m_expression_table.get_expression(index);
+		const std::wstring new_prefix = get_new_prefix(depth, prefix, is_last);
+
+		switch (expression.kind) {
+		case node_kind::constant:
+			print_node_name(depth, prefix, "constant", is_last);
+			constant_node::print_value(m_expression_table.get_constant(expression.data_index));
+			return;
+		case node_kind::variable_access:
+			print_node_name(depth, prefix, "variable access", is_last);
+			console::out
+				<< "'"
+				<< AST_NODE_VARIABLE_COLOR
+				<< m_expression_table.get_variable_identifier(expression.data_index).get_name()
+				<< color::white
+				<< "'\n";
+			return;
+		case node_kind::operator_bitwise_not:
+		case node_kind::operator_not:
+			print_node_name(depth, prefix, "unary operator", is_last);
+			console::out
+				<< '\''
+				<< AST_NODE_OPERATOR_COLOR
+				<< "prefix"
+				<< color::white
+				<< "' '"
+				<< AST_NODE_OPERATOR_COLOR
+				<< get_operator_symbol(expression.kind)
+				<< color::white
+				<< "'\n";
+
+			print_expression(m_expression_table.get_unary_operand(expression.data_index), depth + 1, new_prefix, true);
+			return;
+		case node_kind::operator_addition:
+		case node_kind::operator_subtraction:
+		case node_kind::operator_multiplication:
+		case node_kind::operator_division:
+		case node_kind::operator_modulo:
+		case node_kind::operator_bitwise_and:
+		case node_kind::operator_bitwise_or:
+		case node_kind::operator_bitwise_left_shift:
+		case node_kind::operator_bitwise_right_shift:
+		case node_kind::operator_bitwise_xor:
+		case node_kind::operator_conjunction:
+		case node_kind::operator_disjunction:
+		case node_kind::operator_greater_than:
+		case node_kind::operator_greater_than_equal_to:
+		case node_kind::operator_less_than:
+		case node_kind::operator_less_than_equal_to:
+		case node_kind::operator_equals:
+		case node_kind::operator_not_equals: {
+			print_node_name(depth, prefix, "binary operator", is_last);
+			console::out
+				<< '\''
+				<< AST_NODE_OPERATOR_COLOR
+				<< get_operator_symbol(expression.kind)
+				<< color::white
+				<< "'\n";
+
+			const expression_table::binary_operation& operation = m_expression_table.get_binary_operation(
+				expression.data_index
+			);
+
+			print_expression(operation.left_operand, depth + 1, new_prefix, false);
+			print_expression(operation.right_operand, depth + 1, new_prefix, true);
+			return;
+		}
+		default:
+			// operands which stay in the tree
+			m_expression_table.get_node(expression.data_index)->print(depth, prefix, is_last);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+#include "code_generator/abstract_syntax_tree/expressions/expression_table.h"
+
+namespace sigma {
+	/**
+	 * \brief AST node, represents an expression which has been moved into the expression table of the tree. The
+	 * expression occupies the range [first expression, root expression] of the table, the root is the last
+	 * expression of the range.
+	 */
+	class flat_expression_node : public node {
+	public:
+		flat_expression_node(
+			const file_position& location,
+			const expression_table& table,
+			expression_index first_expression,
+			expression_index root_expression
+		);
+
+		void print(
+			u64 depth,
+			const std::wstring& prefix,
+			bool is_last
+		) override;
+
+		const expression_table& get_expression_table() const;
+		expression_index get_first_expression() const;
+		expression_index get_root_expression() const;
+	private:
+		void print_expression(
+			expression_index index,
+			u64 depth,
+			const std::wstring& prefix,
+			bool is_last
+		) const;
+	private:
+		const expression_table& m_expression_table;
+		expression_index m_first_expression;
+		expression_index m_root_expression;
+	};
+}
\ No newline at end of file
@@ -9,21 +9,17 @@ namespace sigma {
 	public:
 		function_call_node(
 			const file_position& location,
-			const std::string& function_identifier,
+			symbol function_identifier,
 			const std::vector<node_ptr>& function_arguments
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(u64 depth, const std::wstring& prefix, bool is_last) override;
 
-		const std::string& get_function_identifier() const;
+		symbol get_function_identifier() const;
 		const std::vector<node_ptr>& get_function_arguments() const;
+		std::vector<node_ptr>& get_function_arguments();
 	private:
-		std::string m_function_name;
+		symbol m_function_name;
 		std::vector<node_ptr> m_function_arguments;
 	};
 }
@@ -5,20 +5,16 @@ namespace sigma {
 		const file_position& location,
 		const type& function_return_type,
 		bool is_var_arg,
-		const std::string& function_identifier,
-		const std::vector<std::pair<std::string, type>>& function_arguments,
+		symbol function_identifier,
+		const std::vector<std::pair<symbol, type>>& function_arguments,
 		const std::vector<node_ptr>& function_statements
-	) : node(location),
+	) : node(node_kind::function, location),
 	m_function_return_type(function_return_type),
 	m_function_identifier(function_identifier),
 	m_is_var_arg(is_var_arg),
 	m_function_arguments(function_arguments),
 	m_function_statements(function_statements) {}
 
-	expected_value function_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_function_node(*this, context);
-	}
-
 	void function_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		// print the function name and return type
 		print_node_name(
@@ -35,7 +31,7 @@ namespace sigma {
 			<< color::white
 			<< "' '"
 			<< AST_NODE_VARIABLE_COLOR
-			<< m_function_identifier
+			<< m_function_identifier.get_name()
 			<< color::white
 			<< "' (";
 
@@ -62,7 +58,7 @@ namespace sigma {
 		return m_function_return_type;
 	}
 
-	const std::string& function_node::get_function_identifier() const {
+	symbol function_node::get_function_identifier() const {
 		return m_function_identifier;
 	}
 
@@ -70,11 +66,15 @@ namespace sigma {
 		return m_is_var_arg;
 	}
 
-	const std::vector<node_ptr>& function_node::get_function_statements() const	{
+	const std::vector<node_ptr>& function_node::get_function_statements() const {
+		return m_function_statements;
+	}
+
+	std::vector<node_ptr>& function_node::get_function_statements() {
 		return m_function_statements;
 	}
 
-	const std::vector<std::pair<std::string, type>>& function_node::get_function_arguments() const {
+	const std::vector<std::pair<symbol, type>>& function_node::get_function_arguments() const {
 		return m_function_arguments;
 	}
 }
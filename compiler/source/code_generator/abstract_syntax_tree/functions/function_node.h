@@ -12,16 +12,11 @@ namespace sigma {
 			const file_position& location,
 			const type& function_return_type,
 			bool is_var_arg,
-			const std::string& function_identifier,
-			const std::vector<std::pair<std::string, type>>& function_arguments,
+			symbol function_identifier,
+			const std::vector<std::pair<symbol, type>>& function_arguments,
 			const std::vector<node_ptr>& function_statements
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(
 			u64 depth, 
 			const std::wstring& prefix,
@@ -29,15 +24,16 @@ namespace sigma {
 		) override;
 
 		const type& get_function_return_type() const;
-		const std::string& get_function_identifier() const;
+		symbol get_function_identifier() const;
 		bool is_var_arg() const;
 		const std::vector<node_ptr>& get_function_statements() const;
-		const std::vector<std::pair<std::string, type>>& get_function_arguments() const;
+		std::vector<node_ptr>& get_function_statements();
+		const std::vector<std::pair<symbol, type>>& get_function_arguments() const;
 	private:
 		type m_function_return_type;
-		std::string m_function_identifier;
+		symbol m_function_identifier;
 		bool m_is_var_arg;
-		std::vector<std::pair<std::string, type>> m_function_arguments;
+		std::vector<std::pair<symbol, type>> m_function_arguments;
 		std::vector<node_ptr> m_function_statements;
 	};
 }
\ No newline at end of file
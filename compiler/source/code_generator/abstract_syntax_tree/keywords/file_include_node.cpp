@@ -4,13 +4,9 @@ namespace sigma {
 	file_include_node::file_include_node(
 		const file_position& location,
 		const filepath& path
-	) : node(location),
+	) : node(node_kind::file_include, location),
 	m_path(path) {}
 
-	expected_value file_include_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_file_include_node(*this, context);
-	}
-
 	void file_include_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(
 			depth,
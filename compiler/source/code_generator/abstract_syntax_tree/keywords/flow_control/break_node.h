@@ -9,11 +9,6 @@ namespace sigma {
 	public:
 		break_node(const file_position& location);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(
 			u64 depth,
 			const std::wstring& prefix, 
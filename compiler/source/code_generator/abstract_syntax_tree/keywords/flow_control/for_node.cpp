@@ -7,16 +7,12 @@ namespace sigma {
 		const node_ptr& loop_condition_node,
 		const std::vector<node_ptr>& post_iteration_nodes,
 		const std::vector<node_ptr>& statement_nodes
-	) : node(location),
+	) : node(node_kind::for_loop, location),
 	m_loop_initialization_node(loop_initialization_node),
 	m_loop_condition_node(loop_condition_node),
 	m_post_iteration_nodes(post_iteration_nodes),
 	m_loop_body_nodes(statement_nodes) {}
 
-	expected_value for_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_for_node(*this, context);
-	}
-
 	void for_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "for statement", is_last);
 		console::out << "\n";
@@ -43,15 +39,31 @@ namespace sigma {
 		return m_loop_initialization_node;
 	}
 
+	node_ptr& for_node::get_loop_initialization_node() {
+		return m_loop_initialization_node;
+	}
+
 	const node_ptr& for_node::get_loop_condition_node() const {
 		return m_loop_condition_node;
 	}
 
-	const std::vector<node_ptr>& for_node::get_post_iteration_nodes() const	{
+	node_ptr& for_node::get_loop_condition_node() {
+		return m_loop_condition_node;
+	}
+
+	const std::vector<node_ptr>& for_node::get_post_iteration_nodes() const {
+		return m_post_iteration_nodes;
+	}
+
+	std::vector<node_ptr>& for_node::get_post_iteration_nodes() {
 		return m_post_iteration_nodes;
 	}
 
 	const std::vector<node_ptr>& for_node::get_loop_body_nodes() const {
 		return m_loop_body_nodes;
 	}
+
+	std::vector<node_ptr>& for_node::get_loop_body_nodes() {
+		return m_loop_body_nodes;
+	}
 }
\ No newline at end of file
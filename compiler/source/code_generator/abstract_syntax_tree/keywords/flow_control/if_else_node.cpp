@@ -5,14 +5,10 @@ namespace sigma {
 		const file_position& location,
 		const std::vector<node_ptr>& condition_nodes,
 		const std::vector<std::vector<node_ptr>>& branch_nodes
-	) : node(location),
+	) : node(node_kind::if_else, location),
 	m_condition_nodes(condition_nodes),
 	m_branch_nodes(branch_nodes) {}
 
-	expected_value if_else_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_if_else_node(*this, context);
-	}
-
 	void if_else_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "if statement", is_last);
 		console::out << "\n";
@@ -54,11 +50,19 @@ namespace sigma {
 		}
 	}
 
-	const std::vector<node_ptr>& if_else_node::get_condition_nodes() {
+	const std::vector<node_ptr>& if_else_node::get_condition_nodes() const {
+		return m_condition_nodes;
+	}
+
+	std::vector<node_ptr>& if_else_node::get_condition_nodes() {
 		return m_condition_nodes;
 	}
 
-	const std::vector<std::vector<node_ptr>>& if_else_node::get_branch_nodes()	{
+	const std::vector<std::vector<node_ptr>>& if_else_node::get_branch_nodes() const {
+		return m_branch_nodes;
+	}
+
+	std::vector<std::vector<node_ptr>>& if_else_node::get_branch_nodes() {
 		return m_branch_nodes;
 	}
 }
\ No newline at end of file
@@ -13,19 +13,16 @@ namespace sigma {
 			const std::vector<std::vector<node_ptr>>& branch_nodes
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(
 			u64 depth, 
 			const std::wstring& prefix,
 			bool is_last
 		) override;
 
-		const std::vector<node_ptr>& get_condition_nodes();
-		const std::vector<std::vector<node_ptr>>& get_branch_nodes();
+		const std::vector<node_ptr>& get_condition_nodes() const;
+		std::vector<node_ptr>& get_condition_nodes();
+		const std::vector<std::vector<node_ptr>>& get_branch_nodes() const;
+		std::vector<std::vector<node_ptr>>& get_branch_nodes();
 	private:
 		std::vector<node_ptr> m_condition_nodes;
 		std::vector<std::vector<node_ptr>> m_branch_nodes;
@@ -4,13 +4,9 @@ namespace sigma {
 	return_node::return_node(
 		const file_position& location,
 		const node_ptr& return_expression_node
-	) : node(location),
+	) : node(node_kind::return_statement, location),
 	m_return_expression_node(return_expression_node) {}
 
-	expected_value return_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_return_node(*this, context);
-	}
-
 	void return_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "return statement", is_last);
 		console::out << "\n";
@@ -26,4 +22,8 @@ namespace sigma {
 	const node_ptr& return_node::get_return_expression_node() const {
 		return m_return_expression_node;
 	}
+
+	node_ptr& return_node::get_return_expression_node() {
+		return m_return_expression_node;
+	}
 }
\ No newline at end of file
@@ -12,11 +12,6 @@ namespace sigma {
 			const node_ptr& return_expression_node
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(
 			u64 depth, 
 			const std::wstring& prefix,
@@ -24,6 +19,7 @@ namespace sigma {
 		) override;
 
 		const node_ptr& get_return_expression_node() const;
+		node_ptr& get_return_expression_node();
 	private:
 		node_ptr m_return_expression_node;
 	};
@@ -5,14 +5,10 @@ namespace sigma {
 		const file_position& location,
 		const node_ptr& loop_condition_node,
 		const std::vector<node_ptr>& statement_nodes
-	) : node(location),
+	) : node(node_kind::while_loop, location),
 	m_loop_condition_node(loop_condition_node),
 	m_loop_body_nodes(statement_nodes) {}
 
-	expected_value while_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_while_node(*this, context);
-	}
-
 	void while_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "while statement", is_last);
 		console::out << "\n";
@@ -33,7 +29,15 @@ namespace sigma {
 		return m_loop_condition_node;
 	}
 
+	node_ptr& while_node::get_loop_condition_node() {
+		return m_loop_condition_node;
+	}
+
 	const std::vector<node_ptr>& while_node::get_loop_body_nodes() const {
 		return m_loop_body_nodes;
 	}
+
+	std::vector<node_ptr>& while_node::get_loop_body_nodes() {
+		return m_loop_body_nodes;
+	}
 }
\ No newline at end of file
@@ -13,11 +13,6 @@ namespace sigma {
 			const std::vector<node_ptr>& statement_nodes
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(
 			u64 depth,
 			const std::wstring& prefix,
@@ -25,7 +20,9 @@ namespace sigma {
 		) override;
 
 		const node_ptr& get_loop_condition_node() const;
+		node_ptr& get_loop_condition_node();
 		const std::vector<node_ptr>& get_loop_body_nodes() const;
+		std::vector<node_ptr>& get_loop_body_nodes();
 	private:
 		node_ptr m_loop_condition_node;
 		std::vector<node_ptr> m_loop_body_nodes;
@@ -4,13 +4,9 @@ namespace sigma {
 	bool_node::bool_node(
 		const file_position& location, bool 
 		value
-	) : node(location),
+	) : node(node_kind::boolean_literal, location),
 	m_value(value) {}
 
-	expected_value bool_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_keyword_bool_node(*this, context);
-	}
-
 	void bool_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		const std::string value_string = m_value ? "true" : "false";
 
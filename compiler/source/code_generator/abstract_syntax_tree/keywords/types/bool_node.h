@@ -12,11 +12,6 @@ namespace sigma {
 			bool value
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(
 			u64 depth,
 			const std::wstring& prefix, 
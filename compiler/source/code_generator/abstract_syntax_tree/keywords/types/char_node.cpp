@@ -4,13 +4,9 @@ namespace sigma {
 	char_node::char_node(
 		const file_position& location,
 		char value
-	) : node(location),
+	) : node(node_kind::character_literal, location),
 	m_value(value)	{}
 
-	expected_value char_node::accept(code_generator& visitor, const code_generation_context& context)	{
-		return visitor.visit_keyword_char_node(*this, context);
-	}
-
 	void char_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(
 			depth,
@@ -0,0 +1,105 @@
+#include "constant_node.h"
+
+#include "code_generator/abstract_syntax_tree/keywords/types/bool_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/char_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/numerical_literal_node.h"
+
+namespace sigma {
+	constant_node::constant_node(
+		const file_position& location,
+		const constant& value,
+		std::vector<implicit_cast> implicit_casts
+	) : node(node_kind::constant, location),
+	m_value(value),
+	m_implicit_casts(std::move(implicit_casts)) {}
+
+	void constant_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
+		print_node_name(
+			depth,
+			prefix,
+			"constant",
+			is_last
+		);
+
+		print_value(m_value);
+	}
+
+	const constant& constant_node::get_value() const {
+		return m_value;
+	}
+
+	const std::vector<implicit_cast>& constant_node::get_implicit_casts() const {
+		return m_implicit_casts;
+	}
+
+	void constant_node::print_value(const constant& value) {
+		llvm::SmallString<32> value_string;
+		if (value.value_type.is_floating_point()) {
+			value.floating_point.toString(value_string);
+		}
+		else {
+			value.integer.toString(value_string, 10, value.value_type.is_signed());
+		}
+
+		console::out
+			<< "'"
+			<< AST_NODE_TYPE_COLOR
+			<< value.value_type.to_string()
+			<< color::white
+			<< "' '"
+			<< AST_NODE_NUMERICAL_LITERAL_COLOR
+			<< value_string.str().str()
+			<< color::white
+			<< "'\n";
+	}
+
+	std::optional<constant> get_constant_value(
+		const node& target
+	) {
+		switch (target.get_kind()) {
+		case node_kind::numerical_literal: {
+			// operands are generated without a contextual type, literals therefore use their preferred type
+			const auto& literal = static_cast<const numerical_literal_node&>(target);
+			const type literal_type = literal.get_preferred_type();
+
+			if (literal_type.get_pointer_level() > 0) {
+				return std::nullopt;
+			}
+
+			switch (literal_type.get_base()) {
+			case type::base::i8:
+			case type::base::i16:
+			case type::base::i32:
+			case type::base::i64:
+				return constant{ literal_type, llvm::APInt(literal_type.get_bit_width(), literal.get_integer_value(), true) };
+			case type::base::u8:
+			case type::base::u16:
+			case type::base::u32:
+			case type::base::u64:
+				return constant{ literal_type, llvm::APInt(literal_type.get_bit_width(), literal.get_integer_value(), false) };
+			case type::base::f32:
+				return constant{ literal_type, llvm::APInt(), llvm::APFloat(literal.get_f32_value()) };
+			case type::base::f64:
+				return constant{ literal_type, llvm::APInt(), llvm::APFloat(literal.get_f64_value()) };
+			case type::base::boolean:
+				return constant{ literal_type, llvm::APInt(1, literal.get_integer_value() != 0) };
+			case type::base::character:
+				return constant{ literal_type, llvm::APInt(8, static_cast<u8>(literal.get_integer_value())) };
+			default:
+				return std::nullopt;
+			}
+		}
+		case node_kind::boolean_literal:
+			return constant{ type(type::base::boolean, 0), llvm::APInt(1, static_cast<const bool_node&>(target).get_value()) };
+		case node_kind::character_literal:
+			return constant{
+				type(type::base::character, 0),
+				llvm::APInt(8, static_cast<u8>(static_cast<const char_node&>(target).get_value()))
+			};
+		case node_kind::constant:
+			return static_cast<const constant_node&>(target).get_value();
+		default:
+			return std::nullopt;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+#include "code_generator/abstract_syntax_tree/node.h"
+#include <llvm/ADT/APFloat.h>
+
+namespace sigma {
+	/**
+	 * \brief Compile-time value of a constant expression. Integral, character and boolean values are stored in
+	 * \a integer, floating point values in \a floating_point.
+	 */
+	struct constant {
+		type value_type;
+		llvm::APInt integer;
+		llvm::APFloat floating_point = llvm::APFloat(0.0);
+	};
+
+	/**
+	 * \brief Implicit cast of an operand which has been folded into a constant, reported as a warning once the
+	 * constant is generated.
+	 */
+	struct implicit_cast {
+		file_position location;
+		type source_type;
+		type target_type;
+	};
+
+	/**
+	 * \brief AST node, represents the value of a constant expression which has been folded before code
+	 * generation. Unlike literals, constants have a fixed type, which doesn't depend on the context they are used
+	 * in.
+	 */
+	class constant_node : public node {
+	public:
+		constant_node(
+			const file_position& location,
+			const constant& value,
+			std::vector<implicit_cast> implicit_casts = {}
+		);
+
+		void print(
+			u64 depth,
+			const std::wstring& prefix,
+			bool is_last
+		) override;
+
+		const constant& get_value() const;
+		const std::vector<implicit_cast>& get_implicit_casts() const;
+
+		/**
+		 * \brief Prints the type and the value of the given constant.
+		 * \param value Constant to print
+		 */
+		static void print_value(
+			const constant& value
+		);
+	private:
+		constant m_value;
+		std::vector<implicit_cast> m_implicit_casts; // casts of the folded operands, in generation order
+	};
+
+	/**
+	 * \brief Gets the value of the given node, if it is a literal or a constant.
+	 * \param target Node to evaluate
+	 * \return Value of the node, std::nullopt if it isn't constant.
+	 */
+	std::optional<constant> get_constant_value(
+		const node& target
+	);
+}
\ No newline at end of file
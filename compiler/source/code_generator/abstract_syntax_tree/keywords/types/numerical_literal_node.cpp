@@ -5,14 +5,10 @@ namespace sigma {
 		const file_position& location,
 		const std::string& value,
 		type preferred_type
-	) : node(location),
+	) : node(node_kind::numerical_literal, location),
 	m_value(value),
 	m_preferred_type(preferred_type) {}
 
-	expected_value numerical_literal_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_numerical_literal_node(*this, context);
-	}
-
 	void numerical_literal_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(
 			depth,
@@ -33,6 +29,16 @@ namespace sigma {
 			<< "'\n";
 	}
 
+	void numerical_literal_node::set_parsed_values(
+		u64 integer_value,
+		f32 f32_value,
+		f64 f64_value
+	) {
+		m_integer_value = integer_value;
+		m_f32_value = f32_value;
+		m_f64_value = f64_value;
+	}
+
 	const std::string& numerical_literal_node::get_value() const {
 		return m_value;
 	}
@@ -40,4 +46,16 @@ namespace sigma {
 	const type& numerical_literal_node::get_preferred_type() const {
 		return m_preferred_type;
 	}
+
+	u64 numerical_literal_node::get_integer_value() const {
+		return m_integer_value;
+	}
+
+	f32 numerical_literal_node::get_f32_value() const {
+		return m_f32_value;
+	}
+
+	f64 numerical_literal_node::get_f64_value() const {
+		return m_f64_value;
+	}
 }
\ No newline at end of file
@@ -3,7 +3,9 @@
 
 namespace sigma {
 	/**
-	 * \brief AST node, represents a numerical literal.
+	 * \brief AST node, represents a numerical literal. The type of a literal depends on the context it is used in,
+	 * the literal text is therefore converted to an integer and to both floating point representations once, by
+	 * the constant folder, and code generation picks the representation it needs.
 	 */
 	class numerical_literal_node : public node {
 	public:
@@ -13,21 +15,34 @@ namespace sigma {
 			type preferred_type
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(
 			u64 depth, 
 			const std::wstring& prefix,
 			bool is_last
 		) override;
 
+		/**
+		 * \brief Sets the values of the literal text.
+		 * \param integer_value Integral value, the fractional part of floating point literals is truncated
+		 * \param f32_value Single precision floating point value
+		 * \param f64_value Double precision floating point value
+		 */
+		void set_parsed_values(
+			u64 integer_value,
+			f32 f32_value,
+			f64 f64_value
+		);
+
 		const std::string& get_value() const;
 		const type& get_preferred_type() const;
+		u64 get_integer_value() const;
+		f32 get_f32_value() const;
+		f64 get_f64_value() const;
 	private:
 		std::string m_value;
 		type m_preferred_type;
+		u64 m_integer_value = 0;
+		f32 m_f32_value = 0.0f;
+		f64 m_f64_value = 0.0;
 	};
 }
\ No newline at end of file
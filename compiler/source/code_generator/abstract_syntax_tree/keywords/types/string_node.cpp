@@ -4,13 +4,9 @@ namespace sigma {
 	string_node::string_node(
 		const file_position& location, 
 		const std::string& value
-	) : node(location),
+	) : node(node_kind::string_literal, location),
 	m_value(value) {}
 
-	expected_value string_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_keyword_string_node(*this, context);
-	}
-
 	void string_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(
 			depth, 
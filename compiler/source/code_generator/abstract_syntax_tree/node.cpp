@@ -2,8 +2,13 @@
 #include "code_generator/code_generator.h"
 
 namespace sigma {
-	node::node(const file_position& location)
-		: m_location(location) {}
+	node::node(node_kind kind, const file_position& location)
+		: m_kind(kind),
+	m_location(location) {}
+
+	node_kind node::get_kind() const {
+		return m_kind;
+	}
 
 	const file_position& node::get_declared_location() const {
 		return m_location;
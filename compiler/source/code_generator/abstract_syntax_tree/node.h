@@ -1,6 +1,7 @@
 #pragma once
 #include "llvm_wrappers/value.h"
 #include "llvm_wrappers/code_generation_context.h"
+#include "utility/containers/symbol_table.h"
 #include "compiler/diagnostics/error.h"
 #include "compiler/diagnostics/warning.h"
 
@@ -16,7 +17,86 @@ namespace sigma {
 	class node;
 
 	using node_ptr = node*;
-	using expected_value = std::expected<value_ptr, error_msg>;
+	using expected_value = std::expected<value, error_msg>;
+
+	/**
+	 * \brief Kind of a concrete AST node, code generators dispatch nodes to their visit methods by switching on
+	 * the kind (see dispatch_node).
+	 */
+	enum class node_kind : u8 {
+		// functions
+		function,
+		function_call,
+
+		// keywords
+		file_include,
+
+		// variables
+		assignment,
+		variable_access,
+		local_declaration,
+		global_declaration,
+		array_allocation,
+		array_access,
+		array_assignment,
+		variable,
+
+		// flow control
+		return_statement,
+		if_else,
+		while_loop,
+		for_loop,
+		break_statement,
+
+		// types
+		numerical_literal,
+		character_literal,
+		string_literal,
+		boolean_literal,
+		constant,
+
+		// expressions
+		flat_expression,
+
+		// operators
+		// unary
+		// arithmetic
+		operator_post_decrement,
+		operator_post_increment,
+		operator_pre_decrement,
+		operator_pre_increment,
+		// bitwise
+		operator_bitwise_not,
+		// logical
+		operator_not,
+		// binary
+		// arithmetic
+		operator_addition_assignment,
+		operator_addition,
+		operator_subtraction_assignment,
+		operator_subtraction,
+		operator_multiplication_assignment,
+		operator_multiplication,
+		operator_division_assignment,
+		operator_division,
+		operator_modulo_assignment,
+		operator_modulo,
+		// bitwise
+		operator_bitwise_and,
+		operator_bitwise_or,
+		operator_bitwise_left_shift,
+		operator_bitwise_right_shift,
+		operator_bitwise_xor,
+		// logical
+		operator_conjunction,
+		operator_disjunction,
+		operator_greater_than,
+		operator_greater_than_equal_to,
+		operator_less_than,
+		operator_less_than_equal_to,
+		operator_equals,
+		operator_not_equals
+	};
 
 	/**
 	 * \brief base AST node.
@@ -25,21 +105,17 @@ namespace sigma {
 	public:
 		/**
 		 * \brief Constructs a node with using data about the node's location.
+		 * \param kind Kind of the concrete node
 		 * \param location Token location of the node. 
 		 */
-		node(const file_position& location);
+		node(node_kind kind, const file_position& location);
 		virtual ~node() = default;
 
 		/**
-		 * \brief Accepts the node and implements the required operations for the specified node type.
-		 * \param visitor Visitor to use for implementing the needed operations
-		 * \param context Context provided by the previous accept call
-		 * \return Result of the acceptation operation, either an error or a pointer to the generated value.
+		 * \brief Gets the kind of the node, which identifies its concrete type.
+		 * \return Node kind.
 		 */
-		virtual expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) = 0;
+		node_kind get_kind() const;
 
 		/**
 		 * \brief Prints the given node as a part of a tree hierarchy.
@@ -86,6 +162,7 @@ namespace sigma {
 			bool is_last
 		);
 	private:
+		node_kind m_kind;
 		file_position m_location;
 	};
 }
@@ -0,0 +1,166 @@
+#pragma once
+#include "code_generator/abstract_syntax_tree/functions/function_call_node.h"
+#include "code_generator/abstract_syntax_tree/functions/function_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/for_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/if_else_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/return_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/while_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/operator_binary_base.h"
+#include "code_generator/abstract_syntax_tree/operators/unary/operator_unary_base.h"
+#include "code_generator/abstract_syntax_tree/variables/assignment_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_access_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_allocation_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_assignment_node.h"
+#include "code_generator/abstract_syntax_tree/variables/declaration/declaration_node.h"
+
+namespace sigma {
+	/**
+	 * \brief Invokes \a function on every child slot of the given node, children may be replaced through
+	 * the slot. Empty slots (ie. the condition of a trailing else branch) are passed as well.
+	 * \return First error returned by \a function.
+	 */
+	template<typename function_type>
+	error_result for_each_child(
+		node* target,
+		function_type&& function
+	) {
+		const auto for_each = [&](std::vector<node_ptr>& children) -> error_result {
+			for (node_ptr& child : children) {
+				if (auto child_error = function(child)) {
+					return child_error; // return on failure
+				}
+			}
+
+			return {};
+		};
+
+		switch (target->get_kind()) {
+		case node_kind::function:
+			return for_each(static_cast<function_node*>(target)->get_function_statements());
+		case node_kind::function_call:
+			return for_each(static_cast<function_call_node*>(target)->get_function_arguments());
+		case node_kind::assignment: {
+			auto* assignment = static_cast<assignment_node*>(target);
+
+			if (auto variable_error = function(assignment->get_variable_node())) {
+				return variable_error; // return on failure
+			}
+
+			return function(assignment->get_expression_node());
+		}
+		case node_kind::local_declaration:
+		case node_kind::global_declaration:
+			return function(static_cast<declaration_node*>(target)->get_expression_node());
+		case node_kind::array_allocation:
+			return function(static_cast<array_allocation_node*>(target)->get_array_element_count_node());
+		case node_kind::array_access: {
+			auto* access = static_cast<array_access_node*>(target);
+
+			if (auto base_error = function(access->get_array_base_node())) {
+				return base_error; // return on failure
+			}
+
+			return for_each(access->get_array_element_index_nodes());
+		}
+		case node_kind::array_assignment: {
+			auto* assignment = static_cast<array_assignment_node*>(target);
+
+			if (auto base_error = function(assignment->get_array_base_node())) {
+				return base_error; // return on failure
+			}
+
+			if (auto index_error = for_each(assignment->get_array_element_index_nodes())) {
+				return index_error; // return on failure
+			}
+
+			return function(assignment->get_expression_node());
+		}
+		case node_kind::return_statement:
+			return function(static_cast<return_node*>(target)->get_return_expression_node());
+		case node_kind::if_else: {
+			auto* if_else = static_cast<if_else_node*>(target);
+
+			if (auto condition_error = for_each(if_else->get_condition_nodes())) {
+				return condition_error; // return on failure
+			}
+
+			for (std::vector<node_ptr>& branch : if_else->get_branch_nodes()) {
+				if (auto branch_error = for_each(branch)) {
+					return branch_error; // return on failure
+				}
+			}
+
+			return {};
+		}
+		case node_kind::while_loop: {
+			auto* loop = static_cast<while_node*>(target);
+
+			if (auto condition_error = function(loop->get_loop_condition_node())) {
+				return condition_error; // return on failure
+			}
+
+			return for_each(loop->get_loop_body_nodes());
+		}
+		case node_kind::for_loop: {
+			auto* loop = static_cast<for_node*>(target);
+
+			if (auto initialization_error = function(loop->get_loop_initialization_node())) {
+				return initialization_error; // return on failure
+			}
+
+			if (auto condition_error = function(loop->get_loop_condition_node())) {
+				return condition_error; // return on failure
+			}
+
+			if (auto post_iteration_error = for_each(loop->get_post_iteration_nodes())) {
+				return post_iteration_error; // return on failure
+			}
+
+			return for_each(loop->get_loop_body_nodes());
+		}
+		// unary operators
+		case node_kind::operator_post_decrement:
+		case node_kind::operator_post_increment:
+		case node_kind::operator_pre_decrement:
+		case node_kind::operator_pre_increment:
+		case node_kind::operator_bitwise_not:
+		case node_kind::operator_not:
+			return function(static_cast<operator_unary_base*>(target)->get_expression_node());
+		// binary operators
+		case node_kind::operator_addition_assignment:
+		case node_kind::operator_addition:
+		case node_kind::operator_subtraction_assignment:
+		case node_kind::operator_subtraction:
+		case node_kind::operator_multiplication_assignment:
+		case node_kind::operator_multiplication:
+		case node_kind::operator_division_assignment:
+		case node_kind::operator_division:
+		case node_kind::operator_modulo_assignment:
+		case node_kind::operator_modulo:
+		case node_kind::operator_bitwise_and:
+		case node_kind::operator_bitwise_or:
+		case node_kind::operator_bitwise_left_shift:
+		case node_kind::operator_bitwise_right_shift:
+		case node_kind::operator_bitwise_xor:
+		case node_kind::operator_conjunction:
+		case node_kind::operator_disjunction:
+		case node_kind::operator_greater_than:
+		case node_kind::operator_greater_than_equal_to:
+		case node_kind::operator_less_than:
+		case node_kind::operator_less_than_equal_to:
+		case node_kind::operator_equals:
+		case node_kind::operator_not_equals: {
+			auto* operation = static_cast<operator_binary_base*>(target);
+
+			if (auto left_error = function(operation->get_left_expression_node())) {
+				return left_error; // return on failure
+			}
+
+			return function(operation->get_right_expression_node());
+		}
+		// leaves
+		default:
+			return {};
+		}
+	}
+}
\ No newline at end of file
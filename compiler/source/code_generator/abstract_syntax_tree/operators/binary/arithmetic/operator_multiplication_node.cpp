@@ -6,15 +6,12 @@ namespace sigma {
 		const node_ptr& left_expression_node,
 		const node_ptr& right_expression_node
 	) : operator_binary_base(
+		node_kind::operator_multiplication,
 		location,
 		left_expression_node,
 		right_expression_node
 	) {}
 
-	expected_value operator_multiplication_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_operator_multiplication_node(*this, context);
-	}
-
 	void operator_multiplication_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "binary operator", is_last);
 		console::out
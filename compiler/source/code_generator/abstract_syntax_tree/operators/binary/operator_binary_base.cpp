@@ -2,10 +2,11 @@
 
 namespace sigma {
 	operator_binary_base::operator_binary_base(
+		node_kind kind,
 		const file_position& location,
 		const node_ptr& left_expression_node,
 		const node_ptr& right_expression_node
-	) : node(location),
+	) : node(kind, location),
 	m_left_expression_node(left_expression_node),
 	m_right_expression_node(right_expression_node) {}
 
@@ -13,7 +14,15 @@ namespace sigma {
 		return m_left_expression_node;
 	}
 
+	node_ptr& operator_binary_base::get_left_expression_node() {
+		return m_left_expression_node;
+	}
+
 	const node_ptr& operator_binary_base::get_right_expression_node() const {
 		return m_right_expression_node;
 	}
+
+	node_ptr& operator_binary_base::get_right_expression_node() {
+		return m_right_expression_node;
+	}
 }
\ No newline at end of file
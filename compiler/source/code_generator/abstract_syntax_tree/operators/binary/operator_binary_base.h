@@ -8,13 +8,16 @@ namespace sigma {
 	class operator_binary_base : public node	{
 	public:
 		operator_binary_base(
+			node_kind kind,
 			const file_position& location,
 			const node_ptr& left_expression_node,
 			const node_ptr& right_expression_node
 		);
 
 		const node_ptr& get_left_expression_node() const;
+		node_ptr& get_left_expression_node();
 		const node_ptr& get_right_expression_node() const;
+		node_ptr& get_right_expression_node();
 	private:
 		node_ptr m_left_expression_node;
 		node_ptr m_right_expression_node;
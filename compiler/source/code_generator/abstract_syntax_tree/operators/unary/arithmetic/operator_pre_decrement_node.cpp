@@ -4,11 +4,7 @@ namespace sigma {
 	operator_pre_decrement_node::operator_pre_decrement_node(
 		const file_position& location,
 		const node_ptr& expression_node
-	) : operator_unary_base(location, expression_node) {}
-
-	expected_value operator_pre_decrement_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_operator_pre_decrement_node(*this, context);
-	}
+	) : operator_unary_base(node_kind::operator_pre_decrement, location, expression_node) {}
 
 	void operator_pre_decrement_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "unary operator", is_last);
@@ -12,11 +12,6 @@ namespace sigma {
 			const node_ptr& expression_node
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(
 			u64 depth,
 			const std::wstring& prefix,
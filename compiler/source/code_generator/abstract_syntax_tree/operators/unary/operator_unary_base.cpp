@@ -2,12 +2,17 @@
 
 namespace sigma {
 	operator_unary_base::operator_unary_base(
+		node_kind kind,
 		const file_position& location,
 		const node_ptr& expression_node
-	) : node(location),
+	) : node(kind, location),
 	m_expression_node(expression_node) {}
 
 	const node_ptr& operator_unary_base::get_expression_node() const {
 		return m_expression_node;
 	}
+
+	node_ptr& operator_unary_base::get_expression_node() {
+		return m_expression_node;
+	}
 }
\ No newline at end of file
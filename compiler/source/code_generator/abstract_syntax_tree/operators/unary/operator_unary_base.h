@@ -8,11 +8,13 @@ namespace sigma {
 	class operator_unary_base : public node {
 	public:
 		operator_unary_base(
+			node_kind kind,
 			const file_position& location,
 			const node_ptr& expression_node
 		);
 
 		const node_ptr& get_expression_node() const;
+		node_ptr& get_expression_node();
 	private:
 		node_ptr m_expression_node;
 	};
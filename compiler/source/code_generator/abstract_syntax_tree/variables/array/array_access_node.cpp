@@ -5,14 +5,10 @@ namespace sigma {
 		const file_position& location,
 		const node_ptr& array_base,
 		const std::vector<node_ptr>& array_element_index_nodes
-	) : node(location),
+	) : node(node_kind::array_access, location),
 	m_array_base(array_base),
 	m_array_element_index_nodes(array_element_index_nodes) {}
 
-	expected_value array_access_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_array_access_node(*this, context);
-	}
-
 	void array_access_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "array access", is_last);
 		console::out << "\n";
@@ -31,7 +27,15 @@ namespace sigma {
 		return m_array_base;
 	}
 
+	node_ptr& array_access_node::get_array_base_node() {
+		return m_array_base;
+	}
+
 	const std::vector<node_ptr>& array_access_node::get_array_element_index_nodes() const {
 		return m_array_element_index_nodes;
 	}
+
+	std::vector<node_ptr>& array_access_node::get_array_element_index_nodes() {
+		return m_array_element_index_nodes;
+	}
 }
\ No newline at end of file
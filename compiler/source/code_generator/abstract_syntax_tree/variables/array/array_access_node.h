@@ -13,15 +13,12 @@ namespace sigma {
 			const std::vector<node_ptr>& array_element_index_nodes
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(u64 depth, const std::wstring& prefix, bool is_last) override;
 
 		const node_ptr& get_array_base_node() const;
+		node_ptr& get_array_base_node();
 		const std::vector<node_ptr>& get_array_element_index_nodes() const;
+		std::vector<node_ptr>& get_array_element_index_nodes();
 	private:
 		node_ptr m_array_base;
 		std::vector<node_ptr> m_array_element_index_nodes;
@@ -5,14 +5,10 @@ namespace sigma {
 		const file_position& location,
 		const type& array_element_type, 
 		const node_ptr& array_element_count_node
-	) : node(location),
+	) : node(node_kind::array_allocation, location),
 	m_array_element_type(array_element_type),
 	m_array_element_count(array_element_count_node) {}
 
-	expected_value array_allocation_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_allocation_node(*this, context);
-	}
-
 	void array_allocation_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(
 			depth, 
@@ -36,4 +32,8 @@ namespace sigma {
 	const node_ptr& array_allocation_node::get_array_element_count_node() const {
 		return m_array_element_count;
 	}
+
+	node_ptr& array_allocation_node::get_array_element_count_node() {
+		return m_array_element_count;
+	}
 }
\ No newline at end of file
@@ -13,15 +13,11 @@ namespace sigma {
 			const node_ptr& array_element_count_node
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(u64 depth, const std::wstring& prefix, bool is_last) override;
 
 		const type& get_array_element_type() const;
 		const node_ptr& get_array_element_count_node() const;
+		node_ptr& get_array_element_count_node();
 	private:
 		type m_array_element_type;
 		node_ptr m_array_element_count;
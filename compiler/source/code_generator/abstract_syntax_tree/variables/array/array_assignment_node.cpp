@@ -6,15 +6,11 @@ namespace sigma {
 		const node_ptr& array_base,
 		const std::vector<node_ptr>& index_nodes,
 		const node_ptr& expression_node
-	) : node(location),
+	) : node(node_kind::array_assignment, location),
 	m_array_base_node(array_base),
 	m_array_element_index_nodes(index_nodes),
 	m_expression_node(expression_node) {}
 
-	expected_value array_assignment_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_array_assignment_node(*this, context);
-	}
-
 	void array_assignment_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "array assignment", is_last);
 		console::out << "\n";
@@ -31,7 +27,11 @@ namespace sigma {
 		m_expression_node->print(depth + 1, new_prefix, true);
 	}
 
-	const node_ptr& array_assignment_node::get_array_base_node() const	{
+	const node_ptr& array_assignment_node::get_array_base_node() const {
+		return m_array_base_node;
+	}
+
+	node_ptr& array_assignment_node::get_array_base_node() {
 		return m_array_base_node;
 	}
 
@@ -39,7 +39,15 @@ namespace sigma {
 		return m_array_element_index_nodes;
 	}
 
+	std::vector<node_ptr>& array_assignment_node::get_array_element_index_nodes() {
+		return m_array_element_index_nodes;
+	}
+
 	const node_ptr& array_assignment_node::get_expression_node() const {
 		return m_expression_node;
 	}
+
+	node_ptr& array_assignment_node::get_expression_node() {
+		return m_expression_node;
+	}
 }
\ No newline at end of file
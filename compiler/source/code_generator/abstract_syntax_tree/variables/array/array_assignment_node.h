@@ -14,16 +14,14 @@ namespace sigma {
 			const node_ptr& expression_node
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(u64 depth, const std::wstring& prefix, bool is_last) override;
 
 		const node_ptr& get_array_base_node() const;
+		node_ptr& get_array_base_node();
 		const std::vector<node_ptr>& get_array_element_index_nodes() const;
+		std::vector<node_ptr>& get_array_element_index_nodes();
 		const node_ptr& get_expression_node() const;
+		node_ptr& get_expression_node();
 	private:
 		node_ptr m_array_base_node;
 		std::vector<node_ptr> m_array_element_index_nodes;
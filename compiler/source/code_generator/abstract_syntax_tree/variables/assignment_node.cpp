@@ -5,14 +5,10 @@ namespace sigma {
 		const file_position& location,
 		const node_ptr& variable,
 		const node_ptr& expression_node
-	) : node(location),
+	) : node(node_kind::assignment, location),
 	m_variable_node(variable),
 	m_expression_node(expression_node) {}
 
-	expected_value assignment_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_assignment_node(*this, context);
-	}
-
 	void assignment_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(depth, prefix, "variable assignment", is_last);
 		console::out << "\n";
@@ -28,7 +24,15 @@ namespace sigma {
 		return m_variable_node;
 	}
 
+	node_ptr& assignment_node::get_variable_node() {
+		return m_variable_node;
+	}
+
 	const node_ptr& assignment_node::get_expression_node() const {
 		return m_expression_node;
 	}
+
+	node_ptr& assignment_node::get_expression_node() {
+		return m_expression_node;
+	}
 }
\ No newline at end of file
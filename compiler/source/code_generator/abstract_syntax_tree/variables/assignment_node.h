@@ -13,15 +13,12 @@ namespace sigma {
 			const node_ptr& expression_node
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(u64 depth, const std::wstring& prefix, bool is_last) override;
 
 		const node_ptr& get_variable_node() const;
+		node_ptr& get_variable_node();
 		const node_ptr& get_expression_node() const;
+		node_ptr& get_expression_node();
 	private:
 		node_ptr m_variable_node;
 		node_ptr m_expression_node;
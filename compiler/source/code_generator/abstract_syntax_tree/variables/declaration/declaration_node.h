@@ -9,18 +9,20 @@ namespace sigma {
 	class declaration_node : public node {
 	public:
 		declaration_node(
+			node_kind kind,
 			const file_position& location,
 			const type& declaration_type,
-			const std::string& declaration_identifier,
+			symbol declaration_identifier,
 			const node_ptr& expression_node = nullptr
 		);
 
-		const std::string& get_declaration_identifier() const;
+		symbol get_declaration_identifier() const;
 		const node_ptr& get_expression_node() const;
+		node_ptr& get_expression_node();
 		const type& get_declaration_type() const;
 	private:
 		type m_declaration_type;
-		std::string m_declaration_identifier;
+		symbol m_declaration_identifier;
 		node_ptr m_expression_node;
 	};
 }
\ No newline at end of file
@@ -4,19 +4,16 @@ namespace sigma {
 	global_declaration_node::global_declaration_node(
 		const file_position& location,
 		const type& declaration_type,
-		const std::string& declaration_identifier,
+		symbol declaration_identifier,
 		const node_ptr& expression_node
 	) : declaration_node(
+		node_kind::global_declaration,
 		location,
 		declaration_type, 
 		declaration_identifier, 
 		expression_node
 	) {}
 
-	expected_value global_declaration_node::accept(code_generator& visitor, const code_generation_context& context)	{
-		return visitor.visit_global_declaration_node(*this, context);
-	}
-
 	void global_declaration_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(
 			depth, 
@@ -28,7 +25,7 @@ namespace sigma {
 		console::out
 			<< "'"
 			<< AST_NODE_VARIABLE_COLOR
-			<< get_declaration_identifier()
+			<< get_declaration_identifier().get_name()
 			<< color::white
 			<< "' '"
 			<< AST_NODE_TYPE_COLOR
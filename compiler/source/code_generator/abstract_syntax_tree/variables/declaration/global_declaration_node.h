@@ -10,15 +10,10 @@ namespace sigma {
 		global_declaration_node(
 			const file_position& location,
 			const type& declaration_type,
-			const std::string& declaration_identifier, 
+			symbol declaration_identifier, 
 			const node_ptr& expression_node = nullptr
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(u64 depth, const std::wstring& prefix, bool is_last) override;
 	};
 }
\ No newline at end of file
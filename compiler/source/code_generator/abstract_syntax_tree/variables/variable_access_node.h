@@ -9,18 +9,13 @@ namespace sigma {
 	public:
 		variable_access_node(
 			const file_position& location,
-			const std::string& variable_identifier
+			symbol variable_identifier
 		);
 
-		expected_value accept(
-			code_generator& visitor,
-			const code_generation_context& context
-		) override;
-
 		void print(u64 depth, const std::wstring& prefix, bool is_last) override;
 
-		const std::string& get_variable_identifier() const;
+		symbol get_variable_identifier() const;
 	private:
-		std::string m_variable_identifier;
+		symbol m_variable_identifier;
 	};
 }
@@ -3,14 +3,10 @@
 namespace sigma {
 	variable_node::variable_node(
 		const file_position& location,
-		const std::string& variable_identifier
-	) : node(location),
+		symbol variable_identifier
+	) : node(node_kind::variable, location),
 	m_variable_identifier(variable_identifier) {}
 
-	expected_value variable_node::accept(code_generator& visitor, const code_generation_context& context) {
-		return visitor.visit_variable_node(*this, context);
-	}
-
 	void variable_node::print(u64 depth, const std::wstring& prefix, bool is_last) {
 		print_node_name(
 			depth,
@@ -19,10 +15,10 @@ namespace sigma {
 			is_last
 		);
 
-		console::out << "'" + m_variable_identifier + "'\n";
+		console::out << "'" + m_variable_identifier.get_name() + "'\n";
 	}
 
-	const std::string& variable_node::get_variable_identifier() const {
+	symbol variable_node::get_variable_identifier() const {
 		return m_variable_identifier;
 	}
 }
@@ -1,10 +1,9 @@
 #include "basic_code_generator.h"
+#include "code_generator/node_dispatch.h"
 #include <llvm/IR/Verifier.h>
 
 namespace sigma {
-	basic_code_generator::basic_code_generator()
-		: m_scope(new scope(nullptr, nullptr))
-	{
+	basic_code_generator::basic_code_generator() {
 		// initialize function declarations
 		// for (const auto& [function_identifier, function_declaration] : m_function_registry.get_external_function_declarations()) {
 		// 	const std::vector<std::pair<std::string, type>>& arguments = function_declaration->get_arguments();
@@ -44,9 +43,14 @@ namespace sigma {
 	}
 
 	error_result basic_code_generator::generate() {
+		// functions of included modules are declared on first use, just like external functions
+		for (const auto& [name, declaration] : m_imported_functions) {
+			m_function_registry.insert_external_function_declaration(name, declaration);
+		}
+
 		// walk the abstract syntax tree
 		for (node* n : *m_abstract_syntax_tree) {
-			expected_value result = n->accept(*this, {});
+			expected_value result = generate_node(n, {});
 
 			if(!result) {
 				return result.error(); // return on failure
@@ -64,11 +68,50 @@ namespace sigma {
 		return {};
 	}
 
+	expected_value basic_code_generator::generate_node(
+		node* target,
+		const code_generation_context& context
+	) {
+		return dispatch_node(*this, target, context);
+	}
+
 	void basic_code_generator::initialize_global_variables() const {
-		// create the global ctors array
-		llvm::ArrayType* updated_ctor_array_type = llvm::ArrayType::get(CTOR_STRUCT_TYPE, m_global_ctors.size());
-		llvm::Constant* updated_ctors = llvm::ConstantArray::get(updated_ctor_array_type, m_global_ctors);
-		new llvm::GlobalVariable(*m_llvm_context->get_module(), updated_ctor_array_type, false, llvm::GlobalValue::AppendingLinkage, updated_ctors, "llvm.global_ctors");
+		// statically initialized globals which are only ever read can be treated as constants by the optimizer
+		for (llvm::GlobalVariable* global_variable : m_static_global_variables) {
+			if (std::ranges::all_of(global_variable->users(), [](const llvm::User* user) {
+				return llvm::isa<llvm::LoadInst>(user);
+			})) {
+				global_variable->setConstant(true);
+			}
+		}
+
+		if (m_global_initialization_function == nullptr) {
+			return;
+		}
+
+		// every global has been initialized statically, the init function isn't needed
+		llvm::BasicBlock* init_func_entry = &m_global_initialization_function->getEntryBlock();
+
+		if (init_func_entry->empty()) {
+			m_global_initialization_function->eraseFromParent();
+			return;
+		}
+
+		m_llvm_context->get_builder().SetInsertPoint(init_func_entry);
+		m_llvm_context->get_builder().CreateRetVoid();
+
+		// register the init function as the only constructor of the module
+		llvm::Constant* ctor = llvm::ConstantStruct::get(CTOR_STRUCT_TYPE, {
+			llvm::ConstantInt::get(llvm::Type::getInt32Ty(m_llvm_context->get_context()), 65535),
+			llvm::ConstantExpr::getBitCast(
+				m_global_initialization_function,
+				llvm::Type::getInt8PtrTy(m_llvm_context->get_context())
+			),
+			llvm::Constant::getNullValue(llvm::Type::getInt8PtrTy(m_llvm_context->get_context()))
+		});
+
+		llvm::ArrayType* ctor_array_type = llvm::ArrayType::get(CTOR_STRUCT_TYPE, 1);
+		new llvm::GlobalVariable(*m_llvm_context->get_module(), ctor_array_type, false, llvm::GlobalValue::AppendingLinkage, llvm::ConstantArray::get(ctor_array_type, ctor), "llvm.global_ctors");
 	}
 
 	void basic_code_generator::initialize_used_external_functions() const {
@@ -76,9 +119,11 @@ namespace sigma {
 	}
 
 	error_result basic_code_generator::verify_intermediate_representation() {
-		// check if we have a valid 'main' function
-		if(auto main_entry_point_error = verify_main_entry_point()) {
-			return main_entry_point_error; // return on failure
+		// check if we have a valid 'main' function, included modules don't need one
+		if (m_is_root_module) {
+			if (auto main_entry_point_error = verify_main_entry_point()) {
+				return main_entry_point_error; // return on failure
+			}
 		}
 		
 		// check for IR errors
@@ -95,12 +140,13 @@ namespace sigma {
 
 	error_result basic_code_generator::verify_main_entry_point() {
 		// check if we have a main entry point
-		if(!m_function_registry.contains_function("main")) {
+		const symbol main_identifier = m_symbol_table->intern("main");
+		if(!m_function_registry.contains_function(main_identifier)) {
 			return error::emit<4012>(); // return on failure
 		}
 
 		// check if the main entry point's return type is an i32
-		const function_ptr func = m_function_registry.get_function("main", m_llvm_context);
+		const function_ptr func = m_function_registry.get_function(main_identifier, m_llvm_context);
 		if(func->get_return_type().get_base() != type::base::i32) {
 			return error::emit<4013>(func->get_return_type()); // return on failure
 		}
@@ -108,93 +154,48 @@ namespace sigma {
 		return {};
 	}
 
-	llvm::Value* basic_code_generator::cast_value(const value_ptr& source_value, type target_type, const file_position& location) {
+	llvm::Value* basic_code_generator::cast_value(const value& source_value, type target_type, const file_position& location) {
 		// both types are the same
-		if (source_value->get_type() == target_type) {
-			return source_value->get_value();
-		}
-
-		// cast a function call
-		if (source_value->get_type() == type(type::base::function_call, 0)) {
-			// use the function return type as its type
-			const type function_return_type = m_function_registry.get_function(
-				source_value->get_name(),
-				m_llvm_context
-			)->get_return_type();
-
-			// both types are the same 
-			if (function_return_type == target_type) {
-				return source_value->get_value();
-			}
-
-			// don't allow pointer casting for now
-			//if (function_return_type.is_pointer() || target_type.is_pointer()) {
-			//	compilation_logger::emit_cannot_cast_pointer_type_error(line_number, source_value->get_type(), target_type);
-			//	return false;
-			//}
-
-			warning::emit<3001>(location, function_return_type, target_type)->print();
-
-			llvm::Value* function_call_result = source_value->get_value();
-			llvm::Type* target_llvm_type = target_type.get_llvm_type(function_call_result->getContext());
-
-			// perform the cast op
-			if (function_return_type.is_floating_point()) {
-				if (target_type.is_integral()) {
-					return m_llvm_context->get_builder().CreateFPToSI(function_call_result, target_llvm_type, "fptosi");
-				}
-
-				if (target_type.is_floating_point()) {
-					return m_llvm_context->get_builder().CreateFPCast(function_call_result, target_llvm_type, "fpcast");
-				}
-			}
-			else if (function_return_type.is_integral()) {
-				if (target_type.is_floating_point()) {
-					return m_llvm_context->get_builder().CreateSIToFP(function_call_result, target_llvm_type, "sitofp");
-				}
-
-				if (target_type.is_integral()) {
-					return m_llvm_context->get_builder().CreateIntCast(function_call_result, target_llvm_type, target_type.is_signed(), "intcast");
-				}
-			}
+		if (source_value.get_type() == target_type) {
+			return source_value.get_value();
 		}
 
 		// don't allow pointer casting for now
-		//if (source_value->get_type().is_pointer() || target_type.is_pointer()) {
-		//	compilation_logger::emit_cannot_cast_pointer_type_error(line_number, source_value->get_type(), target_type);
+		//if (source_value.get_type().is_pointer() || target_type.is_pointer()) {
+		//	compilation_logger::emit_cannot_cast_pointer_type_error(line_number, source_value.get_type(), target_type);
 		//	return false;
 		//}
 
-		warning::emit<3002>(location, source_value->get_type(), target_type)->print();
+		warning::emit<3002>(location, source_value.get_type(), target_type)->print();
 
 		// get the LLVM value and type for source and target
-		llvm::Value* source_llvm_value = source_value->get_value();
+		llvm::Value* source_llvm_value = source_value.get_value();
 		llvm::Type* target_llvm_type = target_type.get_llvm_type(source_llvm_value->getContext());
 
 		// boolean to i32
-		if (source_value->get_type().get_base() == type::base::boolean && target_type.get_base() == type::base::i32) {
+		if (source_value.get_type().get_base() == type::base::boolean && target_type.get_base() == type::base::i32) {
 			return m_llvm_context->get_builder().CreateZExt(source_llvm_value, target_llvm_type, "zext");
 		}
 
 		// floating-point to integer
-		if (source_value->get_type().is_floating_point() && target_type.is_integral()) {
+		if (source_value.get_type().is_floating_point() && target_type.is_integral()) {
 			return m_llvm_context->get_builder().CreateFPToSI(source_llvm_value, target_llvm_type);
 		}
 
 		// integer to floating-point
-		if (source_value->get_type().is_integral() && target_type.is_floating_point()) {
+		if (source_value.get_type().is_integral() && target_type.is_floating_point()) {
 			return m_llvm_context->get_builder().CreateSIToFP(source_llvm_value, target_llvm_type);
 		}
 
 		// floating-point upcast or downcast
-		if (source_value->get_type().is_floating_point() && target_type.is_floating_point()) {
+		if (source_value.get_type().is_floating_point() && target_type.is_floating_point()) {
 			return m_llvm_context->get_builder().CreateFPCast(source_llvm_value, target_llvm_type, "fpcast");
 		}
 
 		// other cases
-		if (source_value->get_type().get_bit_width() < target_type.get_bit_width()) {
+		if (source_value.get_type().get_bit_width() < target_type.get_bit_width()) {
 			// perform upcast
-			if (source_value->get_type().is_unsigned()) {
+			if (source_value.get_type().is_unsigned()) {
 				return m_llvm_context->get_builder().CreateZExt(source_llvm_value, target_llvm_type, "zext");
 			}
 
@@ -205,19 +206,21 @@ namespace sigma {
 		return m_llvm_context->get_builder().CreateTrunc(source_llvm_value, target_llvm_type, "trunc");
 	}
 
-	bool basic_code_generator::get_named_value(value_ptr& out_value, const std::string& variable_name) {
+	bool basic_code_generator::get_named_value(value& out_value, symbol variable_name) {
 		// check the local scope
-		out_value = m_scope->get_named_value(variable_name);
+		if (const value* local_value = m_scope.get_named_value(variable_name)) {
+			out_value = *local_value;
+			return true;
+		}
 
-		if (!out_value) {
-			// variable with the given name was not found in the local scope hierarchy, check global variables
-			out_value = m_global_named_values[variable_name];
+		// variable with the given name was not found in the local scope hierarchy, check global variables
+		const auto global_value = m_global_named_values.find(variable_name);
 
-			if (!out_value) {
-				return false; // variable not found
-			}
+		if (global_value == m_global_named_values.end()) {
+			return false; // variable not found
 		}
 
+		out_value = global_value->second;
 		return true;
 	}
 }
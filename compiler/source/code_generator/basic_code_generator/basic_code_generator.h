@@ -2,6 +2,7 @@
 
 #include "parser/parser.h"
 #include "code_generator/code_generator.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/constant_node.h"
 #include "llvm_wrappers/scope.h"
 #include "llvm_wrappers/code_generation_context.h"
 #include "llvm_wrappers/functions/function_registry.h"
@@ -15,17 +16,38 @@ llvm::StructType::get(m_llvm_context->get_context(), {       \
 
 namespace sigma {
 	class declaration_node;
+	class operator_unary_base;
+	class operator_binary_base;
 
 	/**
-	 * \brief Evaluator that implements the codegen visitor to generate LLVM IR.
+	 * \brief Evaluator that implements the codegen visitor to generate LLVM IR. The class is final, so that nodes
+	 * dispatched by generate_node reach their visit methods without going through the vtable.
 	 */
-	class basic_code_generator : public code_generator {
+	class basic_code_generator final : public code_generator {
 	public:
 		basic_code_generator();
 
 		error_result generate() override;
 		error_result verify_intermediate_representation();
 	private:
+		template<typename visitor_type>
+		friend expected_value dispatch_node(
+			visitor_type& visitor,
+			node* target,
+			const code_generation_context& context
+		);
+
+		/**
+		 * \brief Generates the given \a target node, dispatches to the visit method of its kind.
+		 * \param target Node to generate
+		 * \param context Code generation context of the node
+		 * \return Result of the visit, either an error or the generated value.
+		 */
+		expected_value generate_node(
+			node* target,
+			const code_generation_context& context
+		);
+
 		// functions
 		// codegen_visitor_functions.cpp
 		expected_value visit_function_node(
@@ -94,83 +116,19 @@ namespace sigma {
 		);
 
 		/**
-		 * \brief Creates LLVM blocks for the \a add operation.
-		 * \param left_operand Left operand
-		 * \param right_operand Right operand
-		 * \return Expected - value(operation result, operation precision, left operand result), error received from inner accept invocations.
+		 * \brief Loads the value of the given local or global variable.
+		 * \param variable_identifier Name of the variable
+		 * \param location Location of the access
+		 * \return Expected - loaded value, error if the variable doesn't exist.
 		 */
-		std::expected<std::tuple<
-			llvm::Value*,
-			type,
-			expected_value
-		>, error_msg> create_add_operation(
-			node* left_operand,
-			node* right_operand
-		);
-
-		/**
-		 * \brief Creates LLVM blocks for the \a sub operation.
-		 * \param left_operand Left operand
-		 * \param right_operand Right operand
-		 * \return Expected - value(operation result, operation precision, left operand result), error received from inner accept invocations.
-		 */
-		std::expected<std::tuple<
-			llvm::Value*,
-			type,
-			expected_value
-		>, error_msg> create_sub_operation(
-			node* left_operand,
-			node* right_operand
-		);
-
-		/**
-		 * \brief Creates LLVM blocks for the \a mul operation.
-		 * \param left_operand Left operand
-		 * \param right_operand Right operand
-		 * \return Expected - value(operation result, operation precision, left operand result), error received from inner accept invocations.
-		 */
-		std::expected<std::tuple<
-			llvm::Value*,
-			type,
-			expected_value
-		>, error_msg> create_mul_operation(
-			node* left_operand,
-			node* right_operand
-		);
-
-		/**
-		 * \brief Creates LLVM blocks for the \a div operation.
-		 * \param left_operand Left operand
-		 * \param right_operand Right operand
-		 * \return Expected - value(operation result, operation precision, left operand result), error received from inner accept invocations.
-		 */
-		std::expected<std::tuple<
-			llvm::Value*,
-			type,
-			expected_value
-		>, error_msg> create_div_operation(
-			node* left_operand,
-			node* right_operand
-		);
-
-		/**
-		 * \brief Creates LLVM blocks for the \a mod operation.
-		 * \param left_operand Left operand
-		 * \param right_operand Right operand
-		 * \return Expected - value(operation result, operation precision, left operand result), error received from inner accept invocations.
-		 */
-		std::expected<std::tuple<
-			llvm::Value*,
-			type,
-			expected_value
-		>, error_msg> create_mod_operation(
-			node* left_operand,
-			node* right_operand
+		expected_value load_variable(
+			symbol variable_identifier,
+			const file_position& location
 		);
 
 		bool get_named_value(
-			value_ptr& out_value,
-			const std::string& variable_name
+			value& out_value,
+			symbol variable_name
 		);
 
 		// flow control
@@ -222,10 +180,34 @@ namespace sigma {
 			const code_generation_context& context
 		) override;
 
+		expected_value visit_constant_node(
+			constant_node& node,
+			const code_generation_context& context
+		) override;
+
+		// expressions
+		// basic_code_generator_expressions.cpp
+		expected_value visit_flat_expression_node(
+			flat_expression_node& node,
+			const code_generation_context& context
+		) override;
+
 		// utility
-		value_ptr create_boolean(bool value);
+		/**
+		 * \brief Creates the given constant, and reports the implicit casts of the operands which have been folded
+		 * into it.
+		 * \param value Constant to create
+		 * \param implicit_casts Implicit casts of the folded operands, in generation order
+		 * \return Created constant value.
+		 */
+		value create_constant(
+			const constant& value,
+			std::span<const implicit_cast> implicit_casts
+		);
+
+		value create_boolean(bool value);
 
-		value_ptr create_character(char value);
+		value create_character(char value);
 
 		// operators
 		// codegen_visitor_operators.cpp
@@ -383,8 +365,119 @@ namespace sigma {
 		) override;
 
 		// utility
+		expected_value generate_unary_operator(
+			const operator_unary_base& node
+		);
+
+		std::expected<std::pair<value, value>, error_msg> generate_binary_operands(
+			const operator_binary_base& node
+		);
+
+		expected_value generate_binary_operator(
+			const operator_binary_base& node
+		);
+
+		/**
+		 * \brief Generates the given compound assignment, the result of \a operation is stored into the left operand.
+		 * \param node Compound assignment node
+		 * \param operation Kind of the binary operator the assignment performs
+		 * \return Expected - result of the operation, error received from inner generate_node invocations.
+		 */
+		expected_value generate_compound_assignment(
+			const operator_binary_base& node,
+			node_kind operation
+		);
+
+		/**
+		 * \brief Creates LLVM blocks for the unary operator \a operation, shared by the AST nodes and flat expressions.
+		 * \param operation Kind of the operator (logical or bitwise NOT)
+		 * \param operand Generated operand
+		 * \param location Location of the operator
+		 * \return Expected - result of the operation, error if the operand type isn't supported by the operator.
+		 */
+		expected_value create_unary_operation(
+			node_kind operation,
+			const value& operand,
+			const file_position& location
+		);
+
+		/**
+		 * \brief Creates LLVM blocks for the binary operator \a operation, shared by the AST nodes and flat expressions.
+		 * \param operation Kind of the operator
+		 * \param left_operand Generated left operand
+		 * \param right_operand Generated right operand
+		 * \param location Location of the operator
+		 * \param left_operand_location Location of the left operand, used by implicit cast warnings
+		 * \param right_operand_location Location of the right operand, used by implicit cast warnings
+		 * \return Expected - result of the operation, error if the operand types aren't supported by the operator.
+		 */
+		expected_value create_binary_operation(
+			node_kind operation,
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& location,
+			const file_position& left_operand_location,
+			const file_position& right_operand_location
+		);
+
+		value create_add_operation(
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& left_operand_location,
+			const file_position& right_operand_location
+		);
+
+		value create_sub_operation(
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& left_operand_location,
+			const file_position& right_operand_location
+		);
+
+		value create_mul_operation(
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& left_operand_location,
+			const file_position& right_operand_location
+		);
+
+		value create_div_operation(
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& left_operand_location,
+			const file_position& right_operand_location
+		);
+
+		value create_mod_operation(
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& left_operand_location,
+			const file_position& right_operand_location
+		);
+
+		expected_value create_bitwise_operation(
+			node_kind operation,
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& location
+		);
+
+		expected_value create_logical_operation(
+			node_kind operation,
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& location
+		);
+
+		expected_value create_comparison_operation(
+			node_kind operation,
+			const value& left_operand,
+			const value& right_operand,
+			const file_position& location
+		);
+
 		llvm::Value* cast_value(
-			const value_ptr& source_value,
+			const value& source_value,
 			type target_type, 
 			const file_position& location
 		);
@@ -394,10 +487,14 @@ namespace sigma {
 		void initialize_used_external_functions() const;
 	private:
 		// variable utility 
-		scope_ptr m_scope;
-		std::unordered_map<std::string, value_ptr> m_global_named_values;
-		std::vector<llvm::Constant*> m_global_ctors;
-		u64 m_global_initialization_priority = 0;
+		// named values of the function that is being generated
+		scope m_scope;
+		std::unordered_map<symbol, value> m_global_named_values;
+		std::vector<llvm::GlobalVariable*> m_static_global_variables;
+		llvm::Function* m_global_initialization_function = nullptr;
 		function_registry m_function_registry;
+		// values of the flat expressions which are being generated, nested expressions (ie. in the arguments of a
+		// function call) are appended after the values of the expression which contains them
+		std::vector<value> m_expression_values;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "basic_code_generator.h"
+
+#include "code_generator/abstract_syntax_tree/expressions/flat_expression_node.h"
+
+namespace sigma {
+	expected_value basic_code_generator::visit_flat_expression_node(
+		flat_expression_node& node,
+		const code_generation_context& context
+	) {
+		(void)context; // suppress C4100
+		const expression_table& table = node.get_expression_table();
+		const expression_index first_expression = node.get_first_expression();
+		const u64 value_offset = m_expression_values.size();
+
+		// operands precede their operators, the expression is therefore generated by a single pass over its range
+		for (expression_index index = first_expression; index <= node.get_root_expression(); index++) {
+			const expression_table::expression expression = table.get_expression(index);
+			const auto get_operand = [&](expression_index operand) -> const value& {
+				return m_expression_values[value_offset + operand - first_expression];
+			};
+
+			expected_value expression_result;
+
+			switch (expression.kind) {
+			case node_kind::constant:
+				expression_result = create_constant(
+					table.get_constant(expression.data_index),
+					table.get_implicit_casts(expression.data_index)
+				);
+				break;
+			case node_kind::variable_access:
+				expression_result = load_variable(
+					table.get_variable_identifier(expression.data_index),
+					table.get_location(index)
+				);
+				break;
+			case node_kind::operator_bitwise_not:
+			case node_kind::operator_not:
+				expression_result = create_unary_operation(
+					expression.kind,
+					get_operand(table.get_unary_operand(expression.data_index)),
+					table.get_location(index)
+				);
+				break;
+			case node_kind::operator_addition:
+			case node_kind::operator_subtraction:
+			case node_kind::operator_multiplication:
+			case node_kind::operator_division:
+			case node_kind::operator_modulo:
+			case node_kind::operator_bitwise_and:
+			case node_kind::operator_bitwise_or:
+			case node_kind::operator_bitwise_left_shift:
+			case node_kind::operator_bitwise_right_shift:
+			case node_kind::operator_bitwise_xor:
+			case node_kind::operator_conjunction:
+			case node_kind::operator_disjunction:
+			case node_kind::operator_greater_than:
+			case node_kind::operator_greater_than_equal_to:
+			case node_kind::operator_less_than:
+			case node_kind::operator_less_than_equal_to:
+			case node_kind::operator_equals:
+			case node_kind::operator_not_equals: {
+				const expression_table::binary_operation& operation = table.get_binary_operation(
+					expression.data_index
+				);
+
+				expression_result = create_binary_operation(
+					expression.kind,
+					get_operand(operation.left_operand),
+					get_operand(operation.right_operand),
+					table.get_location(index),
+					table.get_location(operation.left_operand),
+					table.get_location(operation.right_operand)
+				);
+				break;
+			}
+			default:
+				// operands which stay in the tree
+				expression_result = generate_node(
+					table.get_node(expression.data_index),
+					{}
+				);
+			}
+
+			if (!expression_result) {
+				m_expression_values.erase(m_expression_values.begin() + value_offset, m_expression_values.end());
+				return expression_result; // return on failure
+			}
+
+			m_expression_values.push_back(expression_result.value());
+		}
+
+		const value root_value = m_expression_values.back();
+		m_expression_values.erase(m_expression_values.begin() + value_offset, m_expression_values.end());
+		return root_value;
+	}
+}
\ No newline at end of file
@@ -14,7 +14,7 @@ namespace sigma {
 		(void)context; // suppress C4100
 		// get the return type of the current function
 		const llvm::Function* parent_function_block = m_llvm_context->get_builder().GetInsertBlock()->getParent();
-		const std::string parent_function_identifier = parent_function_block->getName().str();
+		const symbol parent_function_identifier = m_symbol_table->intern(parent_function_block->getName().str());
 		const function_ptr parent_function = m_function_registry.get_function(
 			parent_function_identifier,
 			m_llvm_context
@@ -23,8 +23,8 @@ namespace sigma {
 		// check if we have a return expression
 		if(node.get_return_expression_node()) {
 			// evaluate the expression of the return statement, if there is one
-			expected_value return_value_result = node.get_return_expression_node()->accept(
-				*this,
+			expected_value return_value_result = generate_node(
+				node.get_return_expression_node(),
 				{}
 			);
 
@@ -45,8 +45,7 @@ namespace sigma {
 			);
 
 			// return the value of the expression (use the upcasted value's type)
-			return std::make_shared<value>(
-				"__return",
+			return value(
 				parent_function->get_return_type(),
 				upcasted_return_value
 			);
@@ -66,8 +65,7 @@ namespace sigma {
 
 		m_llvm_context->get_builder().CreateRetVoid();
 
-		return std::make_shared<value>(
-			"__return",
+		return value(
 			parent_function->get_return_type(),
 			nullptr
 		);
@@ -117,9 +115,9 @@ namespace sigma {
 			);
 		}
 
-		// accept the first condition
-		expected_value condition_value_result = condition_nodes[0]->accept(
-			*this,
+		// generate the first condition
+		expected_value condition_value_result = generate_node(
+			condition_nodes[0],
 			code_generation_context(type(type::base::boolean, 0))
 		);
 
@@ -129,7 +127,7 @@ namespace sigma {
 
 		// create a conditional branch based on the first condition
 		m_llvm_context->get_builder().CreateCondBr(
-			condition_value_result.value()->get_value(),
+			condition_value_result.value().get_value(),
 			branch_blocks[0],
 			condition_blocks.empty() ? (has_trailing_else ? branch_blocks.back() : end_block) : condition_blocks[0]
 		);
@@ -138,8 +136,8 @@ namespace sigma {
 		for (u64 i = 0; i < condition_node_count; ++i) {
 			m_llvm_context->get_builder().SetInsertPoint(condition_blocks[i]);
 
-			condition_value_result = condition_nodes[i + 1]->accept(
-				*this,
+			condition_value_result = generate_node(
+				condition_nodes[i + 1],
 				code_generation_context(type(type::base::boolean, 0))
 			);
 
@@ -148,23 +146,20 @@ namespace sigma {
 			}
 
 			m_llvm_context->get_builder().CreateCondBr(
-				condition_value_result.value()->get_value(),
+				condition_value_result.value().get_value(),
 				branch_blocks[i + 1],
 				i < condition_node_count - 1 ? condition_blocks[i + 1] : branch_blocks.back()
 			);
 		}
 
-		// save the previous scope
-		scope_ptr prev_scope = m_scope;
-
-		// process branch nodes and create appropriate inner statements
+		// process branch nodes and create appropriate inner statements, every branch has its own scope
 		for (u64 i = 0; i < branch_nodes.size(); ++i) {
 			m_llvm_context->get_builder().SetInsertPoint(branch_blocks[i]);
-			m_scope = std::make_unique<scope>(prev_scope);
+			const scope::mark branch_scope = m_scope.enter();
 
 			for (const auto& statement : branch_nodes[i]) {
-				expected_value statement_result = statement->accept(
-					*this,
+				expected_value statement_result = generate_node(
+					statement,
 					{}
 				);
 
@@ -176,12 +171,13 @@ namespace sigma {
 			if(!m_llvm_context->get_builder().GetInsertBlock()->getTerminator()) {
 				m_llvm_context->get_builder().CreateBr(end_block);
 			}
+
+			m_scope.exit(branch_scope);
 		}
 
-		// restore the previous scope and set the insert point to the end block
-		m_scope = prev_scope;
+		// set the insert point to the end block
 		m_llvm_context->get_builder().SetInsertPoint(end_block);
-		return nullptr;
+		return value();
 	}
 
 	expected_value basic_code_generator::visit_while_node(
@@ -216,13 +212,12 @@ namespace sigma {
 		// condition block
 		m_llvm_context->get_builder().SetInsertPoint(condition_block);
 
-		// save the previous scope
-		scope_ptr prev_scope = m_scope;
-		m_scope = std::make_shared<scope>(prev_scope, end_block);
+		// enter the loop scope
+		const scope::mark loop_scope = m_scope.enter(end_block);
 
-		// accept the condition node
-		expected_value condition_value_result = node.get_loop_condition_node()->accept(
-			*this,
+		// generate the condition node
+		expected_value condition_value_result = generate_node(
+			node.get_loop_condition_node(),
 			code_generation_context(type(type::base::boolean, 0))
 		);
 
@@ -231,17 +226,17 @@ namespace sigma {
 		}
 
 		m_llvm_context->get_builder().CreateCondBr(
-			condition_value_result.value()->get_value(),
+			condition_value_result.value().get_value(),
 			loop_body_block,
 			end_block
 		);
 
-		// accept all statements in the loop body
+		// generate all statements in the loop body
 		m_llvm_context->get_builder().SetInsertPoint(loop_body_block);
 
 		for (sigma::node* n : node.get_loop_body_nodes()) {
-			expected_value statement_result = n->accept(
-				*this,
+			expected_value statement_result = generate_node(
+				n,
 				{}
 			);
 
@@ -251,7 +246,7 @@ namespace sigma {
 		}
 
 		// restore the previous scope and set the insert point to the end block
-		m_scope = prev_scope;
+		m_scope.exit(loop_scope);
 
 		// only add a terminator block if we don't have one
 		if (!m_llvm_context->get_builder().GetInsertBlock()->getTerminator()) {
@@ -259,7 +254,7 @@ namespace sigma {
 		}
 
 		m_llvm_context->get_builder().SetInsertPoint(end_block);
-		return nullptr;
+		return value();
 	}
 
 	expected_value basic_code_generator::visit_for_node(
@@ -295,13 +290,12 @@ namespace sigma {
 			parent_function
 		);
 
-		// save the previous scope
-		scope_ptr prev_scope = m_scope;
-		m_scope = std::make_shared<scope>(prev_scope, end_block);
+		// enter the loop scope
+		const scope::mark loop_scope = m_scope.enter(end_block);
 
 		// create the index expression
-		expected_value index_expression_result = node.get_loop_initialization_node()->accept(
-			*this,
+		expected_value index_expression_result = generate_node(
+			node.get_loop_initialization_node(),
 			{}
 		);
 
@@ -311,11 +305,11 @@ namespace sigma {
 
 		m_llvm_context->get_builder().CreateBr(condition_block);
 
-		// accept the condition block
+		// generate the condition block
 		m_llvm_context->get_builder().SetInsertPoint(condition_block);
 
-		expected_value condition_value_result = node.get_loop_condition_node()->accept(
-			*this, 
+		expected_value condition_value_result = generate_node(
+			node.get_loop_condition_node(),
 			{}
 		);
 
@@ -324,18 +318,18 @@ namespace sigma {
 		}
 
 		// check if the conditional operator evaluates to a boolean
-		if (condition_value_result.value()->get_type().get_base() != type::base::boolean ||
-			condition_value_result.value()->get_type().is_pointer()) {
+		if (condition_value_result.value().get_type().get_base() != type::base::boolean ||
+			condition_value_result.value().get_type().is_pointer()) {
 			return std::unexpected(
 				error::emit<4010>(
 					std::move(node.get_declared_location()),
-					condition_value_result.value()->get_type()
+					condition_value_result.value().get_type()
 				)
 			);
 		}
 
 		m_llvm_context->get_builder().CreateCondBr(
-			condition_value_result.value()->get_value(),
+			condition_value_result.value().get_value(),
 			loop_body_block,
 			end_block
 		);
@@ -343,7 +337,7 @@ namespace sigma {
 		// create the increment block
 		m_llvm_context->get_builder().SetInsertPoint(increment_block);
 		for (sigma::node* n : node.get_post_iteration_nodes()) {
-			expected_value statement_result = n->accept(*this, {});
+			expected_value statement_result = generate_node(n, {});
 			if (!statement_result) {
 				return statement_result; // return on failure
 			}
@@ -354,16 +348,16 @@ namespace sigma {
 		// create the loop body block
 		m_llvm_context->get_builder().SetInsertPoint(loop_body_block);
 
-		// accept all inner statements
+		// generate all inner statements
 		for (sigma::node* n : node.get_loop_body_nodes()) {
-			expected_value statement_result = n->accept(*this, {});
+			expected_value statement_result = generate_node(n, {});
 			if (!statement_result) {
 				return statement_result; // return on failure
 			}
 		}
 
 		// restore the previous scope and set the insert point to the end block
-		m_scope = prev_scope;
+		m_scope.exit(loop_scope);
 
 		// only add a terminator block if we don't have one
 		if (!m_llvm_context->get_builder().GetInsertBlock()->getTerminator()) {
@@ -371,7 +365,7 @@ namespace sigma {
 		}
 
 		m_llvm_context->get_builder().SetInsertPoint(end_block);
-		return nullptr;
+		return value();
 	}
 
 	expected_value basic_code_generator::visit_break_node(
@@ -380,7 +374,7 @@ namespace sigma {
 	) {
 		(void)context; // suppress C4100
 
-		llvm::BasicBlock* end_block = m_scope->get_loop_end_block();
+		llvm::BasicBlock* end_block = m_scope.get_loop_end_block();
 		if (end_block == nullptr) {
 			// emit an error if there's no enclosing loop to break from
 			return std::unexpected(
@@ -404,6 +398,6 @@ namespace sigma {
 		);
 
 		m_llvm_context->get_builder().SetInsertPoint(continue_block);
-		return nullptr;
+		return value();
 	}
 }
\ No newline at end of file
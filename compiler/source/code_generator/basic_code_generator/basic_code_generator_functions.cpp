@@ -9,6 +9,11 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
+		const trace::scope function_scope(
+			m_trace.get(),
+			"codegen " + node.get_function_identifier().get_name()
+		);
+
 		// get the function return type
 		llvm::Type* return_type = node.get_function_return_type().get_llvm_type(
 			m_llvm_context->get_context()
@@ -16,12 +21,15 @@ namespace sigma {
 
 		// convert the argument types to LLVM types and store them in a vector
 		std::vector<llvm::Type*> param_types;
+		std::vector<std::pair<std::string, type>> arguments;
 		for (const auto& [arg_name, arg_type] : node.get_function_arguments()) {
 			param_types.push_back(
 				arg_type.get_llvm_type(
 					m_llvm_context->get_context()
 				)
 			);
+
+			arguments.emplace_back(arg_name.get_name(), arg_type);
 		}
 
 		// create the LLVM function
@@ -34,8 +42,8 @@ namespace sigma {
 		llvm::Function* func = llvm::Function::Create(
 			func_type, 
 			llvm::Function::ExternalLinkage,
-			node.get_function_identifier(), 
-			m_llvm_context->get_module().get()
+			node.get_function_identifier().get_name(), 
+			m_llvm_context->get_module()
 		);
 
 		// check for multiple definitions by checking if the function has already been added to our map
@@ -45,7 +53,7 @@ namespace sigma {
 			return std::unexpected(
 				error::emit<4000>(
 					std::move(node.get_declared_location()), 
-					node.get_function_identifier()
+					node.get_function_identifier().get_name()
 				)
 			); // return on failure
 		}
@@ -56,7 +64,7 @@ namespace sigma {
 			std::make_shared<function>(
 				node.get_function_return_type(),
 				func,
-				node.get_function_arguments(),
+				arguments,
 				false
 			)
 		);
@@ -71,28 +79,26 @@ namespace sigma {
 		m_llvm_context->get_builder().SetInsertPoint(entry_block);
 
 		// create a new nested scope for the function body
-		scope_ptr prev_scope = m_scope;
-		m_scope = std::make_shared<scope>(prev_scope);
+		const scope::mark body_scope = m_scope.enter();
 
 		// create the given arguments 
 		u64 index = 0;
 		for (const auto& [arg_name, arg_type] : node.get_function_arguments()) {
 			// get the corresponding LLVM function argument
 			llvm::Argument* llvm_arg = func->arg_begin() + index;
-			llvm_arg->setName(arg_name);
+			llvm_arg->setName(arg_name.get_name());
 
 			// create an alloca instruction for the argument and store the incoming value into it
 			llvm::AllocaInst* alloca = m_llvm_context->get_builder().CreateAlloca(
 				arg_type.get_llvm_type(m_llvm_context->get_context()), 
 				nullptr, 
-				arg_name
+				arg_name.get_name()
 			);
 
 			m_llvm_context->get_builder().CreateStore(llvm_arg, alloca);
 
 			// add the alloca to the current scope
-			m_scope->add_named_value(arg_name, std::make_shared<value>(
-				arg_name,
+			m_scope.add_named_value(arg_name, value(
 				arg_type,
 				alloca
 			));
@@ -100,10 +106,10 @@ namespace sigma {
 			index++;
 		}
 
-		// accept all statements inside the function
+		// generate all statements inside the function
 		for (const auto& statement : node.get_function_statements()) {
-			expected_value statement_result = statement->accept(
-				*this,
+			expected_value statement_result = generate_node(
+				statement,
 				{}
 			);
 
@@ -113,7 +119,7 @@ namespace sigma {
 		}
 	
 		// restore the previous scope
-		m_scope = prev_scope;
+		m_scope.exit(body_scope);
 
 		// add a return statement if the function does not have one
 		if (m_llvm_context->get_builder().GetInsertBlock()->getTerminator() == nullptr) {
@@ -122,7 +128,7 @@ namespace sigma {
 			if(node.get_function_return_type() != type(type::base::empty, 0)) {
 				warning::emit<3000>(
 					node.get_declared_location(),
-					node.get_function_identifier()
+					node.get_function_identifier().get_name()
 				)->print();
 			}
 
@@ -138,9 +144,13 @@ namespace sigma {
 			}
 		}
 
+		function_scope.add_counter(
+			"instructions",
+			static_cast<i64>(func->getInstructionCount())
+		);
+
 		// return the function as the value
-		return std::make_shared<value>(
-			node.get_function_identifier(),
+		return value(
 			type(type::base::function, 0),
 			func
 		);
@@ -162,7 +172,7 @@ namespace sigma {
 			return std::unexpected(
 				error::emit<4001>(
 					std::move(node.get_declared_location()),
-					node.get_function_identifier()
+					node.get_function_identifier().get_name()
 				)
 			); // return on failure
 		}
@@ -175,7 +185,7 @@ namespace sigma {
 			return std::unexpected(
 				error::emit<4002>(
 					std::move(node.get_declared_location()),
-					node.get_function_identifier()
+					node.get_function_identifier().get_name()
 				)
 			); // return on failure
 		}
@@ -184,8 +194,8 @@ namespace sigma {
 		std::vector<llvm::Value*> argument_values(required_arguments.size());
 		for (u64 i = 0; i < required_arguments.size(); i++) {
 			// get the argument value
-			expected_value argument_result = given_arguments[i]->accept(
-				*this,
+			expected_value argument_result = generate_node(
+				given_arguments[i],
 				code_generation_context(required_arguments[i].second)
 			);
 
@@ -204,8 +214,8 @@ namespace sigma {
 		// parse variadic arguments
 		for (u64 i = required_arguments.size(); i < given_arguments.size(); i++) {
 			// get the argument value
-			expected_value argument_result = given_arguments[i]->accept(
-				*this,
+			expected_value argument_result = generate_node(
+				given_arguments[i],
 				{}
 			);
 
@@ -213,9 +223,9 @@ namespace sigma {
 				return argument_result; // return on failure
 			}
 
-			value_ptr argument_value = argument_result.value();
+			value argument_value = argument_result.value();
 
-			const type argument_type = argument_result.value()->get_type();
+			const type argument_type = argument_result.value().get_type();
 
 			// default variadic promotions:
 			if(argument_type == type(type::base::f32, 0)) {
@@ -226,8 +236,7 @@ namespace sigma {
 					given_arguments[i]->get_declared_location()
 				);
 
-				argument_value = std::make_shared<value>(
-					argument_value->get_name(),
+				argument_value = value(
 					type(type::base::f64, 0), 
 					argument_value_cast
 				);
@@ -240,14 +249,13 @@ namespace sigma {
 					given_arguments[i]->get_declared_location()
 				);
 
-				argument_value = std::make_shared<value>(
-					argument_value->get_name(),
+				argument_value = value(
 					type(type::base::i32, 0),
 					argument_value_cast
 				);
 			}
 
-			argument_values.push_back(argument_value->get_value());
+			argument_values.push_back(argument_value.get_value());
 		}
 
 		// return the function call as the value
@@ -261,13 +269,12 @@ namespace sigma {
 		// only return the call if we have to store the value (if the function returns a non-void and non-pointer value)
 		if (return_type.is_pointer() || 
 			return_type.get_base() != type::base::empty) {
-			return std::make_shared<value>(
-				node.get_function_identifier(),
+			return value(
 				return_type, 
 				call_inst
 			); 
 		}
 
-		return nullptr;
+		return value();
 	}
 }
\ No newline at end of file
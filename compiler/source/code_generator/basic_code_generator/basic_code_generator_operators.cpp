@@ -46,8 +46,8 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		expected_value expression_result = node.get_expression_node()->accept(
-			*this, 
+		expected_value expression_result = generate_node(
+			node.get_expression_node(),
 			{}
 		);
 
@@ -56,21 +56,21 @@ namespace sigma {
 		}
 
 		// check if the expression is an integer or a floating-point value
-		if (!expression_result.value()->get_type().is_numerical()) {
+		if (!expression_result.value().get_type().is_numerical()) {
 			return std::unexpected(
 				error::emit<4100>(
 					std::move(node.get_declared_location()), 
-					expression_result.value()->get_type()
+					expression_result.value().get_type()
 				)
 			); // return on failure
 		}
 
 		llvm::Value* decrement_result;
-		if (expression_result.value()->get_type().is_floating_point()) {
+		if (expression_result.value().get_type().is_floating_point()) {
 			decrement_result = m_llvm_context->get_builder().CreateFSub(
-				expression_result.value()->get_value(),
+				expression_result.value().get_value(),
 				llvm::ConstantFP::get(
-					expression_result.value()->get_type().get_llvm_type(
+					expression_result.value().get_type().get_llvm_type(
 						m_llvm_context->get_context()
 					), 
 					1.0
@@ -79,20 +79,20 @@ namespace sigma {
 		}
 		else {
 			decrement_result = m_llvm_context->get_builder().CreateSub(
-				expression_result.value()->get_value(),
+				expression_result.value().get_value(),
 				llvm::ConstantInt::get(
-					expression_result.value()->get_type().get_llvm_type(m_llvm_context->get_context()),
+					expression_result.value().get_type().get_llvm_type(m_llvm_context->get_context()),
 					1
 				)
 			);
 		}
 
 		// assert that the pointer is not nullptr
-		ASSERT(expression_result.value()->get_pointer() != nullptr, "pointer is nullptr");
+		ASSERT(expression_result.value().get_pointer() != nullptr, "pointer is nullptr");
 
 		m_llvm_context->get_builder().CreateStore(
 			decrement_result,
-			expression_result.value()->get_pointer()
+			expression_result.value().get_pointer()
 		);
 
 		return expression_result;
@@ -103,8 +103,8 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		expected_value expression_result = node.get_expression_node()->accept(
-			*this,
+		expected_value expression_result = generate_node(
+			node.get_expression_node(),
 			{}
 		);
 
@@ -113,41 +113,41 @@ namespace sigma {
 		}
 
 		// check if the expression is an integer or a floating-point value
-		if (!expression_result.value()->get_type().is_numerical()) {
+		if (!expression_result.value().get_type().is_numerical()) {
 			return std::unexpected(
 				error::emit<4101>(
 					std::move(node.get_declared_location()),
-					expression_result.value()->get_type()
+					expression_result.value().get_type()
 				)
 			); // return on failure
 		}
 
 		llvm::Value* decrement_result;
-		if (expression_result.value()->get_type().is_floating_point()) {
+		if (expression_result.value().get_type().is_floating_point()) {
 			decrement_result = m_llvm_context->get_builder().CreateFAdd(
-				expression_result.value()->get_value(),
+				expression_result.value().get_value(),
 				llvm::ConstantFP::get(
-					expression_result.value()->get_type().get_llvm_type(m_llvm_context->get_context()),
+					expression_result.value().get_type().get_llvm_type(m_llvm_context->get_context()),
 					1.0
 				)
 			);
 		}
 		else {
 			decrement_result = m_llvm_context->get_builder().CreateAdd(
-				expression_result.value()->get_value(), 
+				expression_result.value().get_value(), 
 				llvm::ConstantInt::get(
-					expression_result.value()->get_type().get_llvm_type(m_llvm_context->get_context()),
+					expression_result.value().get_type().get_llvm_type(m_llvm_context->get_context()),
 					1
 				)
 			);
 		}
 
 		// assert that the pointer is not nullptr
-		ASSERT(expression_result.value()->get_pointer() != nullptr, "pointer is nullptr");
+		ASSERT(expression_result.value().get_pointer() != nullptr, "pointer is nullptr");
 
 		m_llvm_context->get_builder().CreateStore(
 			decrement_result,
-			expression_result.value()->get_pointer()
+			expression_result.value().get_pointer()
 		);
 
 		return expression_result;
@@ -158,9 +158,9 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the expression
-		expected_value expression_result = node.get_expression_node()->accept(
-			*this,
+		// generate the expression
+		expected_value expression_result = generate_node(
+			node.get_expression_node(),
 			{}
 		);
 
@@ -169,48 +169,47 @@ namespace sigma {
 		}
 
 		// check if the expression is an integer or a floating-point value
-		if (!expression_result.value()->get_type().is_numerical()) {
+		if (!expression_result.value().get_type().is_numerical()) {
 			return std::unexpected(
 				error::emit<4102>(
 					std::move(node.get_declared_location()), 
-					expression_result.value()->get_type()
+					expression_result.value().get_type()
 				)
 			); // return on failure
 		}
 
 		// increment the expression
 		llvm::Value* increment_result;
-		if (expression_result.value()->get_type().is_floating_point()) {
+		if (expression_result.value().get_type().is_floating_point()) {
 			increment_result = m_llvm_context->get_builder().CreateFSub(
-				expression_result.value()->get_value(),
+				expression_result.value().get_value(),
 				llvm::ConstantFP::get(
-					expression_result.value()->get_type().get_llvm_type(m_llvm_context->get_context()), 
+					expression_result.value().get_type().get_llvm_type(m_llvm_context->get_context()), 
 					1.0
 				)
 			);
 		}
 		else {
 			increment_result = m_llvm_context->get_builder().CreateSub(
-				expression_result.value()->get_value(),
+				expression_result.value().get_value(),
 				llvm::ConstantInt::get(
-					expression_result.value()->get_type().get_llvm_type(m_llvm_context->get_context()),
+					expression_result.value().get_type().get_llvm_type(m_llvm_context->get_context()),
 					1
 				)
 			);
 		}
 
 		// assert that the pointer is not nullptr
-		ASSERT(expression_result.value()->get_pointer() != nullptr, "pointer is nullptr");
+		ASSERT(expression_result.value().get_pointer() != nullptr, "pointer is nullptr");
 
 		// store the decremented value back to memory
 		m_llvm_context->get_builder().CreateStore(
 			increment_result,
-			expression_result.value()->get_pointer()
+			expression_result.value().get_pointer()
 		);
 
-		return std::make_shared<value>(
-			"__pre_increment", 
-			expression_result.value()->get_type(),
+		return value(
+			expression_result.value().get_type(),
 			increment_result
 		);
 	}
@@ -220,9 +219,9 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the expression
-		expected_value expression_result = node.get_expression_node()->accept(
-			*this,
+		// generate the expression
+		expected_value expression_result = generate_node(
+			node.get_expression_node(),
 			{}
 		);
 
@@ -231,48 +230,47 @@ namespace sigma {
 		}
 
 		// check if the expression is an integer or a floating-point value
-		if (!expression_result.value()->get_type().is_numerical()) {
+		if (!expression_result.value().get_type().is_numerical()) {
 			return std::unexpected(
 				error::emit<4103>(
 					std::move(node.get_declared_location()), 
-					expression_result.value()->get_type()
+					expression_result.value().get_type()
 				)
 			); // return on failure
 		}
 
 		// increment the expression
 		llvm::Value* increment_result;
-		if (expression_result.value()->get_type().is_floating_point()) {
+		if (expression_result.value().get_type().is_floating_point()) {
 			increment_result = m_llvm_context->get_builder().CreateFAdd(
-				expression_result.value()->get_value(), 
+				expression_result.value().get_value(), 
 				llvm::ConstantFP::get(
-					expression_result.value()->get_type().get_llvm_type(m_llvm_context->get_context()),
+					expression_result.value().get_type().get_llvm_type(m_llvm_context->get_context()),
 					1.0
 				)
 			);
 		}
 		else {
 			increment_result = m_llvm_context->get_builder().CreateAdd(
-				expression_result.value()->get_value(),
+				expression_result.value().get_value(),
 				llvm::ConstantInt::get(
-					expression_result.value()->get_type().get_llvm_type(m_llvm_context->get_context()),
+					expression_result.value().get_type().get_llvm_type(m_llvm_context->get_context()),
 					1
 				)
 			);
 		}
 
 		// assert that the pointer is not nullptr
-		ASSERT(expression_result.value()->get_pointer() != nullptr, "pointer is nullptr");
+		ASSERT(expression_result.value().get_pointer() != nullptr, "pointer is nullptr");
 
 		// store the incremented value back to memory
 		m_llvm_context->get_builder().CreateStore(
 			increment_result,
-			expression_result.value()->get_pointer()
+			expression_result.value().get_pointer()
 		);
 
-		return std::make_shared<value>(
-			"__pre_increment", 
-			expression_result.value()->get_type(),
+		return value(
+			expression_result.value().get_type(),
 			increment_result
 		);
 	}
@@ -283,80 +281,16 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-
-		// accept the operand
-		expected_value operand_result = node.get_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!operand_result) {
-			return operand_result; // return on failure
-		}
-
-		// the expression must be integral
-		if (!operand_result.value()->get_type().is_integral()) {
-			return std::unexpected(
-				error::emit<4105>(
-					std::move(node.get_declared_location()),
-					operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a bitwise NOT operation
-		llvm::Value* not_result = m_llvm_context->get_builder().CreateNot(
-			operand_result.value()->get_value()
-		);
-
-		return std::make_shared<value>(
-			"__bitwise_not",
-			operand_result.value()->get_type(),
-			not_result
-		);
+		return generate_unary_operator(node);
 	}
 
 	// logical
 	expected_value basic_code_generator::visit_operator_not_node(
-		operator_not_node& node, 
+		operator_not_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-
-		// accept the operand
-		expected_value operand_result = node.get_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!operand_result) {
-			return operand_result; // return on failure
-		}
-
-		if(!operand_result.value()->get_type().is_numerical() && 
-			operand_result.value()->get_type().get_base() != type::base::boolean) {
-			return std::unexpected(
-				error::emit<4104>(
-					std::move(node.get_declared_location()),
-					operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a not operation (i.e., compare the operand with true and use the result)
-		llvm::Value* not_result = m_llvm_context->get_builder().CreateICmpEQ(
-			operand_result.value()->get_value(),
-			llvm::ConstantInt::get(
-				llvm::Type::getInt1Ty(m_llvm_context->get_context()),
-				0
-			)
-		);
-
-		return std::make_shared<value>(
-			"__logical_not",
-			type(type::base::boolean, 0),
-			not_result
-		);
+		return generate_unary_operator(node);
 	}
 
 	// binary
@@ -366,37 +300,7 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_add_operation(
-			node.get_left_expression_node(),
-			node.get_right_expression_node()
-		);
-
-		if(!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value,
-			highest_precision, 
-			left_operand_result
-		] = operation_result.value();
-
-		// create the assignment value
-		auto assignment_value = std::make_shared<value>(
-			"__add_assign",
-			highest_precision,
-			result_value
-		);
-
-		// store the result of the addition operation back into the variable
-		m_llvm_context->get_builder().CreateStore(
-			assignment_value->get_value(), 
-			left_operand_result.value()->get_pointer()
-		);
-
-		return assignment_value;
+		return generate_compound_assignment(node, node_kind::operator_addition);
 	}
 
 	expected_value basic_code_generator::visit_operator_addition_node(
@@ -404,28 +308,7 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_add_operation(
-			node.get_left_expression_node(), 
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value, 
-			highest_precision, 
-			left_operand_result
-		] = operation_result.value();
-
-		return std::make_shared<value>(
-			"__add",
-			highest_precision,
-			result_value
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_subtraction_assignment_node(
@@ -433,37 +316,7 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_sub_operation(
-			node.get_left_expression_node(), 
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value, 
-			highest_precision, 
-			left_operand_result
-		] = operation_result.value();
-
-		// create the assignment value
-		auto assignment_value = std::make_shared<value>(
-			"__sub_assign",
-			highest_precision,
-			result_value
-		);
-
-		// store the result of the subtraction operation back into the variable
-		m_llvm_context->get_builder().CreateStore(
-			assignment_value->get_value(),
-			left_operand_result.value()->get_pointer()
-		);
-
-		return assignment_value;
+		return generate_compound_assignment(node, node_kind::operator_subtraction);
 	}
 
 	expected_value basic_code_generator::visit_operator_subtraction_node(
@@ -471,66 +324,15 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_sub_operation(
-			node.get_left_expression_node(),
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value,
-			highest_precision, 
-			left_operand_result
-		] = operation_result.value();
-
-		return std::make_shared<value>(
-			"__sub",
-			highest_precision,
-			result_value
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_multiplication_assignment_node(
-		operator_multiplication_assignment_node& node, 
+		operator_multiplication_assignment_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_mul_operation(
-			node.get_left_expression_node(), 
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value,
-			highest_precision,
-			left_operand_result
-		] = operation_result.value();
-
-		// create the assignment value
-		auto assignment_value = std::make_shared<value>(
-			"__sub_assign",
-			highest_precision,
-			result_value
-		);
-
-		// store the result of the multiplication operation back into the variable
-		m_llvm_context->get_builder().CreateStore(
-			assignment_value->get_value(),
-			left_operand_result.value()->get_pointer()
-		);
-
-		return assignment_value;
+		return generate_compound_assignment(node, node_kind::operator_multiplication);
 	}
 
 	expected_value basic_code_generator::visit_operator_multiplication_node(
@@ -538,95 +340,23 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_mul_operation(
-			node.get_left_expression_node(), 
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value, 
-			highest_precision,
-			left_operand_result
-		] = operation_result.value();
-
-		return std::make_shared<value>(
-			"__mul",
-			highest_precision,
-			result_value
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_division_assignment_node(
-		operator_division_assignment_node& node, 
+		operator_division_assignment_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_div_operation(
-			node.get_left_expression_node(),
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value, 
-			highest_precision,
-			left_operand_result
-		] = operation_result.value();
-
-		// create the assignment value
-		auto assignment_value = std::make_shared<value>(
-			"__div_assign",
-			highest_precision,
-			result_value
-		);
-
-		// store the result of the division operation back into the variable
-		m_llvm_context->get_builder().CreateStore(
-			assignment_value->get_value(),
-			left_operand_result.value()->get_pointer()
-		);
-
-		return assignment_value;
+		return generate_compound_assignment(node, node_kind::operator_division);
 	}
 
 	expected_value basic_code_generator::visit_operator_division_node(
-		operator_division_node& node, 
+		operator_division_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_div_operation(
-			node.get_left_expression_node(),
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value,
-			highest_precision, 
-			left_operand_result
-		] = operation_result.value();
-
-		return std::make_shared<value>(
-			"__div",
-			highest_precision,
-			result_value
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_modulo_assignment_node(
@@ -634,37 +364,7 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_mod_operation(
-			node.get_left_expression_node(),
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value, 
-			highest_precision,
-			left_operand_result
-		] = operation_result.value();
-
-		// create the assignment value
-		auto assignment_value = std::make_shared<value>(
-			"__mod_assign",
-			highest_precision,
-			result_value
-		);
-
-		// store the result of the modulo operation back into the variable
-		m_llvm_context->get_builder().CreateStore(
-			assignment_value->get_value(),
-			left_operand_result.value()->get_pointer()
-		);
-
-		return assignment_value;
+		return generate_compound_assignment(node, node_kind::operator_modulo);
 	}
 
 	expected_value basic_code_generator::visit_operator_modulo_node(
@@ -672,79 +372,16 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		auto operation_result = create_mod_operation(
-			node.get_left_expression_node(),
-			node.get_right_expression_node()
-		);
-
-		if (!operation_result) {
-			return std::unexpected(
-				operation_result.error()
-			); // return on failure
-		}
-
-		const auto& [
-			result_value,
-			highest_precision,
-			left_operand_result
-		] = operation_result.value();
-
-		return std::make_shared<value>(
-			"__mod",
-			highest_precision,
-			result_value
-		);
+		return generate_binary_operator(node);
 	}
 
+	// bitwise
 	expected_value basic_code_generator::visit_operator_bitwise_and_node(
-		operator_bitwise_and_node& node, 
+		operator_bitwise_and_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// both expressions must be integral
-		if (!left_operand_result.value()->get_type().is_integral() ||
-			!right_operand_result.value()->get_type().is_integral()) {
-			return std::unexpected(
-				error::emit<4202>(
-					std::move(node.get_declared_location()),
-					left_operand_result.value()->get_type(),
-					right_operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a bitwise AND operation
-		llvm::Value* and_result = m_llvm_context->get_builder().CreateAnd(
-			left_operand_result.value()->get_value(),
-			right_operand_result.value()->get_value()
-		);
-
-		return std::make_shared<value>(
-			"__bitwise_and",
-			left_operand_result.value()->get_type(),
-			and_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_bitwise_or_node(
@@ -752,101 +389,15 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// both expressions must be integral
-		if (!left_operand_result.value()->get_type().is_integral() ||
-			!right_operand_result.value()->get_type().is_integral()) {
-			return std::unexpected(
-				error::emit<4203>(
-					std::move(node.get_declared_location()),
-					left_operand_result.value()->get_type(),
-					right_operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a bitwise OR operation
-		llvm::Value* and_result = m_llvm_context->get_builder().CreateOr(
-			left_operand_result.value()->get_value(),
-			right_operand_result.value()->get_value()
-		);
-
-		return std::make_shared<value>(
-			"__bitwise_or",
-			left_operand_result.value()->get_type(),
-			and_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_bitwise_left_shift_node(
-		operator_bitwise_left_shift_node& node, 
+		operator_bitwise_left_shift_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// both expressions must be integral
-		if (!left_operand_result.value()->get_type().is_integral() ||
-			!right_operand_result.value()->get_type().is_integral()) {
-			return std::unexpected(
-				error::emit<4204>(
-					std::move(node.get_declared_location()),
-					left_operand_result.value()->get_type(),
-					right_operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a bitwise left shift operation
-		llvm::Value* left_shift_result = m_llvm_context->get_builder().CreateShl(
-			left_operand_result.value()->get_value(),
-			right_operand_result.value()->get_value()
-		);
-
-		return std::make_shared<value>(
-			"__bitwise_left_shift",
-			left_operand_result.value()->get_type(),
-			left_shift_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_bitwise_right_shift_node(
@@ -854,102 +405,16 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
+		return generate_binary_operator(node);
+	}
 
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// both expressions must be integral
-		if (!left_operand_result.value()->get_type().is_integral() ||
-			!right_operand_result.value()->get_type().is_integral()) {
-			return std::unexpected(
-				error::emit<4205>(
-					std::move(node.get_declared_location()),
-					left_operand_result.value()->get_type(),
-					right_operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a bitwise right shift operation
-		llvm::Value* right_shift_result = m_llvm_context->get_builder().CreateLShr(
-			left_operand_result.value()->get_value(),
-			right_operand_result.value()->get_value()
-		);
-
-		return std::make_shared<value>(
-			"__bitwise_right_shift",
-			left_operand_result.value()->get_type(),
-			right_shift_result
-		);
-	}
-
-	expected_value basic_code_generator::visit_operator_bitwise_xor_node(
-		operator_bitwise_xor_node& node,
-		const code_generation_context& context
-	) {
-		(void)context; // suppress C4100
-
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// both expressions must be integral
-		if (!left_operand_result.value()->get_type().is_integral() ||
-			!right_operand_result.value()->get_type().is_integral()) {
-			return std::unexpected(
-				error::emit<4206>(
-					std::move(node.get_declared_location()),
-					left_operand_result.value()->get_type(),
-					right_operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a bitwise XOR operation
-		llvm::Value* xor_result = m_llvm_context->get_builder().CreateXor(
-			left_operand_result.value()->get_value(),
-			right_operand_result.value()->get_value()
-		);
-
-		return std::make_shared<value>(
-			"__bitwise_xor",
-			left_operand_result.value()->get_type(),
-			xor_result
-		);
-	}
+	expected_value basic_code_generator::visit_operator_bitwise_xor_node(
+		operator_bitwise_xor_node& node,
+		const code_generation_context& context
+	) {
+		(void)context; // suppress C4100
+		return generate_binary_operator(node);
+	}
 
 	// logical
 	expected_value basic_code_generator::visit_operator_logical_conjunction_node(
@@ -957,319 +422,39 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// both expressions must be boolean
-		if (left_operand_result.value()->get_type().get_base() != type::base::boolean || 
-			right_operand_result.value()->get_type().get_base() != type::base::boolean) {
-			return std::unexpected(
-				error::emit<4200>(
-					std::move(node.get_declared_location()),
-					left_operand_result.value()->get_type(),
-					right_operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a logical AND operation
-		llvm::Value* and_result = m_llvm_context->get_builder().CreateAnd(
-			left_operand_result.value()->get_value(),
-			right_operand_result.value()->get_value(),
-			"and"
-		);
-
-		return std::make_shared<value>(
-			"__logical_conjunction", 
-			type(type::base::boolean, 0),
-			and_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_logical_disjunction_node(
-		operator_disjunction_node& node, 
+		operator_disjunction_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this, 
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result;
-		}
-
-		// both expressions must be boolean
-		if (left_operand_result.value()->get_type().get_base() != type::base::boolean ||
-			right_operand_result.value()->get_type().get_base() != type::base::boolean) {
-			return std::unexpected(
-				error::emit<4201>(
-					std::move(node.get_declared_location()),
-					left_operand_result.value()->get_type(), 
-					right_operand_result.value()->get_type()
-				)
-			); // return on failure
-		}
-
-		// create a logical OR operation
-		llvm::Value* or_result = m_llvm_context->get_builder().CreateOr(
-			left_operand_result.value()->get_value(),
-			right_operand_result.value()->get_value()
-		);
-
-		return std::make_shared<value>(
-			"__logical_disjunction",
-			type(type::base::boolean, 0),
-			or_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_greater_than_node(
-		operator_greater_than_node& node, 
+		operator_greater_than_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// upcast both expressions
-		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
-		);
-
-		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(),
-			highest_precision,
-			node.get_declared_location()
-		);
-
-		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(), 
-			highest_precision, 
-			node.get_declared_location()
-		);
-
-		// create a greater than operation based on the highest_precision type
-		llvm::Value* greater_than_result;
-		if (highest_precision.is_floating_point()) {
-			greater_than_result = m_llvm_context->get_builder().CreateFCmpOGT(
-				left_value_upcasted,
-				right_value_upcasted
-			);
-		}
-		else {
-			if (highest_precision.is_unsigned()) {
-				greater_than_result = m_llvm_context->get_builder().CreateICmpUGT(
-					left_value_upcasted, 
-					right_value_upcasted
-				);
-			}
-			else {
-				greater_than_result = m_llvm_context->get_builder().CreateICmpSGT(
-					left_value_upcasted,
-					right_value_upcasted
-				);
-			}
-		}
-
-		return std::make_shared<value>(
-			"__greater_than",
-			type(type::base::boolean, 0),
-			greater_than_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_greater_than_equal_to_node(
-		operator_greater_than_equal_to_node& node, 
+		operator_greater_than_equal_to_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// upcast both expressions
-		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
-		);
-
-		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(),
-			highest_precision,
-			node.get_declared_location()
-		);
-
-		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(), 
-			highest_precision,
-			node.get_declared_location()
-		);
-
-		// create a greater than or equal to operation based on the highest_precision type
-		llvm::Value* greater_than_equal_result;
-		if (highest_precision.is_floating_point()) {
-			greater_than_equal_result = m_llvm_context->get_builder().CreateFCmpOGE(
-				left_value_upcasted, 
-				right_value_upcasted
-			);
-		}
-		else {
-			if (highest_precision.is_unsigned()) {
-				greater_than_equal_result = m_llvm_context->get_builder().CreateICmpUGE(
-					left_value_upcasted, 
-					right_value_upcasted
-				);
-			}
-			else {
-				greater_than_equal_result = m_llvm_context->get_builder().CreateICmpSGE(
-					left_value_upcasted, 
-					right_value_upcasted
-				);
-			}
-		}
-
-		return std::make_shared<value>(
-			"__greater_than_equal_to",
-			type(type::base::boolean, 0),
-			greater_than_equal_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_less_than_node(
-		operator_less_than_node& node, 
+		operator_less_than_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this, 
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// upcast both expressions
-		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
-		);
-
-		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(),
-			highest_precision,
-			node.get_declared_location()
-		);
-
-		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(), 
-			highest_precision,
-			node.get_declared_location()
-		);
-
-		// create a less than operation based on the highest_precision type
-		llvm::Value* less_than_result;
-		if (highest_precision.is_floating_point()) {
-			less_than_result = m_llvm_context->get_builder().CreateFCmpOLT(
-				left_value_upcasted, 
-				right_value_upcasted
-			);
-		}
-		else {
-			if (highest_precision.is_unsigned()) {
-				less_than_result = m_llvm_context->get_builder().CreateICmpULT(
-					left_value_upcasted,
-					right_value_upcasted
-				);
-			}
-			else {
-				less_than_result = m_llvm_context->get_builder().CreateICmpSLT(
-					left_value_upcasted,
-					right_value_upcasted
-				);
-			}
-		}
-
-		return std::make_shared<value>(
-			"__less_than",
-			type(type::base::boolean, 0),
-			less_than_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_less_than_equal_to_node(
@@ -1277,645 +462,690 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// upcast both expressions
-		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
-		);
-
-		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(),
-			highest_precision,
-			node.get_declared_location()
-		);
-
-		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(), 
-			highest_precision, 
-			node.get_declared_location()
-		);
-
-		// create a less than or equal to operation based on the highest_precision type
-		llvm::Value* less_than_equal_result;
-		if (highest_precision.is_floating_point()) {
-			less_than_equal_result = m_llvm_context->get_builder().CreateFCmpOLE(
-				left_value_upcasted,
-				right_value_upcasted
-			);
-		}
-		else {
-			if (highest_precision.is_unsigned()) {
-				less_than_equal_result = m_llvm_context->get_builder().CreateICmpULE(
-					left_value_upcasted,
-					right_value_upcasted
-				);
-			}
-			else {
-				less_than_equal_result = m_llvm_context->get_builder().CreateICmpSLE(
-					left_value_upcasted, 
-					right_value_upcasted
-				);
-			}
-		}
-
-		return std::make_shared<value>(
-			"__less_than_equal_to",
-			type(type::base::boolean, 0), 
-			less_than_equal_result
-		);
+		return generate_binary_operator(node);
 	}
 
 	expected_value basic_code_generator::visit_operator_equals_node(
-		operator_equals_node& node, 
+		operator_equals_node& node,
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this, 
-			{}
-		);
-
-		if (!left_operand_result) {
-			return left_operand_result; // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return right_operand_result; // return on failure
-		}
-
-		// upcast both expressions
-		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
-		);
+		return generate_binary_operator(node);
+	}
 
-		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(),
-			highest_precision,
-			node.get_declared_location()
-		);
+	expected_value basic_code_generator::visit_operator_not_equals_node(
+		operator_not_equals_node& node,
+		const code_generation_context& context
+	) {
+		(void)context; // suppress C4100
+		return generate_binary_operator(node);
+	}
 
-		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(),
-			highest_precision,
-			node.get_declared_location()
+	expected_value basic_code_generator::generate_unary_operator(
+		const operator_unary_base& node
+	) {
+		// generate the operand
+		expected_value operand_result = generate_node(
+			node.get_expression_node(),
+			{}
 		);
 
-		// create an equals operation based on the highest_precision type
-		llvm::Value* equals_result;
-		if (highest_precision.is_floating_point()) {
-			equals_result = m_llvm_context->get_builder().CreateFCmpOEQ(
-				left_value_upcasted, 
-				right_value_upcasted
-			);
-		}
-		else {
-			equals_result = m_llvm_context->get_builder().CreateICmpEQ(
-				left_value_upcasted, 
-				right_value_upcasted
-			);
+		if (!operand_result) {
+			return operand_result; // return on failure
 		}
 
-		return std::make_shared<value>(
-			"__equals", 
-			type(type::base::boolean, 0), 
-			equals_result
+		return create_unary_operation(
+			node.get_kind(),
+			operand_result.value(),
+			node.get_declared_location()
 		);
 	}
 
-	expected_value basic_code_generator::visit_operator_not_equals_node(
-		operator_not_equals_node& node, 
-		const code_generation_context& context
+	std::expected<std::pair<value, value>, error_msg> basic_code_generator::generate_binary_operands(
+		const operator_binary_base& node
 	) {
-		(void)context; // suppress C4100
-		// accept the left operand
-		expected_value left_operand_result = node.get_left_expression_node()->accept(
-			*this, 
+		// generate the left operand
+		expected_value left_operand_result = generate_node(
+			node.get_left_expression_node(),
 			{}
 		);
 
 		if (!left_operand_result) {
-			return left_operand_result; // return on failure
+			return std::unexpected(
+				left_operand_result.error()
+			); // return on failure
 		}
 
-		// accept the right operand
-		expected_value right_operand_result = node.get_right_expression_node()->accept(
-			*this, 
+		// generate the right operand
+		expected_value right_operand_result = generate_node(
+			node.get_right_expression_node(),
 			{}
 		);
 
 		if (!right_operand_result) {
-			return right_operand_result; // return on failure
+			return std::unexpected(
+				right_operand_result.error()
+			); // return on failure
 		}
 
-		// upcast both expressions
-		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
-		);
-
-		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(), 
-			highest_precision,
-			node.get_declared_location()
+		return std::make_pair(
+			left_operand_result.value(),
+			right_operand_result.value()
 		);
+	}
 
-		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(), 
-			highest_precision, 
-			node.get_declared_location()
-		);
+	expected_value basic_code_generator::generate_binary_operator(
+		const operator_binary_base& node
+	) {
+		const auto operands_result = generate_binary_operands(node);
 
-		// create a not equals operation based on the highest_precision type
-		llvm::Value* not_equals_result;
-		if (highest_precision.is_floating_point()) {
-			not_equals_result = m_llvm_context->get_builder().CreateFCmpONE(
-				left_value_upcasted, 
-				right_value_upcasted
-			);
-		}
-		else {
-			not_equals_result = m_llvm_context->get_builder().CreateICmpNE(
-				left_value_upcasted,
-				right_value_upcasted
-			);
+		if (!operands_result) {
+			return std::unexpected(
+				operands_result.error()
+			); // return on failure
 		}
 
-		return std::make_shared<value>(
-			"__not_equals", 
-			type(type::base::boolean, 0),
-			not_equals_result
+		const auto& [left_operand, right_operand] = operands_result.value();
+
+		return create_binary_operation(
+			node.get_kind(),
+			left_operand,
+			right_operand,
+			node.get_declared_location(),
+			node.get_left_expression_node()->get_declared_location(),
+			node.get_right_expression_node()->get_declared_location()
 		);
 	}
 
-	std::expected<std::tuple<
-		llvm::Value*,
-		type,
-		expected_value
-	>, error_msg> basic_code_generator::create_add_operation(
-		node* left_operand,
-		node* right_operand
+	expected_value basic_code_generator::generate_compound_assignment(
+		const operator_binary_base& node,
+		node_kind operation
 	) {
-		// accept the left operand (variable to be assigned to)
-		expected_value left_operand_result = left_operand->accept(
-			*this, 
-			{}
-		);
+		const auto operands_result = generate_binary_operands(node);
 
-		if (!left_operand_result) {
+		if (!operands_result) {
 			return std::unexpected(
-				left_operand_result.error()
+				operands_result.error()
 			); // return on failure
 		}
 
-		// accept the right operand
-		expected_value right_operand_result = right_operand->accept(
-			*this, 
-			{}
+		const auto& [left_operand, right_operand] = operands_result.value();
+
+		expected_value operation_result = create_binary_operation(
+			operation,
+			left_operand,
+			right_operand,
+			node.get_declared_location(),
+			node.get_left_expression_node()->get_declared_location(),
+			node.get_right_expression_node()->get_declared_location()
 		);
 
-		if (!right_operand_result) {
+		if (!operation_result) {
+			return operation_result; // return on failure
+		}
+
+		// store the result of the operation back into the variable
+		m_llvm_context->get_builder().CreateStore(
+			operation_result.value().get_value(),
+			left_operand.get_pointer()
+		);
+
+		return operation_result;
+	}
+
+	expected_value basic_code_generator::create_unary_operation(
+		node_kind operation,
+		const value& operand,
+		const file_position& location
+	) {
+		if (operation == node_kind::operator_bitwise_not) {
+			// the expression must be integral
+			if (!operand.get_type().is_integral()) {
+				return std::unexpected(
+					error::emit<4105>(
+						location,
+						operand.get_type()
+					)
+				); // return on failure
+			}
+
+			// create a bitwise NOT operation
+			return value(
+				operand.get_type(),
+				m_llvm_context->get_builder().CreateNot(operand.get_value())
+			);
+		}
+
+		if (!operand.get_type().is_numerical() && operand.get_type().get_base() != type::base::boolean) {
 			return std::unexpected(
-				right_operand_result.error()
+				error::emit<4104>(
+					location,
+					operand.get_type()
+				)
 			); // return on failure
 		}
 
+		// create a not operation (i.e., compare the operand with true and use the result)
+		llvm::Value* not_result = m_llvm_context->get_builder().CreateICmpEQ(
+			operand.get_value(),
+			llvm::ConstantInt::get(
+				llvm::Type::getInt1Ty(m_llvm_context->get_context()),
+				0
+			)
+		);
+
+		return value(
+			type(type::base::boolean, 0),
+			not_result
+		);
+	}
+
+	expected_value basic_code_generator::create_binary_operation(
+		node_kind operation,
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& location,
+		const file_position& left_operand_location,
+		const file_position& right_operand_location
+	) {
+		switch (operation) {
+		// arithmetic
+		case node_kind::operator_addition:
+			return create_add_operation(left_operand, right_operand, left_operand_location, right_operand_location);
+		case node_kind::operator_subtraction:
+			return create_sub_operation(left_operand, right_operand, left_operand_location, right_operand_location);
+		case node_kind::operator_multiplication:
+			return create_mul_operation(left_operand, right_operand, left_operand_location, right_operand_location);
+		case node_kind::operator_division:
+			return create_div_operation(left_operand, right_operand, left_operand_location, right_operand_location);
+		case node_kind::operator_modulo:
+			return create_mod_operation(left_operand, right_operand, left_operand_location, right_operand_location);
+		// bitwise
+		case node_kind::operator_bitwise_and:
+		case node_kind::operator_bitwise_or:
+		case node_kind::operator_bitwise_left_shift:
+		case node_kind::operator_bitwise_right_shift:
+		case node_kind::operator_bitwise_xor:
+			return create_bitwise_operation(operation, left_operand, right_operand, location);
+		// logical
+		case node_kind::operator_conjunction:
+		case node_kind::operator_disjunction:
+			return create_logical_operation(operation, left_operand, right_operand, location);
+		case node_kind::operator_greater_than:
+		case node_kind::operator_greater_than_equal_to:
+		case node_kind::operator_less_than:
+		case node_kind::operator_less_than_equal_to:
+		case node_kind::operator_equals:
+		case node_kind::operator_not_equals:
+			return create_comparison_operation(operation, left_operand, right_operand, location);
+		default:
+			break;
+		}
+
+		std::unreachable();
+	}
+
+	value basic_code_generator::create_add_operation(
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& left_operand_location,
+		const file_position& right_operand_location
+	) {
 		// upcast both expressions
 		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
+			left_operand.get_type(),
+			right_operand.get_type()
 		);
 
 		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(), 
-			highest_precision, 
-			left_operand->get_declared_location()
+			left_operand,
+			highest_precision,
+			left_operand_location
 		);
 
 		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(),
-			highest_precision, 
-			right_operand->get_declared_location()
+			right_operand,
+			highest_precision,
+			right_operand_location
 		);
 
 		// both types are floating point
 		if (highest_precision.is_floating_point()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateFAdd(
 					left_value_upcasted,
 					right_value_upcasted,
 					"fadd"
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// both types are unsigned
 		if (highest_precision.is_unsigned()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateAdd(
 					left_value_upcasted,
 					right_value_upcasted,
 					"uadd",
 					true
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// fallback to regular op
-		return std::make_tuple(
+		return value(
+			highest_precision,
 			m_llvm_context->get_builder().CreateAdd(
 				left_value_upcasted,
 				right_value_upcasted,
 				"add"
-			), 
-			highest_precision,
-			left_operand_result
+			)
 		);
 	}
 
-	std::expected<std::tuple<
-		llvm::Value*,
-		type,
-		expected_value
-	>, error_msg> basic_code_generator::create_sub_operation(
-		node* left_operand, 
-		node* right_operand
+	value basic_code_generator::create_sub_operation(
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& left_operand_location,
+		const file_position& right_operand_location
 	) {
-		// accept the left operand (variable to be assigned to)
-		expected_value left_operand_result = left_operand->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return std::unexpected(
-				left_operand_result.error()
-			); // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = right_operand->accept(
-			*this, 
-			{}
-		);
-
-		if (!right_operand_result) {
-			return std::unexpected(
-				right_operand_result.error()
-			); // return on failure
-		}
-
 		// upcast both expressions
 		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
+			left_operand.get_type(),
+			right_operand.get_type()
 		);
 
 		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(), 
-			highest_precision, 
-			left_operand->get_declared_location()
+			left_operand,
+			highest_precision,
+			left_operand_location
 		);
 
 		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(),
-			highest_precision, 
-			right_operand->get_declared_location()
+			right_operand,
+			highest_precision,
+			right_operand_location
 		);
 
 		// both types are floating point
 		if (highest_precision.is_floating_point()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateFSub(
 					left_value_upcasted,
 					right_value_upcasted,
 					"fsub"
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// both types are unsigned
 		if (highest_precision.is_unsigned()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateSub(
 					left_value_upcasted,
 					right_value_upcasted,
 					"usub",
 					true
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// fallback to regular op
-		return std::make_tuple(
+		return value(
+			highest_precision,
 			m_llvm_context->get_builder().CreateSub(
 				left_value_upcasted,
 				right_value_upcasted,
 				"sub"
-			),
-			highest_precision,
-			left_operand_result
+			)
 		);
 	}
 
-	std::expected<std::tuple<
-		llvm::Value*,
-		type,
-		expected_value
-	>, error_msg> basic_code_generator::create_mul_operation(
-		node* left_operand,
-		node* right_operand
+	value basic_code_generator::create_mul_operation(
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& left_operand_location,
+		const file_position& right_operand_location
 	) {
-		// accept the left operand (variable to be assigned to)
-		expected_value left_operand_result = left_operand->accept(
-			*this, 
-			{}
-		);
-
-		if (!left_operand_result) {
-			return std::unexpected(
-				left_operand_result.error()
-			); // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = right_operand->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return std::unexpected(
-				right_operand_result.error()
-			); // return on failure
-		}
-
 		// upcast both expressions
 		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
+			left_operand.get_type(),
+			right_operand.get_type()
 		);
 
 		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(), 
+			left_operand,
 			highest_precision,
-			left_operand->get_declared_location()
+			left_operand_location
 		);
 
 		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(), 
+			right_operand,
 			highest_precision,
-			right_operand->get_declared_location()
+			right_operand_location
 		);
 
 		// both types are floating point
 		if (highest_precision.is_floating_point()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateFMul(
 					left_value_upcasted,
 					right_value_upcasted,
 					"fmul"
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// both types are unsigned
 		if (highest_precision.is_unsigned()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateMul(
 					left_value_upcasted,
 					right_value_upcasted,
 					"umul",
 					true
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// fallback to regular op
-		return std::make_tuple(
+		return value(
+			highest_precision,
 			m_llvm_context->get_builder().CreateMul(
 				left_value_upcasted,
 				right_value_upcasted,
 				"mul"
-			),
-			highest_precision,
-			left_operand_result
+			)
 		);
 	}
 
-	std::expected<std::tuple<
-		llvm::Value*,
-		type,
-		expected_value
-	>, error_msg> basic_code_generator::create_div_operation(
-		node* left_operand,
-		node* right_operand
+	value basic_code_generator::create_div_operation(
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& left_operand_location,
+		const file_position& right_operand_location
 	) {
-		// accept the left operand (variable to be assigned to)
-		expected_value left_operand_result = left_operand->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return std::unexpected(
-				left_operand_result.error()
-			); // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = right_operand->accept(
-			*this, 
-			{}
-		);
-
-		if (!right_operand_result) {
-			return std::unexpected(
-				right_operand_result.error()
-			); // return on failure
-		}
-
 		// upcast both expressions
 		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(),
-			right_operand_result.value()->get_type()
+			left_operand.get_type(),
+			right_operand.get_type()
 		);
 
 		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(),
+			left_operand,
 			highest_precision,
-			left_operand->get_declared_location()
+			left_operand_location
 		);
 
 		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(),
+			right_operand,
 			highest_precision,
-			right_operand->get_declared_location()
+			right_operand_location
 		);
 
 		// both types are floating point
 		if (highest_precision.is_floating_point()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateFDiv(
 					left_value_upcasted,
 					right_value_upcasted,
 					"fdiv"
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// both types are unsigned
 		if (highest_precision.is_unsigned()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateUDiv(
 					left_value_upcasted,
 					right_value_upcasted,
 					"udiv",
 					true
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// fallback to regular op
-		return std::make_tuple(
+		return value(
+			highest_precision,
 			m_llvm_context->get_builder().CreateSDiv(
 				left_value_upcasted,
 				right_value_upcasted,
 				"sdiv"
-			),
-			highest_precision,
-			left_operand_result
+			)
 		);
 	}
 
-	std::expected<std::tuple<
-		llvm::Value*,
-		type,
-		expected_value
-	>, error_msg> basic_code_generator::create_mod_operation(
-		node* left_operand, 
-		node* right_operand
+	value basic_code_generator::create_mod_operation(
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& left_operand_location,
+		const file_position& right_operand_location
 	) {
-		// accept the left operand (variable to be assigned to)
-		expected_value left_operand_result = left_operand->accept(
-			*this,
-			{}
-		);
-
-		if (!left_operand_result) {
-			return std::unexpected(
-				left_operand_result.error()
-			); // return on failure
-		}
-
-		// accept the right operand
-		expected_value right_operand_result = right_operand->accept(
-			*this,
-			{}
-		);
-
-		if (!right_operand_result) {
-			return std::unexpected(
-				right_operand_result.error()
-			); // return on failure
-		}
-
 		// upcast both expressions
 		const type highest_precision = get_highest_precision_type(
-			left_operand_result.value()->get_type(), 
-			right_operand_result.value()->get_type()
+			left_operand.get_type(),
+			right_operand.get_type()
 		);
 
 		llvm::Value* left_value_upcasted = cast_value(
-			left_operand_result.value(), 
+			left_operand,
 			highest_precision,
-			left_operand->get_declared_location()
+			left_operand_location
 		);
 
 		llvm::Value* right_value_upcasted = cast_value(
-			right_operand_result.value(),
-			highest_precision, 
-			right_operand->get_declared_location()
+			right_operand,
+			highest_precision,
+			right_operand_location
 		);
 
 		// both types are floating point
 		if (highest_precision.is_floating_point()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateFRem(
 					left_value_upcasted,
 					right_value_upcasted,
 					"fmod"
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// both types are unsigned
 		if (highest_precision.is_unsigned()) {
-			return std::make_tuple(
+			return value(
+				highest_precision,
 				m_llvm_context->get_builder().CreateURem(
 					left_value_upcasted,
 					right_value_upcasted,
 					"umod"
-				),
-				highest_precision,
-				left_operand_result
+				)
 			);
 		}
 
 		// fallback to regular op
-		return std::make_tuple(
+		return value(
+			highest_precision,
 			m_llvm_context->get_builder().CreateSRem(
 				left_value_upcasted,
 				right_value_upcasted,
 				"smod"
-			),
+			)
+		);
+	}
+
+	expected_value basic_code_generator::create_bitwise_operation(
+		node_kind operation,
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& location
+	) {
+		// both expressions must be integral
+		if (!left_operand.get_type().is_integral() || !right_operand.get_type().is_integral()) {
+			switch (operation) {
+			case node_kind::operator_bitwise_and:
+				return std::unexpected(
+					error::emit<4202>(location, left_operand.get_type(), right_operand.get_type())
+				); // return on failure
+			case node_kind::operator_bitwise_or:
+				return std::unexpected(
+					error::emit<4203>(location, left_operand.get_type(), right_operand.get_type())
+				); // return on failure
+			case node_kind::operator_bitwise_left_shift:
+				return std::unexpected(
+					error::emit<4204>(location, left_operand.get_type(), right_operand.get_type())
+				); // return on failure
+			case node_kind::operator_bitwise_right_shift:
+				return std::unexpected(
+					error::emit<4205>(location, left_operand.get_type(), right_operand.get_type())
+				); // return on failure
+			default:
+				return std::unexpected(
+					error::emit<4206>(location, left_operand.get_type(), right_operand.get_type())
+				); // return on failure
+			}
+		}
+
+		llvm::Value* bitwise_result;
+		switch (operation) {
+		case node_kind::operator_bitwise_and:
+			bitwise_result = m_llvm_context->get_builder().CreateAnd(
+				left_operand.get_value(),
+				right_operand.get_value()
+			);
+			break;
+		case node_kind::operator_bitwise_or:
+			bitwise_result = m_llvm_context->get_builder().CreateOr(
+				left_operand.get_value(),
+				right_operand.get_value()
+			);
+			break;
+		case node_kind::operator_bitwise_left_shift:
+			bitwise_result = m_llvm_context->get_builder().CreateShl(
+				left_operand.get_value(),
+				right_operand.get_value()
+			);
+			break;
+		case node_kind::operator_bitwise_right_shift:
+			bitwise_result = m_llvm_context->get_builder().CreateLShr(
+				left_operand.get_value(),
+				right_operand.get_value()
+			);
+			break;
+		default:
+			bitwise_result = m_llvm_context->get_builder().CreateXor(
+				left_operand.get_value(),
+				right_operand.get_value()
+			);
+			break;
+		}
+
+		return value(
+			left_operand.get_type(),
+			bitwise_result
+		);
+	}
+
+	expected_value basic_code_generator::create_logical_operation(
+		node_kind operation,
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& location
+	) {
+		const bool is_conjunction = operation == node_kind::operator_conjunction;
+
+		// both expressions must be boolean
+		if (left_operand.get_type().get_base() != type::base::boolean ||
+			right_operand.get_type().get_base() != type::base::boolean) {
+			if (is_conjunction) {
+				return std::unexpected(
+					error::emit<4200>(location, left_operand.get_type(), right_operand.get_type())
+				); // return on failure
+			}
+
+			return std::unexpected(
+				error::emit<4201>(location, left_operand.get_type(), right_operand.get_type())
+			); // return on failure
+		}
+
+		// create a logical AND or OR operation
+		llvm::Value* logical_result = is_conjunction
+			? m_llvm_context->get_builder().CreateAnd(left_operand.get_value(), right_operand.get_value(), "and")
+			: m_llvm_context->get_builder().CreateOr(left_operand.get_value(), right_operand.get_value());
+
+		return value(
+			type(type::base::boolean, 0),
+			logical_result
+		);
+	}
+
+	expected_value basic_code_generator::create_comparison_operation(
+		node_kind operation,
+		const value& left_operand,
+		const value& right_operand,
+		const file_position& location
+	) {
+		// upcast both expressions
+		const type highest_precision = get_highest_precision_type(
+			left_operand.get_type(),
+			right_operand.get_type()
+		);
+
+		llvm::Value* left_value_upcasted = cast_value(
+			left_operand,
 			highest_precision,
-			left_operand_result
+			location
+		);
+
+		llvm::Value* right_value_upcasted = cast_value(
+			right_operand,
+			highest_precision,
+			location
+		);
+
+		// select the comparison based on the highest_precision type
+		const bool is_floating_point = highest_precision.is_floating_point();
+		const bool is_unsigned = highest_precision.is_unsigned();
+		llvm::CmpInst::Predicate predicate;
+
+		switch (operation) {
+		case node_kind::operator_greater_than:
+			predicate = is_floating_point ? llvm::CmpInst::FCMP_OGT : is_unsigned ? llvm::CmpInst::ICMP_UGT : llvm::CmpInst::ICMP_SGT;
+			break;
+		case node_kind::operator_greater_than_equal_to:
+			predicate = is_floating_point ? llvm::CmpInst::FCMP_OGE : is_unsigned ? llvm::CmpInst::ICMP_UGE : llvm::CmpInst::ICMP_SGE;
+			break;
+		case node_kind::operator_less_than:
+			predicate = is_floating_point ? llvm::CmpInst::FCMP_OLT : is_unsigned ? llvm::CmpInst::ICMP_ULT : llvm::CmpInst::ICMP_SLT;
+			break;
+		case node_kind::operator_less_than_equal_to:
+			predicate = is_floating_point ? llvm::CmpInst::FCMP_OLE : is_unsigned ? llvm::CmpInst::ICMP_ULE : llvm::CmpInst::ICMP_SLE;
+			break;
+		case node_kind::operator_equals:
+			predicate = is_floating_point ? llvm::CmpInst::FCMP_OEQ : llvm::CmpInst::ICMP_EQ;
+			break;
+		default:
+			predicate = is_floating_point ? llvm::CmpInst::FCMP_ONE : llvm::CmpInst::ICMP_NE;
+			break;
+		}
+
+		return value(
+			type(type::base::boolean, 0),
+			m_llvm_context->get_builder().CreateCmp(
+				predicate,
+				left_value_upcasted,
+				right_value_upcasted
+			)
 		);
 	}
 }
@@ -4,6 +4,7 @@
 #include "code_generator/abstract_syntax_tree/keywords/types/string_node.h"
 #include "code_generator/abstract_syntax_tree/keywords/types/bool_node.h"
 #include "code_generator/abstract_syntax_tree/keywords/types/numerical_literal_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/constant_node.h"
 
 namespace sigma {
 	expected_value basic_code_generator::visit_numerical_literal_node(
@@ -24,106 +25,96 @@ namespace sigma {
 		switch (literal_type.get_base()) {
 			// signed integers
 		case type::base::i8:
-			return std::make_shared<value>(
-				"__i8", 
+			return value(
 				type(type::base::i8, 0), 
 				llvm::ConstantInt::get(
 					m_llvm_context->get_context(),
-					llvm::APInt(8, std::stoll(node.get_value()), true)
+					llvm::APInt(8, node.get_integer_value(), true)
 				)
 			);
 		case type::base::i16:
-			return std::make_shared<value>(
-				"__i16", 
+			return value(
 				type(type::base::i16, 0),
 				llvm::ConstantInt::get(
 					m_llvm_context->get_context(), 
-					llvm::APInt(16, std::stoll(node.get_value()), true)
+					llvm::APInt(16, node.get_integer_value(), true)
 				)
 			);
 		case type::base::i32:
-			return std::make_shared<value>(
-				"__i32", 
+			return value(
 				type(type::base::i32, 0), 
 				llvm::ConstantInt::get(
 					m_llvm_context->get_context(), 
-					llvm::APInt(32, std::stoll(node.get_value()), true)
+					llvm::APInt(32, node.get_integer_value(), true)
 				)
 			);
 		case type::base::i64:
-			return std::make_shared<value>(
-				"__i64", 
+			return value(
 				type(type::base::i64, 0), 
 				llvm::ConstantInt::get(
 					m_llvm_context->get_context(),
-					llvm::APInt(64, std::stoll(node.get_value()), true)
+					llvm::APInt(64, node.get_integer_value(), true)
 				)
 			);
 			// unsigned integers
 		case type::base::u8:
-			return std::make_shared<value>(
-				"__u8",
+			return value(
 				type(type::base::u8, 0),
 				llvm::ConstantInt::get(
 					m_llvm_context->get_context(), 
-					llvm::APInt(8, std::stoull(node.get_value()), false)
+					llvm::APInt(8, node.get_integer_value(), false)
 				)
 			);
 		case type::base::u16:
-			return std::make_shared<value>(
-				"__u16", 
+			return value(
 				type(type::base::u16, 0), 
 				llvm::ConstantInt::get(
 					m_llvm_context->get_context(),
-					llvm::APInt(16, std::stoull(node.get_value()), false)
+					llvm::APInt(16, node.get_integer_value(), false)
 				)
 			);
 		case type::base::u32:
-			return std::make_shared<value>(
-				"__u32", 
+			return value(
 				type(type::base::u32, 0),
 				llvm::ConstantInt::get(
 					m_llvm_context->get_context(),
-					llvm::APInt(32, std::stoull(node.get_value()), false)
+					llvm::APInt(32, node.get_integer_value(), false)
 				)
 			);
 		case type::base::u64:
-			return std::make_shared<value>(
-				"__u64",
+			return value(
 				type(type::base::u64, 0),
 				llvm::ConstantInt::get(
 					m_llvm_context->get_context(),
-					llvm::APInt(64, std::stoull(node.get_value()), false)
+					llvm::APInt(64, node.get_integer_value(), false)
 				)
 			);
 			// floating point
 		case type::base::f32:
-			return std::make_shared<value>(
-				"__f32",
+			return value(
 				type(type::base::f32, 0),
 				llvm::ConstantFP::get(
 					m_llvm_context->get_context(),
-					llvm::APFloat(std::stof(node.get_value()))
+					llvm::APFloat(node.get_f32_value())
 				)
 			);
 		case type::base::f64:
-			return std::make_shared<value>(
-				"__f64",
+			return value(
 				type(type::base::f64, 0),
 				llvm::ConstantFP::get(
 					m_llvm_context->get_context(), 
-					llvm::APFloat(std::stod(node.get_value()))
+					llvm::APFloat(node.get_f64_value())
 				)
 			);
 			// boolean
 		case type::base::boolean:
 			return create_boolean(
-				std::stoi(node.get_value())
+				node.get_integer_value() != 0
 			);
 		case type::base::character:
 			return create_character(
 				static_cast<char>(
-					std::stoi(node.get_value())
+					node.get_integer_value()
 				)
 			);
 		default:
@@ -171,8 +162,7 @@ namespace sigma {
 			type(type::base::character, 1).get_llvm_type(m_llvm_context->get_context())
 		);
 
-		return std::make_shared<value>(
-			"__string", 
+		return value(
 			type(type::base::character, 1), 
 			string_literal_ptr
 		);
@@ -194,9 +184,47 @@ namespace sigma {
 		return create_boolean(node.get_value());
 	}
 
-	value_ptr basic_code_generator::create_boolean(bool val) {
-		return std::make_shared<value>(
-			"__bool",
+	expected_value basic_code_generator::visit_constant_node(
+		constant_node& node,
+		const code_generation_context& context
+	) {
+		(void)context; // suppress C4100
+		return create_constant(
+			node.get_value(),
+			node.get_implicit_casts()
+		);
+	}
+
+	value basic_code_generator::create_constant(
+		const constant& constant_value,
+		std::span<const implicit_cast> implicit_casts
+	) {
+		// the operands of folded operators have been cast at compile time, report the casts now
+		for (const implicit_cast& cast : implicit_casts) {
+			warning::emit<3002>(cast.location, cast.source_type, cast.target_type)->print();
+		}
+
+		if (constant_value.value_type.is_floating_point()) {
+			return value(
+				constant_value.value_type,
+				llvm::ConstantFP::get(
+					m_llvm_context->get_context(),
+					constant_value.floating_point
+				)
+			);
+		}
+
+		return value(
+			constant_value.value_type,
+			llvm::ConstantInt::get(
+				m_llvm_context->get_context(),
+				constant_value.integer
+			)
+		);
+	}
+
+	value basic_code_generator::create_boolean(bool val) {
+		return value(
 			type(type::base::boolean, 0),
 			llvm::ConstantInt::get(
 				m_llvm_context->get_context(),
@@ -205,9 +233,8 @@ namespace sigma {
 		);
 	}
 
-	value_ptr basic_code_generator::create_character(char val) {
-		return std::make_shared<value>(
-			"__char",
+	value basic_code_generator::create_character(char val) {
+		return value(
 			type(type::base::character, 0),
 			llvm::ConstantInt::get(
 				m_llvm_context->get_context(),
@@ -17,8 +17,8 @@ namespace sigma {
 		(void)context; // suppress C4100
 		// assignment to a local variable
 		// look up the local variable in the active scope
-		expected_value variable_result = node.get_variable_node()->accept(
-			*this, 
+		expected_value variable_result = generate_node(
+			node.get_variable_node(),
 			{}
 		);
 
@@ -27,27 +27,27 @@ namespace sigma {
 		}
 
 		// evaluate the expression on the right-hand side of the assignment
-		expected_value expression_result = node.get_expression_node()->accept(
-			*this, 
-			code_generation_context(variable_result.value()->get_type())
+		expected_value expression_result = generate_node(
+			node.get_expression_node(),
+			code_generation_context(variable_result.value().get_type())
 		);
 
 		if (!expression_result.has_value()) {
 			return expression_result; // return on failure
 		}
 
-		value_ptr expression_value = expression_result.value();
+		value expression_value = expression_result.value();
 		llvm::Value* out_cast = cast_value(
 			expression_value, 
-			variable_result.value()->get_type(), 
+			variable_result.value().get_type(), 
 			node.get_declared_location()
 		);
 
-		expression_value->set_value(out_cast);
+		expression_value.set_value(out_cast);
 
 		m_llvm_context->get_builder().CreateStore(
-			expression_value->get_value(), 
-			variable_result.value()->get_value()
+			expression_value.get_value(), 
+			variable_result.value().get_value()
 		);
 
 		return expression_value;
@@ -58,61 +58,9 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// load a local variable
-		// look up the local variable in the active scope
-		if (const value_ptr variable_value = m_scope->get_named_value(
-			node.get_variable_identifier())) {
-			// load the value from the memory location
-			llvm::AllocaInst* alloca = llvm::dyn_cast<llvm::AllocaInst>(
-				variable_value->get_value()
-			);
-
-			llvm::Value* load = m_llvm_context->get_builder().CreateLoad(
-				alloca->getAllocatedType(),
-				variable_value->get_value()
-			);
-
-			// return the load instruction as a value
-			value_ptr variable_load = std::make_shared<value>(
-				node.get_variable_identifier(), 
-				variable_value->get_type(), 
-				load
-			);
-
-			variable_load->set_pointer(alloca);
-			return variable_load;
-		}
-
-		// we haven't found a local variable, check if we're loading a global one
-		// load a global variable
-		// look up the global variable in the m_global_named_values map
-		const value_ptr global_variable = m_global_named_values[node.get_variable_identifier()];
-		// check if the global variable exists
-		if (!global_variable) {
-			return std::unexpected(
-				error::emit<4003>(
-					std::move(node.get_declared_location()), 
-					node.get_variable_identifier()
-				)
-			); // return on failure
-		}
-
-		// get the value from the global variable pointer
-		const llvm::GlobalValue* global_variable_value = llvm::dyn_cast<llvm::GlobalValue>(
-			global_variable->get_value()
-		);
-
-		// load the value from the memory location
-		llvm::Value* load = m_llvm_context->get_builder().CreateLoad(
-			global_variable_value->getValueType(),
-			global_variable->get_value()
-		);
-
-		// return the load instruction as a value
-		return std::make_shared<value>(
+		return load_variable(
 			node.get_variable_identifier(),
-			global_variable->get_type(),
-			load
+			node.get_declared_location()
 		);
 	}
 
@@ -137,31 +85,30 @@ namespace sigma {
 		);
 
 		// check if the variable already exists as a global
-		if (m_global_named_values[node.get_declaration_identifier()]) {
+		if (m_global_named_values.contains(node.get_declaration_identifier())) {
 			return std::unexpected(
 				error::emit<4004>(
 					std::move(node.get_declared_location()),
-					node.get_declaration_identifier()
+					node.get_declaration_identifier().get_name()
 				)
 			);
 		}
 
 		// add the variable to the active scope
-		const auto insertion_result = m_scope->add_named_value(
+		const bool inserted = m_scope.add_named_value(
 			node.get_declaration_identifier(), 
-			std::make_shared<value>(
-				node.get_declaration_identifier(), 
+			value(
 				node.get_declaration_type(),
 				alloca
 			)
 		);
 
 		// check if the active scope already contains the variable
-		if (!insertion_result.second) {
+		if (!inserted) {
 			return std::unexpected(
 				error::emit<4005>(
 					std::move(node.get_declared_location()),
-					node.get_declaration_identifier()
+					node.get_declaration_identifier().get_name()
 				)
 			); // return on failure
 		}
@@ -179,7 +126,7 @@ namespace sigma {
 			return declaration_value_result; // return on failure
 		}
 
-		value_ptr declaration_value = declaration_value_result.value();
+		value declaration_value = declaration_value_result.value();
 		llvm::Value* cast_assigned_value = cast_value(
 			declaration_value,
 			node.get_declaration_type(),
@@ -187,7 +134,7 @@ namespace sigma {
 		);
 
 		m_llvm_context->get_builder().CreateStore(cast_assigned_value, alloca);
-		declaration_value->set_pointer(alloca);
+		declaration_value.set_pointer(alloca);
 		m_llvm_context->get_builder().SetInsertPoint(original_entry_block);
 		return declaration_value;
 	}
@@ -197,27 +144,25 @@ namespace sigma {
 		const code_generation_context& context
 	) {
 		(void)context; // suppress C4100
-		// start creating the init function for our global ctor
-		const std::string init_func_name = "__global_init_" + node.get_declaration_identifier();
-		llvm::FunctionType* init_func_type = llvm::FunctionType::get(
-			llvm::Type::getVoidTy(m_llvm_context->get_context()),
-			false
-		);
-
-		llvm::Function* init_func = llvm::Function::Create(
-			init_func_type,
-			llvm::Function::InternalLinkage,
-			init_func_name, 
-			m_llvm_context->get_module().get()
-		);
+		// every dynamic initializer of the module is written into a single init function
+		if (m_global_initialization_function == nullptr) {
+			m_global_initialization_function = llvm::Function::Create(
+				llvm::FunctionType::get(llvm::Type::getVoidTy(m_llvm_context->get_context()), false),
+				llvm::Function::InternalLinkage,
+				"__global_init",
+				m_llvm_context->get_module()
+			);
 
-		llvm::BasicBlock* init_func_entry = llvm::BasicBlock::Create(
-			m_llvm_context->get_context(), 
-			"", 
-			init_func
-		);
+			llvm::BasicBlock::Create(
+				m_llvm_context->get_context(),
+				"",
+				m_global_initialization_function
+			);
+		}
 
-		m_llvm_context->get_builder().SetInsertPoint(init_func_entry); // write to the init function
+		m_llvm_context->get_builder().SetInsertPoint(
+			&m_global_initialization_function->getEntryBlock()
+		); // append to the init function
 
 		// evaluate the assigned value, if there is one
 		expected_value declaration_value_result = get_declaration_value(
@@ -236,19 +181,23 @@ namespace sigma {
 			node.get_declared_location()
 		);
 
+		// the builder folds operations on constants, values which are still constant can be used as the
+		// initializer of the global directly
+		llvm::Type* global_type = node.get_declaration_type().get_llvm_type(m_llvm_context->get_context());
+		auto* static_initializer = llvm::dyn_cast<llvm::Constant>(cast_assigned_value);
+
 		// create a global variable
-		value_ptr global_declaration = std::make_shared<value>(
-			node.get_declaration_identifier(),
+		auto* global_variable = new llvm::GlobalVariable(*m_llvm_context->get_module(),
+			global_type,
+			false,
+			llvm::GlobalValue::ExternalLinkage,
+			static_initializer ? static_initializer : llvm::Constant::getNullValue(global_type),
+			node.get_declaration_identifier().get_name()
+		);
+
+		value global_declaration(
 			node.get_declaration_type(),
-			new llvm::GlobalVariable(*m_llvm_context->get_module(),
-				node.get_declaration_type().get_llvm_type(m_llvm_context->get_context()),
-				false,
-				llvm::GlobalValue::ExternalLinkage,
-				llvm::Constant::getNullValue(
-					node.get_declaration_type().get_llvm_type(m_llvm_context->get_context())
-				), // default initializer
-				node.get_declaration_identifier()
-			)
+			global_variable
 		);
 
 		// add the variable to the m_global_named_values map
@@ -262,41 +211,23 @@ namespace sigma {
 			return std::unexpected(
 				error::emit<4006>(
 					std::move(node.get_declared_location()), 
-					node.get_declaration_identifier()
+					node.get_declaration_identifier().get_name()
 				)
 			); // return on failure
 		}
 
-		m_llvm_context->get_builder().CreateStore(
-			cast_assigned_value, 
-			global_declaration->get_value()
-		);
-
-		global_declaration->set_pointer(
-			global_declaration->get_value()
-		);
-
-		m_llvm_context->get_builder().CreateRetVoid();
-
-		// create a new constructor with the given priority
-		llvm::ConstantInt* priority = llvm::ConstantInt::get(
-			llvm::Type::getInt32Ty(m_llvm_context->get_context()),
-			m_global_initialization_priority++
-		);
-
-		llvm::Constant* initializer_cast = llvm::ConstantExpr::getBitCast(
-			init_func, 
-			llvm::Type::getInt8PtrTy(m_llvm_context->get_context())
-		);
-
-		llvm::Constant* new_ctor = llvm::ConstantStruct::get(CTOR_STRUCT_TYPE, {
-			priority,
-			initializer_cast,
-			llvm::Constant::getNullValue(llvm::Type::getInt8PtrTy(m_llvm_context->get_context()))
-		});
+		if (static_initializer) {
+			// globals which are never written to are marked as constant once the module has been generated
+			m_static_global_variables.push_back(global_variable);
+		}
+		else {
+			m_llvm_context->get_builder().CreateStore(
+				cast_assigned_value,
+				global_variable
+			);
+		}
 
-		// push the constructor to the ctor list
-		m_global_ctors.push_back(new_ctor);
+		global_declaration.set_pointer(global_variable);
 		return global_declaration;
 	}
 
@@ -306,8 +237,8 @@ namespace sigma {
 	) {
 		(void)context; // suppress C4100
 		// get the count of allocated elements
-		expected_value element_count_result = node.get_array_element_count_node()->accept(
-			*this, 
+		expected_value element_count_result = generate_node(
+			node.get_array_element_count_node(),
 			{}
 		);
 
@@ -323,7 +254,7 @@ namespace sigma {
 		);
 
 		const llvm::FunctionCallee malloc_func = m_function_registry.get_function(
-			"malloc",
+			m_symbol_table->intern("malloc"),
 			m_llvm_context
 		)->get_function();
 
@@ -382,13 +313,12 @@ namespace sigma {
 			m_llvm_context->get_builder().CreateStore(llvm::ConstantInt::get(m_llvm_context->get_context(), llvm::APInt(8, 0)), null_terminator_ptr);
 		}
 
-		value_ptr array_value = std::make_shared<value>(
-			"__alloca",
+		value array_value(
 			array_element_type.get_pointer_type(),
 			typed_ptr
 		);
 
-		array_value->set_pointer(
+		array_value.set_pointer(
 			allocated_ptr
 		);
 
@@ -403,8 +333,8 @@ namespace sigma {
 		const std::vector<sigma::node*>& index_nodes = node.get_array_element_index_nodes();
 
 		// evaluate the array base expression
-		expected_value array_ptr_result = node.get_array_base_node()->accept(
-			*this, 
+		expected_value array_ptr_result = generate_node(
+			node.get_array_base_node(),
 			{}
 		);
 
@@ -413,12 +343,12 @@ namespace sigma {
 		}
 
 		// traverse the array indexes
-		type current_type = array_ptr_result.value()->get_type();
-		llvm::Value* current_ptr = array_ptr_result.value()->get_value();
+		type current_type = array_ptr_result.value().get_type();
+		llvm::Value* current_ptr = array_ptr_result.value().get_value();
 
 		for (u64 i = 0; i < index_nodes.size(); ++i) {
-			expected_value index_value_result = index_nodes[i]->accept(
-				*this, 
+			expected_value index_value_result = generate_node(
+				index_nodes[i],
 				{}
 			);
 
@@ -458,13 +388,12 @@ namespace sigma {
 			current_ptr
 		);
 
-		value_ptr element_value = std::make_shared<value>(
-			"__array_element", 
+		value element_value(
 			current_type.get_element_type(), 
 			loaded_value
 		);
 
-		element_value->set_pointer(current_ptr);
+		element_value.set_pointer(current_ptr);
 		return element_value;
 	}
 
@@ -476,8 +405,8 @@ namespace sigma {
 		const std::vector<sigma::node*>& index_nodes = node.get_array_element_index_nodes();
 
 		// evaluate the array base expression
-		expected_value array_ptr_result = node.get_array_base_node()->accept(
-			*this,
+		expected_value array_ptr_result = generate_node(
+			node.get_array_base_node(),
 			{}
 		);
 
@@ -486,12 +415,12 @@ namespace sigma {
 		}
 
 		// traverse the array indexes
-		type current_type = array_ptr_result.value()->get_type();
-		llvm::Value* current_ptr = array_ptr_result.value()->get_value();
+		type current_type = array_ptr_result.value().get_type();
+		llvm::Value* current_ptr = array_ptr_result.value().get_value();
 
 		for (u64 i = 0; i < index_nodes.size(); ++i) {
-			expected_value index_value_result = index_nodes[i]->accept(
-				*this, 
+			expected_value index_value_result = generate_node(
+				index_nodes[i],
 				{}
 			);
 
@@ -527,13 +456,13 @@ namespace sigma {
 		}
 
 		// evaluate the right-hand side expression
-		expected_value expression_value_result = node.get_expression_node()->accept(
-			*this, 
+		expected_value expression_value_result = generate_node(
+			node.get_expression_node(),
 			code_generation_context(current_type.get_element_type())
 		);
 
-		if (!expression_value_result.value()) {
-			return expression_value_result;
+		if (!expression_value_result) {
+			return expression_value_result; // return on failure
 		}
 
 		// get the final element type for the assignment
@@ -546,19 +475,18 @@ namespace sigma {
 			node.get_declared_location()
 		);
 
-		value_ptr expression_value = std::make_shared<value>(
-			expression_value_result.value()->get_name(),
+		value expression_value(
 			final_element_type,
 			expression_llvm_value_cast
 		);
 
 		// store the result of the right-hand side expression in the array
 		m_llvm_context->get_builder().CreateStore(
-			expression_value_result.value()->get_value(), 
+			expression_value_result.value().get_value(), 
 			current_ptr
 		);
 
-		expression_value->set_pointer(current_ptr);
+		expression_value.set_pointer(current_ptr);
 		return expression_value;
 	}
 
@@ -568,12 +496,12 @@ namespace sigma {
 	) {
 		(void)context; // suppress C4100
 		// find the variable value in our named values
-		value_ptr var_value;
+		value var_value;
 		if (!get_named_value(var_value, node.get_variable_identifier())) {
 			return std::unexpected(
 				error::emit<4003>(
 					std::move(node.get_declared_location()),
-					node.get_variable_identifier()
+					node.get_variable_identifier().get_name()
 				)
 			); // return on failure
 		}
@@ -590,7 +518,7 @@ namespace sigma {
 		// evaluate the expression to get the initial value
 		if (sigma::node* expression = node.get_expression_node()) {
 			// evaluate the assigned value
-			return expression->accept(*this, context);
+			return generate_node(expression, context);
 		}
 
 		// declared without an assigned value, set it to 0
@@ -598,10 +526,66 @@ namespace sigma {
 			m_llvm_context->get_context()
 		);
 
-		return std::make_shared<value>(
-			node.get_declaration_identifier(),
+		return value(
 			node.get_declaration_type(),
 			llvm::Constant::getNullValue(value_type)
 		);
 	}
+
+	expected_value basic_code_generator::load_variable(
+		symbol variable_identifier,
+		const file_position& location
+	) {
+		// load a local variable
+		// look up the local variable in the active scope
+		if (const value* variable_value = m_scope.get_named_value(variable_identifier)) {
+			// load the value from the memory location
+			llvm::AllocaInst* alloca = llvm::dyn_cast<llvm::AllocaInst>(
+				variable_value->get_value()
+			);
+
+			llvm::Value* load = m_llvm_context->get_builder().CreateLoad(
+				alloca->getAllocatedType(),
+				variable_value->get_value()
+			);
+
+			// return the load instruction as a value
+			return value(
+				variable_value->get_type(), 
+				load,
+				alloca
+			);
+		}
+
+		// we haven't found a local variable, check if we're loading a global one
+		// load a global variable
+		// look up the global variable in the m_global_named_values map
+		const auto global_variable = m_global_named_values.find(variable_identifier);
+		// check if the global variable exists
+		if (global_variable == m_global_named_values.end()) {
+			return std::unexpected(
+				error::emit<4003>(
+					location, 
+					variable_identifier.get_name()
+				)
+			); // return on failure
+		}
+
+		// get the value from the global variable pointer
+		const llvm::GlobalValue* global_variable_value = llvm::dyn_cast<llvm::GlobalValue>(
+			global_variable->second.get_value()
+		);
+
+		// load the value from the memory location
+		llvm::Value* load = m_llvm_context->get_builder().CreateLoad(
+			global_variable_value->getValueType(),
+			global_variable->second.get_value()
+		);
+
+		// return the load instruction as a value
+		return value(
+			global_variable->second.get_type(),
+			load
+		);
+	}
 }
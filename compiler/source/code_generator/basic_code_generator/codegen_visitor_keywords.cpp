@@ -7,8 +7,11 @@ namespace sigma {
 		file_include_node& node, 
 		const code_generation_context& context
 	) {
-		return std::make_shared<value>(
-			"__temp",
+		(void)node; // suppress C4100
+		(void)context; // suppress C4100
+		// included files are compiled as separate modules, their functions are imported into the function
+		// registry before the tree is walked
+		return value(
 			type(type::base::empty, 0),
 			nullptr
 		);
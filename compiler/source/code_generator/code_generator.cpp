@@ -8,6 +8,22 @@ namespace sigma {
 		m_abstract_syntax_tree = abstract_syntax_tree;
 	}
 
+	void code_generator::set_symbol_table(std::shared_ptr<symbol_table> symbol_table) {
+		m_symbol_table = symbol_table;
+	}
+
+	void code_generator::set_trace(std::shared_ptr<trace> trace) {
+		m_trace = trace;
+	}
+
+	void code_generator::set_imported_functions(std::vector<std::pair<std::string, function_declaration_ptr>> imported_functions) {
+		m_imported_functions = std::move(imported_functions);
+	}
+
+	void code_generator::set_root_module(bool is_root_module) {
+		m_is_root_module = is_root_module;
+	}
+
 	std::shared_ptr<llvm_context> code_generator::get_llvm_context() {
 		return m_llvm_context;
 	}
@@ -31,6 +31,10 @@ namespace sigma {
 	class char_node;
 	class string_node;
 	class bool_node;
+	class constant_node;
+
+	// expressions
+	class flat_expression_node;
 
 	// operators
 	// unary
@@ -74,6 +78,9 @@ namespace sigma {
 
 #include "llvm_wrappers/code_generation_context.h"
 #include "llvm_wrappers/llvm_context.h"
+#include "llvm_wrappers/functions/function_registry.h"
+#include "utility/containers/symbol_table.h"
+#include "compiler/trace/trace.h"
 
 namespace sigma {
 	class abstract_syntax_tree;
@@ -92,6 +99,40 @@ namespace sigma {
 			std::shared_ptr<abstract_syntax_tree> abstract_syntax_tree
 		);
 
+		/**
+		 * \brief Sets the symbol table the identifiers in the abstract syntax tree were interned into.
+		 * \param symbol_table Compilation-wide symbol table
+		 */
+		void set_symbol_table(
+			std::shared_ptr<symbol_table> symbol_table
+		);
+
+		/**
+		 * \brief Sets the trace which code generation scopes are recorded into.
+		 * \param trace Compilation trace, or nullptr if tracing is disabled
+		 */
+		void set_trace(
+			std::shared_ptr<trace> trace
+		);
+
+		/**
+		 * \brief Sets the functions defined by the modules the abstract syntax tree includes. Calls to imported
+		 * functions are emitted against external declarations, which get resolved once the modules are linked.
+		 * \param imported_functions Names and declarations of the imported functions
+		 */
+		void set_imported_functions(
+			std::vector<std::pair<std::string, function_declaration_ptr>> imported_functions
+		);
+
+		/**
+		 * \brief Marks the generated module as the root module of the compilation. Only the root module has to
+		 * provide a main entry point, either by defining it or by including a module which does.
+		 * \param is_root_module Root module flag
+		 */
+		void set_root_module(
+			bool is_root_module
+		);
+
 		std::shared_ptr<llvm_context> get_llvm_context();
 		
 
@@ -199,6 +240,17 @@ namespace sigma {
 			bool_node& node,
 			const code_generation_context& context
 		) = 0;
+
+		virtual expected_value visit_constant_node(
+			constant_node& node,
+			const code_generation_context& context
+		) = 0;
+
+		// expressions
+		virtual expected_value visit_flat_expression_node(
+			flat_expression_node& node,
+			const code_generation_context& context
+		) = 0;
 		
 		// operators
 		// unary
@@ -355,5 +407,9 @@ namespace sigma {
 	protected:
 		std::shared_ptr<abstract_syntax_tree> m_abstract_syntax_tree;
 		std::shared_ptr<llvm_context> m_llvm_context;
+		std::shared_ptr<symbol_table> m_symbol_table;
+		std::shared_ptr<trace> m_trace;
+		std::vector<std::pair<std::string, function_declaration_ptr>> m_imported_functions;
+		bool m_is_root_module = true;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,733 @@
+#include "constant_folder.h"
+
+#include "code_generator/abstract_syntax_tree/node_children.h"
+#include "code_generator/abstract_syntax_tree/functions/function_call_node.h"
+#include "code_generator/abstract_syntax_tree/functions/function_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/for_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/if_else_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/return_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/while_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/bool_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/char_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/numerical_literal_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/operator_binary_base.h"
+#include "code_generator/abstract_syntax_tree/operators/unary/operator_unary_base.h"
+#include "code_generator/abstract_syntax_tree/variables/assignment_node.h"
+#include "code_generator/abstract_syntax_tree/variables/variable_access_node.h"
+#include "code_generator/abstract_syntax_tree/variables/variable_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_access_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_allocation_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_assignment_node.h"
+#include "code_generator/abstract_syntax_tree/variables/declaration/global_declaration_node.h"
+#include "code_generator/abstract_syntax_tree/variables/declaration/local_declaration_node.h"
+
+#include <charconv>
+
+namespace sigma {
+	namespace {
+		/**
+		 * \brief Gets the bit width of the LLVM integer type which represents the given type.
+		 */
+		u32 get_integer_bit_width(
+			type ty
+		) {
+			// booleans occupy 8 bits in memory, but are represented by i1 values
+			return ty.get_base() == type::base::boolean ? 1 : ty.get_bit_width();
+		}
+
+		bool is_integer_like(
+			type ty
+		) {
+			return ty.get_pointer_level() == 0 && (ty.is_integral() || ty.get_base() == type::base::character);
+		}
+
+		const llvm::fltSemantics& get_floating_point_semantics(
+			type ty
+		) {
+			return ty.get_base() == type::base::f32 ? llvm::APFloat::IEEEsingle() : llvm::APFloat::IEEEdouble();
+		}
+
+		constant make_boolean(
+			bool value
+		) {
+			return { type(type::base::boolean, 0), llvm::APInt(1, value) };
+		}
+
+		/**
+		 * \brief Casts the given constant to \a target_type, the same way basic_code_generator::cast_value
+		 * casts values.
+		 * \return Cast constant, std::nullopt if the cast wouldn't produce a valid value.
+		 */
+		std::optional<constant> cast_constant(
+			const constant& source,
+			type target_type
+		) {
+			const type source_type = source.value_type;
+
+			if (source_type == target_type) {
+				return source;
+			}
+
+			if (target_type.get_pointer_level() > 0 || source_type.get_pointer_level() > 0) {
+				return std::nullopt;
+			}
+
+			// boolean to i32
+			if (source_type.get_base() == type::base::boolean && target_type.get_base() == type::base::i32) {
+				return constant{ target_type, source.integer.zext(32) };
+			}
+
+			// floating-point to integer
+			if (source_type.is_floating_point() && target_type.is_integral()) {
+				llvm::APSInt integer(get_integer_bit_width(target_type), false);
+				bool is_exact;
+
+				// values which don't fit the integer are poison
+				if (source.floating_point.convertToInteger(
+					integer,
+					llvm::APFloat::rmTowardZero,
+					&is_exact
+				) & llvm::APFloat::opInvalidOp) {
+					return std::nullopt;
+				}
+
+				return constant{ target_type, integer };
+			}
+
+			// integer to floating-point, the code generator treats every integer as signed
+			if (source_type.is_integral() && target_type.is_floating_point()) {
+				llvm::APFloat floating_point(get_floating_point_semantics(target_type));
+				floating_point.convertFromAPInt(source.integer, true, llvm::APFloat::rmNearestTiesToEven);
+				return constant{ target_type, llvm::APInt(), floating_point };
+			}
+
+			// floating-point upcast or downcast
+			if (source_type.is_floating_point() && target_type.is_floating_point()) {
+				llvm::APFloat floating_point = source.floating_point;
+				bool loses_info;
+
+				floating_point.convert(
+					get_floating_point_semantics(target_type),
+					llvm::APFloat::rmNearestTiesToEven,
+					&loses_info
+				);
+
+				return constant{ target_type, llvm::APInt(), floating_point };
+			}
+
+			if (!is_integer_like(source_type) || !is_integer_like(target_type)) {
+				return std::nullopt;
+			}
+
+			const u32 source_width = get_integer_bit_width(source_type);
+			const u32 target_width = get_integer_bit_width(target_type);
+
+			// upcast, the decision is based on the storage widths of both types
+			if (source_type.get_bit_width() < target_type.get_bit_width()) {
+				if (source_width > target_width) {
+					return std::nullopt;
+				}
+
+				return constant{
+					target_type,
+					source_type.is_unsigned() ? source.integer.zext(target_width) : source.integer.sext(target_width)
+				};
+			}
+
+			// downcast
+			if (source_width < target_width) {
+				return std::nullopt;
+			}
+
+			return constant{ target_type, source.integer.trunc(target_width) };
+		}
+
+		/**
+		 * \brief Records an implicit cast, the warning is emitted by the code generator once it generates the
+		 * constant, so that warnings keep their order and only appear for code which is generated.
+		 */
+		void add_implicit_cast(
+			std::vector<implicit_cast>& implicit_casts,
+			const file_position& location,
+			type source_type,
+			type target_type
+		) {
+			if (source_type != target_type) {
+				implicit_casts.push_back({ location, source_type, target_type });
+			}
+		}
+	}
+
+	constant_folder::constant_folder(
+		std::shared_ptr<abstract_syntax_tree> abstract_syntax_tree
+	) : m_abstract_syntax_tree(std::move(abstract_syntax_tree)) {}
+
+	error_result constant_folder::fold() {
+		// globals can only be propagated if they are never written to, which has to be known before the
+		// first access is folded
+		for (node* target : *m_abstract_syntax_tree) {
+			collect_written_variables(target);
+		}
+
+		for (node_ptr& target : *m_abstract_syntax_tree) {
+			if (auto folding_error = fold_node(target)) {
+				return folding_error; // return on failure
+			}
+		}
+
+		return {};
+	}
+
+	u64 constant_folder::get_folded_node_count() const {
+		return m_folded_node_count;
+	}
+
+	error_result constant_folder::fold_node(
+		node_ptr& target
+	) {
+		if (target == nullptr) {
+			return {};
+		}
+
+		switch (target->get_kind()) {
+		case node_kind::numerical_literal:
+			return parse_numerical_literal(static_cast<numerical_literal_node&>(*target));
+		case node_kind::function:
+			return fold_function(static_cast<function_node&>(*target));
+		case node_kind::global_declaration:
+			return fold_global_declaration(static_cast<global_declaration_node&>(*target));
+		case node_kind::variable_access:
+			propagate_global_value(target);
+			return {};
+		default:
+			break;
+		}
+
+		// fold the operands first
+		if (auto child_error = for_each_child(target, [this](node_ptr& child) {
+			return fold_node(child);
+		})) {
+			return child_error; // return on failure
+		}
+
+		// replace operators whose value is known
+		std::vector<implicit_cast> operator_casts;
+
+		if (const std::optional<constant> value = evaluate_operator(*target, operator_casts)) {
+			// casts of folded operands are reported before the casts performed by the operator itself
+			std::vector<implicit_cast> implicit_casts;
+
+			for_each_child(target, [&implicit_casts](node_ptr& child) -> error_result {
+				if (child != nullptr && child->get_kind() == node_kind::constant) {
+					const std::vector<implicit_cast>& operand_casts = static_cast<constant_node*>(child)->get_implicit_casts();
+					implicit_casts.insert(implicit_casts.end(), operand_casts.begin(), operand_casts.end());
+				}
+
+				return {};
+			});
+
+			implicit_casts.insert(implicit_casts.end(), operator_casts.begin(), operator_casts.end());
+
+			target = m_abstract_syntax_tree->make<constant_node>(
+				target->get_declared_location(),
+				value.value(),
+				std::move(implicit_casts)
+			);
+
+			m_folded_node_count++;
+		}
+
+		return {};
+	}
+
+	error_result constant_folder::fold_function(
+		function_node& function
+	) {
+		m_function_arguments = &function.get_function_arguments();
+
+		for (node_ptr& statement : function.get_function_statements()) {
+			if (auto statement_error = fold_node(statement)) {
+				return statement_error; // return on failure
+			}
+		}
+
+		m_function_arguments = nullptr;
+		return {};
+	}
+
+	error_result constant_folder::fold_global_declaration(
+		global_declaration_node& declaration
+	) {
+		if (auto expression_error = fold_node(declaration.get_expression_node())) {
+			return expression_error; // return on failure
+		}
+
+		// only globals which are never assigned to keep their initial value
+		if (m_written_variables.contains(declaration.get_declaration_identifier())) {
+			return {};
+		}
+
+		if (const std::optional<constant> value = get_global_value(declaration)) {
+			m_global_values.insert({ declaration.get_declaration_identifier(), value.value() });
+		}
+
+		return {};
+	}
+
+	error_result constant_folder::parse_numerical_literal(
+		numerical_literal_node& literal
+	) const {
+		// the lexer guarantees that literals only contain digits and at most one '.' character
+		const std::string& text = literal.get_value();
+		const char* first = text.data();
+		const char* last = first + text.size();
+		const bool is_floating_point = text.find('.') != std::string::npos;
+
+		// the integral value of floating point literals is their integral part
+		u64 integer_value = 0;
+		if (std::from_chars(first, last, integer_value).ec == std::errc::result_out_of_range) {
+			if (!is_floating_point) {
+				return error::emit<4017>(
+					std::move(literal.get_declared_location()),
+					text
+				); // return on failure
+			}
+
+			integer_value = std::numeric_limits<u64>::max();
+		}
+
+		// literals which don't fit a floating point type are either infinite, or too small to be represented
+		f32 f32_value = 0.0f;
+		if (std::from_chars(first, last, f32_value).ec == std::errc::result_out_of_range) {
+			f32_value = integer_value != 0 ? std::numeric_limits<f32>::infinity() : 0.0f;
+		}
+
+		f64 f64_value = 0.0;
+		if (std::from_chars(first, last, f64_value).ec == std::errc::result_out_of_range) {
+			f64_value = integer_value != 0 ? std::numeric_limits<f64>::infinity() : 0.0;
+		}
+
+		literal.set_parsed_values(integer_value, f32_value, f64_value);
+		return {};
+	}
+
+	void constant_folder::propagate_global_value(
+		node_ptr& target
+	) {
+		const symbol identifier = static_cast<variable_access_node&>(*target).get_variable_identifier();
+		const auto global_value = m_global_values.find(identifier);
+
+		if (global_value == m_global_values.end()) {
+			return;
+		}
+
+		// function arguments shadow globals
+		if (m_function_arguments != nullptr && std::ranges::any_of(
+			*m_function_arguments,
+			[identifier](const std::pair<symbol, type>& argument) {
+				return argument.first == identifier;
+			}
+		)) {
+			return;
+		}
+
+		target = m_abstract_syntax_tree->make<constant_node>(
+			target->get_declared_location(),
+			global_value->second
+		);
+
+		m_folded_node_count++;
+	}
+
+	void constant_folder::collect_written_variables(
+		node* target
+	) {
+		if (target == nullptr) {
+			return;
+		}
+
+		node* written_variable = nullptr;
+
+		switch (target->get_kind()) {
+		case node_kind::variable:
+			m_written_variables.insert(static_cast<variable_node*>(target)->get_variable_identifier());
+			break;
+		case node_kind::operator_post_decrement:
+		case node_kind::operator_post_increment:
+		case node_kind::operator_pre_decrement:
+		case node_kind::operator_pre_increment:
+			written_variable = static_cast<operator_unary_base*>(target)->get_expression_node();
+			break;
+		case node_kind::operator_addition_assignment:
+		case node_kind::operator_subtraction_assignment:
+		case node_kind::operator_multiplication_assignment:
+		case node_kind::operator_division_assignment:
+		case node_kind::operator_modulo_assignment:
+			written_variable = static_cast<operator_binary_base*>(target)->get_left_expression_node();
+			break;
+		default:
+			break;
+		}
+
+		if (written_variable != nullptr && written_variable->get_kind() == node_kind::variable_access) {
+			m_written_variables.insert(static_cast<variable_access_node*>(written_variable)->get_variable_identifier());
+		}
+
+		for_each_child(target, [this](node_ptr& child) -> error_result {
+			collect_written_variables(child);
+			return {};
+		});
+	}
+
+	std::optional<constant> constant_folder::get_global_value(
+		const global_declaration_node& declaration
+	) const {
+		const type declaration_type = declaration.get_declaration_type();
+
+		if (!is_integer_like(declaration_type) && !declaration_type.is_floating_point()) {
+			return std::nullopt;
+		}
+
+		const node* expression = declaration.get_expression_node();
+
+		// globals declared without a value are zero initialized
+		if (expression == nullptr) {
+			if (declaration_type.is_floating_point()) {
+				return constant{
+					declaration_type,
+					llvm::APInt(),
+					llvm::APFloat::getZero(get_floating_point_semantics(declaration_type))
+				};
+			}
+
+			return constant{ declaration_type, llvm::APInt(get_integer_bit_width(declaration_type), 0) };
+		}
+
+		// literal initializers are generated with the declaration type as their contextual type
+		if (expression->get_kind() == node_kind::numerical_literal) {
+			const auto& literal = static_cast<const numerical_literal_node&>(*expression);
+
+			if (declaration_type.is_floating_point()) {
+				return constant{
+					declaration_type,
+					llvm::APInt(),
+					declaration_type.get_base() == type::base::f32
+						? llvm::APFloat(literal.get_f32_value())
+						: llvm::APFloat(literal.get_f64_value())
+				};
+			}
+
+			if (declaration_type.get_base() == type::base::boolean) {
+				return make_boolean(literal.get_integer_value() != 0);
+			}
+
+			return constant{
+				declaration_type,
+				llvm::APInt(declaration_type.get_bit_width(), literal.get_integer_value(), declaration_type.is_signed())
+			};
+		}
+
+		const std::optional<constant> value = get_constant_value(*expression);
+
+		if (!value) {
+			return std::nullopt;
+		}
+
+		return cast_constant(value.value(), declaration_type);
+	}
+
+	std::optional<constant> constant_folder::evaluate_operator(
+		const node& target,
+		std::vector<implicit_cast>& implicit_casts
+	) const {
+		switch (target.get_kind()) {
+		case node_kind::operator_bitwise_not:
+		case node_kind::operator_not:
+			return evaluate_unary_operator(static_cast<const operator_unary_base&>(target));
+		case node_kind::operator_addition:
+		case node_kind::operator_subtraction:
+		case node_kind::operator_multiplication:
+		case node_kind::operator_division:
+		case node_kind::operator_modulo:
+			return evaluate_arithmetic_operator(static_cast<const operator_binary_base&>(target), implicit_casts);
+		case node_kind::operator_greater_than:
+		case node_kind::operator_greater_than_equal_to:
+		case node_kind::operator_less_than:
+		case node_kind::operator_less_than_equal_to:
+		case node_kind::operator_equals:
+		case node_kind::operator_not_equals:
+			return evaluate_comparison_operator(static_cast<const operator_binary_base&>(target), implicit_casts);
+		case node_kind::operator_conjunction:
+		case node_kind::operator_disjunction:
+			return evaluate_logical_operator(static_cast<const operator_binary_base&>(target));
+		case node_kind::operator_bitwise_and:
+		case node_kind::operator_bitwise_or:
+		case node_kind::operator_bitwise_left_shift:
+		case node_kind::operator_bitwise_right_shift:
+		case node_kind::operator_bitwise_xor:
+			return evaluate_bitwise_operator(static_cast<const operator_binary_base&>(target));
+		default:
+			// compound assignments and increments write to memory, and cannot be folded
+			return std::nullopt;
+		}
+	}
+
+	std::optional<constant> constant_folder::evaluate_arithmetic_operator(
+		const operator_binary_base& operation,
+		std::vector<implicit_cast>& implicit_casts
+	) const {
+		const node* left_operand = operation.get_left_expression_node();
+		const node* right_operand = operation.get_right_expression_node();
+		const std::optional<constant> left = get_constant_value(*left_operand);
+		const std::optional<constant> right = get_constant_value(*right_operand);
+
+		if (!left || !right) {
+			return std::nullopt;
+		}
+
+		// upcast both operands
+		const type highest_precision = get_highest_precision_type(left->value_type, right->value_type);
+		const std::optional<constant> left_value = cast_constant(left.value(), highest_precision);
+		const std::optional<constant> right_value = cast_constant(right.value(), highest_precision);
+
+		if (!left_value || !right_value) {
+			return std::nullopt;
+		}
+
+		constant result{ highest_precision, llvm::APInt() };
+
+		if (highest_precision.is_floating_point()) {
+			result.floating_point = left_value->floating_point;
+			const llvm::APFloat& right_floating_point = right_value->floating_point;
+
+			switch (operation.get_kind()) {
+			case node_kind::operator_addition:
+				result.floating_point.add(right_floating_point, llvm::APFloat::rmNearestTiesToEven);
+				break;
+			case node_kind::operator_subtraction:
+				result.floating_point.subtract(right_floating_point, llvm::APFloat::rmNearestTiesToEven);
+				break;
+			case node_kind::operator_multiplication:
+				result.floating_point.multiply(right_floating_point, llvm::APFloat::rmNearestTiesToEven);
+				break;
+			case node_kind::operator_division:
+				result.floating_point.divide(right_floating_point, llvm::APFloat::rmNearestTiesToEven);
+				break;
+			default:
+				result.floating_point.mod(right_floating_point);
+				break;
+			}
+		}
+		else {
+			if (!is_integer_like(highest_precision)) {
+				return std::nullopt;
+			}
+
+			const llvm::APInt& left_integer = left_value->integer;
+			const llvm::APInt& right_integer = right_value->integer;
+			const bool is_unsigned = highest_precision.is_unsigned();
+
+			switch (operation.get_kind()) {
+			case node_kind::operator_addition:
+				result.integer = left_integer + right_integer;
+				break;
+			case node_kind::operator_subtraction:
+				result.integer = left_integer - right_integer;
+				break;
+			case node_kind::operator_multiplication:
+				result.integer = left_integer * right_integer;
+				break;
+			default:
+				// divisions by zero and signed overflows are undefined, leave them for the code generator
+				if (right_integer.isZero() ||
+					(!is_unsigned && left_integer.isMinSignedValue() && right_integer.isAllOnes())) {
+					return std::nullopt;
+				}
+
+				if (operation.get_kind() == node_kind::operator_division) {
+					result.integer = is_unsigned ? left_integer.udiv(right_integer) : left_integer.sdiv(right_integer);
+				}
+				else {
+					result.integer = is_unsigned ? left_integer.urem(right_integer) : left_integer.srem(right_integer);
+				}
+
+				break;
+			}
+		}
+
+		// the operands have been cast, report it like the code generator would
+		add_implicit_cast(implicit_casts, left_operand->get_declared_location(), left->value_type, highest_precision);
+		add_implicit_cast(implicit_casts, right_operand->get_declared_location(), right->value_type, highest_precision);
+		return result;
+	}
+
+	std::optional<constant> constant_folder::evaluate_comparison_operator(
+		const operator_binary_base& operation,
+		std::vector<implicit_cast>& implicit_casts
+	) const {
+		const std::optional<constant> left = get_constant_value(*operation.get_left_expression_node());
+		const std::optional<constant> right = get_constant_value(*operation.get_right_expression_node());
+
+		if (!left || !right) {
+			return std::nullopt;
+		}
+
+		// upcast both operands
+		const type highest_precision = get_highest_precision_type(left->value_type, right->value_type);
+		const std::optional<constant> left_value = cast_constant(left.value(), highest_precision);
+		const std::optional<constant> right_value = cast_constant(right.value(), highest_precision);
+
+		if (!left_value || !right_value) {
+			return std::nullopt;
+		}
+
+		bool result;
+
+		if (highest_precision.is_floating_point()) {
+			// ordered comparisons, which are false if any of the operands is NaN
+			const llvm::APFloat::cmpResult comparison = left_value->floating_point.compare(right_value->floating_point);
+
+			switch (operation.get_kind()) {
+			case node_kind::operator_greater_than:
+				result = comparison == llvm::APFloat::cmpGreaterThan;
+				break;
+			case node_kind::operator_greater_than_equal_to:
+				result = comparison == llvm::APFloat::cmpGreaterThan || comparison == llvm::APFloat::cmpEqual;
+				break;
+			case node_kind::operator_less_than:
+				result = comparison == llvm::APFloat::cmpLessThan;
+				break;
+			case node_kind::operator_less_than_equal_to:
+				result = comparison == llvm::APFloat::cmpLessThan || comparison == llvm::APFloat::cmpEqual;
+				break;
+			case node_kind::operator_equals:
+				result = comparison == llvm::APFloat::cmpEqual;
+				break;
+			default:
+				result = comparison == llvm::APFloat::cmpLessThan || comparison == llvm::APFloat::cmpGreaterThan;
+				break;
+			}
+		}
+		else {
+			if (!is_integer_like(highest_precision)) {
+				return std::nullopt;
+			}
+
+			const llvm::APInt& left_integer = left_value->integer;
+			const llvm::APInt& right_integer = right_value->integer;
+			const bool is_unsigned = highest_precision.is_unsigned();
+
+			switch (operation.get_kind()) {
+			case node_kind::operator_greater_than:
+				result = is_unsigned ? left_integer.ugt(right_integer) : left_integer.sgt(right_integer);
+				break;
+			case node_kind::operator_greater_than_equal_to:
+				result = is_unsigned ? left_integer.uge(right_integer) : left_integer.sge(right_integer);
+				break;
+			case node_kind::operator_less_than:
+				result = is_unsigned ? left_integer.ult(right_integer) : left_integer.slt(right_integer);
+				break;
+			case node_kind::operator_less_than_equal_to:
+				result = is_unsigned ? left_integer.ule(right_integer) : left_integer.sle(right_integer);
+				break;
+			case node_kind::operator_equals:
+				result = left_integer == right_integer;
+				break;
+			default:
+				result = left_integer != right_integer;
+				break;
+			}
+		}
+
+		// comparisons report casts at the location of the operator
+		add_implicit_cast(implicit_casts, operation.get_declared_location(), left->value_type, highest_precision);
+		add_implicit_cast(implicit_casts, operation.get_declared_location(), right->value_type, highest_precision);
+		return make_boolean(result);
+	}
+
+	std::optional<constant> constant_folder::evaluate_logical_operator(
+		const operator_binary_base& operation
+	) const {
+		const std::optional<constant> left = get_constant_value(*operation.get_left_expression_node());
+		const std::optional<constant> right = get_constant_value(*operation.get_right_expression_node());
+
+		// both operands have to be booleans, otherwise the code generator reports an error
+		if (!left || !right ||
+			left->value_type != type(type::base::boolean, 0) ||
+			right->value_type != type(type::base::boolean, 0)) {
+			return std::nullopt;
+		}
+
+		if (operation.get_kind() == node_kind::operator_conjunction) {
+			return make_boolean(left->integer.getBoolValue() && right->integer.getBoolValue());
+		}
+
+		return make_boolean(left->integer.getBoolValue() || right->integer.getBoolValue());
+	}
+
+	std::optional<constant> constant_folder::evaluate_bitwise_operator(
+		const operator_binary_base& operation
+	) const {
+		const std::optional<constant> left = get_constant_value(*operation.get_left_expression_node());
+		const std::optional<constant> right = get_constant_value(*operation.get_right_expression_node());
+
+		// bitwise operators don't cast their operands, both of them have to be integrals of the same type
+		if (!left || !right ||
+			!left->value_type.is_integral() ||
+			left->value_type.get_pointer_level() > 0 ||
+			left->value_type != right->value_type) {
+			return std::nullopt;
+		}
+
+		const llvm::APInt& left_integer = left->integer;
+		const llvm::APInt& right_integer = right->integer;
+
+		switch (operation.get_kind()) {
+		case node_kind::operator_bitwise_and:
+			return constant{ left->value_type, left_integer & right_integer };
+		case node_kind::operator_bitwise_or:
+			return constant{ left->value_type, left_integer | right_integer };
+		case node_kind::operator_bitwise_xor:
+			return constant{ left->value_type, left_integer ^ right_integer };
+		default:
+			break;
+		}
+
+		// shifting by the bit width or more is undefined
+		if (right_integer.uge(left_integer.getBitWidth())) {
+			return std::nullopt;
+		}
+
+		if (operation.get_kind() == node_kind::operator_bitwise_left_shift) {
+			return constant{ left->value_type, left_integer.shl(right_integer) };
+		}
+
+		// right shifts are logical, regardless of the signedness of the operands
+		return constant{ left->value_type, left_integer.lshr(right_integer) };
+	}
+
+	std::optional<constant> constant_folder::evaluate_unary_operator(
+		const operator_unary_base& operation
+	) const {
+		const std::optional<constant> operand = get_constant_value(*operation.get_expression_node());
+
+		if (!operand) {
+			return std::nullopt;
+		}
+
+		if (operation.get_kind() == node_kind::operator_bitwise_not) {
+			if (!operand->value_type.is_integral() || operand->value_type.get_pointer_level() > 0) {
+				return std::nullopt;
+			}
+
+			return constant{ operand->value_type, ~operand->integer };
+		}
+
+		// the code generator compares the operand to an i1 false, only booleans produce a valid comparison
+		if (operand->value_type != type(type::base::boolean, 0)) {
+			return std::nullopt;
+		}
+
+		return make_boolean(operand->integer.isZero());
+	}
+}
\ No newline at end of file
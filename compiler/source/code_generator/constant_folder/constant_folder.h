@@ -0,0 +1,126 @@
+#pragma once
+#include "code_generator/abstract_syntax_tree/abstract_syntax_tree.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/constant_node.h"
+
+#include <unordered_set>
+
+namespace sigma {
+	class numerical_literal_node;
+	class function_node;
+	class global_declaration_node;
+	class operator_binary_base;
+	class operator_unary_base;
+
+	/**
+	 * \brief Semantic pass which runs between parsing and code generation. Converts the text of numerical
+	 * literals into values, replaces operators whose operands are all constant by constant nodes, and propagates
+	 * the values of global variables which are never written to. Folding follows the semantics of the code
+	 * generator (implicit casts, wrapping integer arithmetic, IEEE floating point arithmetic), operations whose
+	 * result isn't defined, ie. divisions by zero, are left for the code generator.
+	 */
+	class constant_folder {
+	public:
+		constant_folder(
+			std::shared_ptr<abstract_syntax_tree> abstract_syntax_tree
+		);
+
+		/**
+		 * \brief Runs the pass over the entire abstract syntax tree.
+		 * \return Optional error message containing information about a potential error.
+		 */
+		error_result fold();
+
+		/**
+		 * \brief Gets the number of nodes which have been replaced by constants.
+		 * \return Folded node count.
+		 */
+		u64 get_folded_node_count() const;
+	private:
+		error_result fold_node(
+			node_ptr& target
+		);
+
+		error_result fold_function(
+			function_node& function
+		);
+
+		error_result fold_global_declaration(
+			global_declaration_node& declaration
+		);
+
+		error_result parse_numerical_literal(
+			numerical_literal_node& literal
+		) const;
+
+		/**
+		 * \brief Replaces the given variable access by the value of the accessed global variable, if the
+		 * variable is constant.
+		 * \param target Variable access node
+		 */
+		void propagate_global_value(
+			node_ptr& target
+		);
+
+		/**
+		 * \brief Collects all variables which are written to, either through an assignment or by a compound
+		 * operator, in the subtree of \a target.
+		 * \param target Root of the subtree to search
+		 */
+		void collect_written_variables(
+			node* target
+		);
+
+		/**
+		 * \brief Gets the value of a global variable right after its initialization.
+		 * \param declaration Declaration of the global variable
+		 * \return Value of the global, std::nullopt if it isn't known at compile time.
+		 */
+		std::optional<constant> get_global_value(
+			const global_declaration_node& declaration
+		) const;
+
+		/**
+		 * \brief Evaluates the given operator node.
+		 * \param target Operator node whose operands have been folded already
+		 * \param implicit_casts Receives the implicit casts of the operands performed by the operator
+		 * \return Value of the operator, std::nullopt if any of its operands isn't constant or if the operation
+		 * cannot be evaluated at compile time.
+		 */
+		std::optional<constant> evaluate_operator(
+			const node& target,
+			std::vector<implicit_cast>& implicit_casts
+		) const;
+
+		std::optional<constant> evaluate_arithmetic_operator(
+			const operator_binary_base& operation,
+			std::vector<implicit_cast>& implicit_casts
+		) const;
+
+		std::optional<constant> evaluate_comparison_operator(
+			const operator_binary_base& operation,
+			std::vector<implicit_cast>& implicit_casts
+		) const;
+
+		std::optional<constant> evaluate_logical_operator(
+			const operator_binary_base& operation
+		) const;
+
+		std::optional<constant> evaluate_bitwise_operator(
+			const operator_binary_base& operation
+		) const;
+
+		std::optional<constant> evaluate_unary_operator(
+			const operator_unary_base& operation
+		) const;
+	private:
+		std::shared_ptr<abstract_syntax_tree> m_abstract_syntax_tree;
+
+		// variables which are assigned to anywhere in the syntax tree
+		std::unordered_set<symbol> m_written_variables;
+		// values of the constant global variables declared so far
+		std::unordered_map<symbol, constant> m_global_values;
+		// arguments of the function which is being folded, arguments shadow global variables
+		const std::vector<std::pair<symbol, type>>* m_function_arguments = nullptr;
+		u64 m_folded_node_count = 0;
+	};
+}
\ No newline at end of file
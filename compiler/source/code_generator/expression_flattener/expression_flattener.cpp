@@ -0,0 +1,169 @@
+#include "expression_flattener.h"
+
+#include "code_generator/abstract_syntax_tree/node_children.h"
+#include "code_generator/abstract_syntax_tree/expressions/flat_expression_node.h"
+#include "code_generator/abstract_syntax_tree/variables/variable_access_node.h"
+
+namespace sigma {
+	expression_flattener::expression_flattener(
+		std::shared_ptr<abstract_syntax_tree> abstract_syntax_tree
+	) : m_abstract_syntax_tree(std::move(abstract_syntax_tree)) {}
+
+	void expression_flattener::flatten() {
+		for (node_ptr& target : *m_abstract_syntax_tree) {
+			flatten_node(target);
+		}
+	}
+
+	u64 expression_flattener::get_flattened_expression_count() const {
+		return m_flattened_expression_count;
+	}
+
+	void expression_flattener::flatten_node(
+		node_ptr& target
+	) {
+		if (target == nullptr) {
+			return;
+		}
+
+		if (!is_flattenable_operator(target->get_kind())) {
+			for_each_child(target, [this](node_ptr& child) -> error_result {
+				flatten_node(child);
+				return {};
+			});
+
+			return;
+		}
+
+		flatten_nested_expressions(target);
+
+		expression_table& table = m_abstract_syntax_tree->get_expression_table();
+		const expression_index first_expression = table.get_expression_count();
+		const expression_index root_expression = add_expression(target);
+
+		target = m_abstract_syntax_tree->make<flat_expression_node>(
+			target->get_declared_location(),
+			table,
+			first_expression,
+			root_expression
+		);
+
+		m_flattened_expression_count++;
+	}
+
+	void expression_flattener::flatten_nested_expressions(
+		node* target
+	) {
+		if (is_flattenable_operator(target->get_kind())) {
+			for_each_child(target, [this](node_ptr& operand) -> error_result {
+				flatten_nested_expressions(operand);
+				return {};
+			});
+		}
+		else {
+			// the operand stays in the tree, expressions inside of it are flattened on their own
+			for_each_child(target, [this](node_ptr& child) -> error_result {
+				flatten_node(child);
+				return {};
+			});
+		}
+	}
+
+	expression_index expression_flattener::add_expression(
+		node* target
+	) {
+		expression_table& table = m_abstract_syntax_tree->get_expression_table();
+
+		// operands are added before their operator
+		switch (target->get_kind()) {
+		case node_kind::operator_bitwise_not:
+		case node_kind::operator_not: {
+			const expression_index operand = add_expression(
+				static_cast<operator_unary_base*>(target)->get_expression_node()
+			);
+
+			return table.add_unary_operation(target->get_kind(), target->get_declared_location(), operand);
+		}
+		case node_kind::operator_addition:
+		case node_kind::operator_subtraction:
+		case node_kind::operator_multiplication:
+		case node_kind::operator_division:
+		case node_kind::operator_modulo:
+		case node_kind::operator_bitwise_and:
+		case node_kind::operator_bitwise_or:
+		case node_kind::operator_bitwise_left_shift:
+		case node_kind::operator_bitwise_right_shift:
+		case node_kind::operator_bitwise_xor:
+		case node_kind::operator_conjunction:
+		case node_kind::operator_disjunction:
+		case node_kind::operator_greater_than:
+		case node_kind::operator_greater_than_equal_to:
+		case node_kind::operator_less_than:
+		case node_kind::operator_less_than_equal_to:
+		case node_kind::operator_equals:
+		case node_kind::operator_not_equals: {
+			const auto* operation = static_cast<operator_binary_base*>(target);
+			const expression_index left_operand = add_expression(operation->get_left_expression_node());
+			const expression_index right_operand = add_expression(operation->get_right_expression_node());
+
+			return table.add_binary_operation(
+				target->get_kind(),
+				target->get_declared_location(),
+				left_operand,
+				right_operand
+			);
+		}
+		case node_kind::constant: {
+			const auto* constant = static_cast<constant_node*>(target);
+
+			return table.add_constant(
+				target->get_declared_location(),
+				constant->get_value(),
+				constant->get_implicit_casts()
+			);
+		}
+		case node_kind::variable_access:
+			return table.add_variable_access(
+				target->get_declared_location(),
+				static_cast<variable_access_node*>(target)->get_variable_identifier()
+			);
+		default:
+			// operands are generated without a contextual type, literals can therefore be stored as constants
+			if (const std::optional<constant> value = get_constant_value(*target)) {
+				return table.add_constant(target->get_declared_location(), value.value());
+			}
+
+			return table.add_node(target);
+		}
+	}
+
+	bool expression_flattener::is_flattenable_operator(
+		node_kind kind
+	) {
+		switch (kind) {
+		case node_kind::operator_bitwise_not:
+		case node_kind::operator_not:
+		case node_kind::operator_addition:
+		case node_kind::operator_subtraction:
+		case node_kind::operator_multiplication:
+		case node_kind::operator_division:
+		case node_kind::operator_modulo:
+		case node_kind::operator_bitwise_and:
+		case node_kind::operator_bitwise_or:
+		case node_kind::operator_bitwise_left_shift:
+		case node_kind::operator_bitwise_right_shift:
+		case node_kind::operator_bitwise_xor:
+		case node_kind::operator_conjunction:
+		case node_kind::operator_disjunction:
+		case node_kind::operator_greater_than:
+		case node_kind::operator_greater_than_equal_to:
+		case node_kind::operator_less_than:
+		case node_kind::operator_less_than_equal_to:
+		case node_kind::operator_equals:
+		case node_kind::operator_not_equals:
+			return true;
+		default:
+			return false;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+#include "code_generator/abstract_syntax_tree/abstract_syntax_tree.h"
+
+namespace sigma {
+	/**
+	 * \brief Pass which runs after the constant folder when compiler_settings::flatten_expressions is set. Moves
+	 * operator expressions into the expression table of the abstract syntax tree, and replaces each of them by a
+	 * flat_expression_node. The code generator then generates an entire expression in a single pass over a
+	 * contiguous range of the table, instead of chasing node pointers.
+	 * Operators which write to their operand (compound assignments, increments and decrements) stay in the tree,
+	 * operands which can't be flattened (ie. function calls) are referenced by the table.
+	 */
+	class expression_flattener {
+	public:
+		expression_flattener(
+			std::shared_ptr<abstract_syntax_tree> abstract_syntax_tree
+		);
+
+		/**
+		 * \brief Runs the pass over the entire abstract syntax tree.
+		 */
+		void flatten();
+
+		/**
+		 * \brief Gets the number of expressions which have been replaced by flat expressions.
+		 * \return Flattened expression count.
+		 */
+		u64 get_flattened_expression_count() const;
+	private:
+		void flatten_node(
+			node_ptr& target
+		);
+
+		/**
+		 * \brief Flattens the expressions nested in the operands of \a target which stay in the tree. Has to run
+		 * before \a target itself is added, so that the range of \a target stays contiguous.
+		 * \param target Expression which is going to be flattened
+		 */
+		void flatten_nested_expressions(
+			node* target
+		);
+
+		/**
+		 * \brief Adds the given expression, and all of its operands, to the expression table.
+		 * \param target Expression to add
+		 * \return Index of the added expression.
+		 */
+		expression_index add_expression(
+			node* target
+		);
+
+		static bool is_flattenable_operator(
+			node_kind kind
+		);
+	private:
+		std::shared_ptr<abstract_syntax_tree> m_abstract_syntax_tree;
+		u64 m_flattened_expression_count = 0;
+	};
+}
\ No newline at end of file
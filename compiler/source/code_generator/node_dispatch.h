@@ -0,0 +1,196 @@
+#pragma once
+#include "code_generator/code_generator.h"
+
+#include "code_generator/abstract_syntax_tree/functions/function_call_node.h"
+#include "code_generator/abstract_syntax_tree/functions/function_node.h"
+#include "code_generator/abstract_syntax_tree/expressions/flat_expression_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/file_include_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/break_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/for_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/if_else_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/return_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/flow_control/while_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/bool_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/char_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/constant_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/numerical_literal_node.h"
+#include "code_generator/abstract_syntax_tree/keywords/types/string_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_addition_assignment_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_addition_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_division_assignment_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_division_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_modulo_assignment_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_modulo_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_multiplication_assignment_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_multiplication_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_subtraction_assignment_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/arithmetic/operator_subtraction_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/bitwise/operator_bitwise_and_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/bitwise/operator_bitwise_left_shift_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/bitwise/operator_bitwise_or_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/bitwise/operator_bitwise_right_shift_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/bitwise/operator_bitwise_xor_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/logical/operator_conjunction_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/logical/operator_disjunction_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/logical/operator_equals_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/logical/operator_greater_than_equal_to_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/logical/operator_greater_than_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/logical/operator_less_than_equal_to_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/logical/operator_less_than_node.h"
+#include "code_generator/abstract_syntax_tree/operators/binary/logical/operator_not_equals_node.h"
+#include "code_generator/abstract_syntax_tree/operators/unary/arithmetic/operator_post_decrement_node.h"
+#include "code_generator/abstract_syntax_tree/operators/unary/arithmetic/operator_post_increment_node.h"
+#include "code_generator/abstract_syntax_tree/operators/unary/arithmetic/operator_pre_decrement_node.h"
+#include "code_generator/abstract_syntax_tree/operators/unary/arithmetic/operator_pre_increment_node.h"
+#include "code_generator/abstract_syntax_tree/operators/unary/bitwise/operator_bitwise_not_node.h"
+#include "code_generator/abstract_syntax_tree/operators/unary/logical/operator_not_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_access_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_allocation_node.h"
+#include "code_generator/abstract_syntax_tree/variables/array/array_assignment_node.h"
+#include "code_generator/abstract_syntax_tree/variables/assignment_node.h"
+#include "code_generator/abstract_syntax_tree/variables/declaration/global_declaration_node.h"
+#include "code_generator/abstract_syntax_tree/variables/declaration/local_declaration_node.h"
+#include "code_generator/abstract_syntax_tree/variables/variable_access_node.h"
+#include "code_generator/abstract_syntax_tree/variables/variable_node.h"
+
+#include <utility>
+
+namespace sigma {
+	/**
+	 * \brief Generates the given \a target node using the visit method of its kind. The node is dispatched by a single
+	 * switch on its kind, visits of final visitors are therefore called directly.
+	 * \tparam visitor_type Visitor to dispatch to
+	 * \param visitor Visitor instance
+	 * \param target Node to generate
+	 * \param context Code generation context of the node
+	 * \return Result of the visit, either an error or the generated value.
+	 */
+	template<typename visitor_type>
+	expected_value dispatch_node(
+		visitor_type& visitor,
+		node* target,
+		const code_generation_context& context
+	) {
+		switch (target->get_kind()) {
+		// functions
+		case node_kind::function:
+			return visitor.visit_function_node(static_cast<function_node&>(*target), context);
+		case node_kind::function_call:
+			return visitor.visit_function_call_node(static_cast<function_call_node&>(*target), context);
+		// keywords
+		case node_kind::file_include:
+			return visitor.visit_file_include_node(static_cast<file_include_node&>(*target), context);
+		// variables
+		case node_kind::assignment:
+			return visitor.visit_assignment_node(static_cast<assignment_node&>(*target), context);
+		case node_kind::variable_access:
+			return visitor.visit_variable_access_node(static_cast<variable_access_node&>(*target), context);
+		case node_kind::local_declaration:
+			return visitor.visit_local_declaration_node(static_cast<local_declaration_node&>(*target), context);
+		case node_kind::global_declaration:
+			return visitor.visit_global_declaration_node(static_cast<global_declaration_node&>(*target), context);
+		case node_kind::array_allocation:
+			return visitor.visit_allocation_node(static_cast<array_allocation_node&>(*target), context);
+		case node_kind::array_access:
+			return visitor.visit_array_access_node(static_cast<array_access_node&>(*target), context);
+		case node_kind::array_assignment:
+			return visitor.visit_array_assignment_node(static_cast<array_assignment_node&>(*target), context);
+		case node_kind::variable:
+			return visitor.visit_variable_node(static_cast<variable_node&>(*target), context);
+		// flow control
+		case node_kind::return_statement:
+			return visitor.visit_return_node(static_cast<return_node&>(*target), context);
+		case node_kind::if_else:
+			return visitor.visit_if_else_node(static_cast<if_else_node&>(*target), context);
+		case node_kind::while_loop:
+			return visitor.visit_while_node(static_cast<while_node&>(*target), context);
+		case node_kind::for_loop:
+			return visitor.visit_for_node(static_cast<for_node&>(*target), context);
+		case node_kind::break_statement:
+			return visitor.visit_break_node(static_cast<break_node&>(*target), context);
+		// types
+		case node_kind::numerical_literal:
+			return visitor.visit_numerical_literal_node(static_cast<numerical_literal_node&>(*target), context);
+		case node_kind::character_literal:
+			return visitor.visit_keyword_char_node(static_cast<char_node&>(*target), context);
+		case node_kind::string_literal:
+			return visitor.visit_keyword_string_node(static_cast<string_node&>(*target), context);
+		case node_kind::boolean_literal:
+			return visitor.visit_keyword_bool_node(static_cast<bool_node&>(*target), context);
+		case node_kind::constant:
+			return visitor.visit_constant_node(static_cast<constant_node&>(*target), context);
+		// expressions
+		case node_kind::flat_expression:
+			return visitor.visit_flat_expression_node(static_cast<flat_expression_node&>(*target), context);
+		// operators
+		// unary
+		// arithmetic
+		case node_kind::operator_post_decrement:
+			return visitor.visit_operator_post_decrement_node(static_cast<operator_post_decrement_node&>(*target), context);
+		case node_kind::operator_post_increment:
+			return visitor.visit_operator_post_increment_node(static_cast<operator_post_increment_node&>(*target), context);
+		case node_kind::operator_pre_decrement:
+			return visitor.visit_operator_pre_decrement_node(static_cast<operator_pre_decrement_node&>(*target), context);
+		case node_kind::operator_pre_increment:
+			return visitor.visit_operator_pre_increment_node(static_cast<operator_pre_increment_node&>(*target), context);
+		// bitwise
+		case node_kind::operator_bitwise_not:
+			return visitor.visit_operator_bitwise_not_node(static_cast<operator_bitwise_not_node&>(*target), context);
+		// logical
+		case node_kind::operator_not:
+			return visitor.visit_operator_not_node(static_cast<operator_not_node&>(*target), context);
+		// binary
+		// arithmetic
+		case node_kind::operator_addition_assignment:
+			return visitor.visit_operator_addition_assignment_node(static_cast<operator_addition_assignment_node&>(*target), context);
+		case node_kind::operator_addition:
+			return visitor.visit_operator_addition_node(static_cast<operator_addition_node&>(*target), context);
+		case node_kind::operator_subtraction_assignment:
+			return visitor.visit_operator_subtraction_assignment_node(static_cast<operator_subtraction_assignment_node&>(*target), context);
+		case node_kind::operator_subtraction:
+			return visitor.visit_operator_subtraction_node(static_cast<operator_subtraction_node&>(*target), context);
+		case node_kind::operator_multiplication_assignment:
+			return visitor.visit_operator_multiplication_assignment_node(static_cast<operator_multiplication_assignment_node&>(*target), context);
+		case node_kind::operator_multiplication:
+			return visitor.visit_operator_multiplication_node(static_cast<operator_multiplication_node&>(*target), context);
+		case node_kind::operator_division_assignment:
+			return visitor.visit_operator_division_assignment_node(static_cast<operator_division_assignment_node&>(*target), context);
+		case node_kind::operator_division:
+			return visitor.visit_operator_division_node(static_cast<operator_division_node&>(*target), context);
+		case node_kind::operator_modulo_assignment:
+			return visitor.visit_operator_modulo_assignment_node(static_cast<operator_modulo_assignment_node&>(*target), context);
+		case node_kind::operator_modulo:
+			return visitor.visit_operator_modulo_node(static_cast<operator_modulo_node&>(*target), context);
+		// bitwise
+		case node_kind::operator_bitwise_and:
+			return visitor.visit_operator_bitwise_and_node(static_cast<operator_bitwise_and_node&>(*target), context);
+		case node_kind::operator_bitwise_or:
+			return visitor.visit_operator_bitwise_or_node(static_cast<operator_bitwise_or_node&>(*target), context);
+		case node_kind::operator_bitwise_left_shift:
+			return visitor.visit_operator_bitwise_left_shift_node(static_cast<operator_bitwise_left_shift_node&>(*target), context);
+		case node_kind::operator_bitwise_right_shift:
+			return visitor.visit_operator_bitwise_right_shift_node(static_cast<operator_bitwise_right_shift_node&>(*target), context);
+		case node_kind::operator_bitwise_xor:
+			return visitor.visit_operator_bitwise_xor_node(static_cast<operator_bitwise_xor_node&>(*target), context);
+		// logical
+		case node_kind::operator_conjunction:
+			return visitor.visit_operator_logical_conjunction_node(static_cast<operator_conjunction_node&>(*target), context);
+		case node_kind::operator_disjunction:
+			return visitor.visit_operator_logical_disjunction_node(static_cast<operator_disjunction_node&>(*target), context);
+		case node_kind::operator_greater_than:
+			return visitor.visit_operator_greater_than_node(static_cast<operator_greater_than_node&>(*target), context);
+		case node_kind::operator_greater_than_equal_to:
+			return visitor.visit_operator_greater_than_equal_to_node(static_cast<operator_greater_than_equal_to_node&>(*target), context);
+		case node_kind::operator_less_than:
+			return visitor.visit_operator_less_than_node(static_cast<operator_less_than_node&>(*target), context);
+		case node_kind::operator_less_than_equal_to:
+			return visitor.visit_operator_less_than_equal_to_node(static_cast<operator_less_than_equal_to_node&>(*target), context);
+		case node_kind::operator_equals:
+			return visitor.visit_operator_equals_node(static_cast<operator_equals_node&>(*target), context);
+		case node_kind::operator_not_equals:
+			return visitor.visit_operator_not_equals_node(static_cast<operator_not_equals_node&>(*target), context);
+		}
+
+		std::unreachable();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,522 @@
+// winsock2.h has to be included before Windows.h
+#ifdef _WIN32
+#include <winsock2.h>
+#include <afunix.h>
+#endif
+
+#include "compile_server.h"
+
+#include <llvm/Support/ConvertUTF.h>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include <charconv>
+#include <mutex>
+#include <sstream>
+
+namespace sigma {
+	namespace {
+#ifdef _WIN32
+		using socket_handle = SOCKET;
+		constexpr socket_handle invalid_socket = INVALID_SOCKET;
+		constexpr i32 send_flags = 0;
+		constexpr i32 shutdown_send = SD_SEND;
+
+		void close_socket(socket_handle socket) {
+			closesocket(socket);
+		}
+
+		i32 get_socket_error() {
+			return WSAGetLastError();
+		}
+
+		bool is_transient_accept_error(i32 error) {
+			return error == WSAEINTR || error == WSAECONNRESET;
+		}
+#else
+		using socket_handle = i32;
+		constexpr socket_handle invalid_socket = -1;
+		// writing to a socket closed by the peer should fail instead of raising SIGPIPE
+		constexpr i32 send_flags = MSG_NOSIGNAL;
+		constexpr i32 shutdown_send = SHUT_WR;
+
+		void close_socket(socket_handle socket) {
+			close(socket);
+		}
+
+		i32 get_socket_error() {
+			return errno;
+		}
+
+		bool is_transient_accept_error(i32 error) {
+			return error == EINTR || error == ECONNABORTED;
+		}
+#endif
+
+		constexpr std::string_view compile_command = "compile";
+		constexpr std::string_view stop_command = "stop";
+
+		std::string get_socket_error_message() {
+			return std::system_category().message(get_socket_error());
+		}
+
+		void initialize_sockets() {
+#ifdef _WIN32
+			static std::once_flag sockets_initialized;
+			std::call_once(sockets_initialized, [] {
+				WSADATA data;
+				WSAStartup(MAKEWORD(2, 2), &data);
+			});
+#endif
+		}
+
+		bool create_socket_address(
+			const filepath& socket_path,
+			sockaddr_un& address
+		) {
+			const std::string path = socket_path.string();
+
+			// the path has to fit into sun_path, including its null terminator
+			if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+				return false;
+			}
+
+			address = {};
+			address.sun_family = AF_UNIX;
+			std::copy(path.begin(), path.end(), address.sun_path);
+			return true;
+		}
+
+		bool send_all(
+			socket_handle socket,
+			std::string_view data
+		) {
+			while (!data.empty()) {
+				const auto sent = ::send(socket, data.data(), static_cast<i32>(data.size()), send_flags);
+				if (sent <= 0) {
+					return false;
+				}
+
+				data.remove_prefix(static_cast<u64>(sent));
+			}
+
+			return true;
+		}
+
+		/**
+		 * \brief Receives data until the peer shuts down its side of the connection.
+		 */
+		std::optional<std::string> receive_all(
+			socket_handle socket
+		) {
+			std::string data;
+			char buffer[4096];
+
+			while (true) {
+				const auto received = recv(socket, buffer, static_cast<i32>(sizeof(buffer)), 0);
+				if (received < 0) {
+					return std::nullopt;
+				}
+
+				if (received == 0) {
+					return data;
+				}
+
+				data.append(buffer, static_cast<u64>(received));
+			}
+		}
+
+		/**
+		 * \brief Splits the given \a line into its key and value, separated by the first '='.
+		 */
+		std::pair<std::string_view, std::string_view> split_line(
+			std::string_view line
+		) {
+			const u64 separator = line.find('=');
+			if (separator == std::string_view::npos) {
+				return { line, {} };
+			}
+
+			return { line.substr(0, separator), line.substr(separator + 1) };
+		}
+
+		bool parse_number(
+			std::string_view value,
+			u64& result
+		) {
+			const char* end = value.data() + value.size();
+			const auto [position, error_code] = std::from_chars(value.data(), end, result);
+			return error_code == std::errc() && position == end;
+		}
+
+		/**
+		 * \brief Resolves a relative path against the working directory of the client, empty paths are kept.
+		 */
+		filepath resolve_path(
+			const filepath& path
+		) {
+			return path.empty() ? path : std::filesystem::absolute(path);
+		}
+	}
+
+	void compile_response::print() const {
+		std::wstring wide_diagnostics;
+		llvm::ConvertUTF8toWide(diagnostics, wide_diagnostics);
+		console::out << wide_diagnostics;
+	}
+
+	error_result compile_server::serve(
+		const filepath& socket_path
+	) {
+		initialize_sockets();
+
+		sockaddr_un address;
+		if (!create_socket_address(socket_path, address)) {
+			return error::emit<5014>(socket_path, "invalid socket path");
+		}
+
+		// a socket file left behind by a server which didn't shut down cleanly would make bind fail
+		if (exchange(socket_path, "").has_value()) {
+			return error::emit<5014>(socket_path, "another server is already listening");
+		}
+
+		std::error_code remove_error;
+		std::filesystem::remove(socket_path, remove_error);
+
+		const socket_handle listener = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (listener == invalid_socket) {
+			return error::emit<5014>(socket_path, get_socket_error_message());
+		}
+
+#ifndef _WIN32
+		// only the user running the server may connect to it, the socket is created with owner-only (0600)
+		// permissions so that there is no window in which other users could connect
+		const mode_t previous_mask = umask(S_IXUSR | S_IRWXG | S_IRWXO);
+		const bool bound = bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+		umask(previous_mask);
+#else
+		const bool bound = bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+#endif
+
+		if (!bound || listen(listener, SOMAXCONN) != 0) {
+			const std::string message = get_socket_error_message();
+			close_socket(listener);
+			return error::emit<5014>(socket_path, message);
+		}
+
+		console::out
+			<< "listening on '"
+			<< socket_path
+			<< "'\n";
+
+		bool running = true;
+		error_result serve_error;
+
+		while (running) {
+			const socket_handle connection = accept(listener, nullptr, nullptr);
+			if (connection == invalid_socket) {
+				// interrupted calls and connections aborted by the client can be retried, anything else
+				// (ie. running out of file descriptors) would fail again right away
+				if (is_transient_accept_error(get_socket_error())) {
+					continue;
+				}
+
+				serve_error = error::emit<5018>(socket_path, get_socket_error_message());
+				break;
+			}
+
+			const std::optional<std::string> message = receive_all(connection);
+
+			if (message.has_value() && !message->empty()) {
+				if (std::string_view(*message).substr(0, message->find('\n')) == stop_command) {
+					running = false;
+					send_all(connection, "0\n");
+				}
+				else {
+					const compile_response response = handle_request(*message);
+					send_all(connection, std::to_string(response.status) + '\n' + response.diagnostics);
+				}
+			}
+
+			close_socket(connection);
+		}
+
+		close_socket(listener);
+		std::filesystem::remove(socket_path, remove_error);
+		return serve_error;
+	}
+
+	std::expected<compile_response, error_msg> compile_server::send(
+		const filepath& socket_path,
+		const compile_request& request
+	) {
+		// the server may run in a different working directory
+		compile_request resolved_request = request;
+		resolved_request.source_path = resolve_path(request.source_path);
+		resolved_request.executable_directory = resolve_path(request.executable_directory);
+		resolved_request.trace_path = resolve_path(request.trace_path);
+		resolved_request.settings.cache_directory = resolve_path(request.settings.cache_directory);
+		resolved_request.settings.profile_generate = resolve_path(request.settings.profile_generate);
+		resolved_request.settings.profile_use = resolve_path(request.settings.profile_use);
+
+		const auto reply = exchange(socket_path, serialize_request(resolved_request));
+		if (!reply.has_value()) {
+			return std::unexpected(reply.error()); // return on failure
+		}
+
+		// the first line of the reply contains the status, the rest are diagnostics
+		const u64 status_end = reply->find('\n');
+		u64 status;
+
+		if (status_end == std::string::npos || !parse_number(std::string_view(*reply).substr(0, status_end), status)) {
+			return std::unexpected(error::emit<5016>(socket_path));
+		}
+
+		return compile_response{
+			static_cast<i32>(status),
+			reply->substr(status_end + 1)
+		};
+	}
+
+	error_result compile_server::stop(
+		const filepath& socket_path
+	) {
+		const auto reply = exchange(socket_path, std::string(stop_command) + '\n');
+		if (!reply.has_value()) {
+			return reply.error(); // return on failure
+		}
+
+		return {};
+	}
+
+	compile_response compile_server::handle_request(
+		std::string_view message
+	) {
+		// console output (progress, warnings and errors) is captured, and sent back to the client
+		std::wostringstream output;
+		const console_redirect output_redirect(&output);
+
+		i32 status = 1;
+
+		if (const std::optional<compile_request> request = deserialize_request(message)) {
+			compilation_options options;
+			options.source_path = request->source_path;
+			options.output_directory = request->executable_directory;
+			options.executable_name = request->executable_name;
+			options.trace_path = request->trace_path;
+			options.output = &output;
+
+			const compiler compiler(request->settings);
+
+			if (const error_result compilation_error = compiler.compile(options)) {
+				compilation_error.value()->print();
+			}
+			else {
+				status = 0;
+			}
+		}
+		else {
+			error::emit<5017>()->print();
+		}
+
+		std::string diagnostics;
+		llvm::convertWideToUTF8(output.str(), diagnostics);
+		return { status, std::move(diagnostics) };
+	}
+
+	std::string compile_server::serialize_request(
+		const compile_request& request
+	) {
+		const compiler_settings& settings = request.settings;
+		std::string message = std::string(compile_command) + '\n';
+
+		const auto append = [&](std::string_view key, const std::string& value) {
+			message.append(key).append("=").append(value).append("\n");
+		};
+
+		append("source_path", request.source_path.string());
+		append("executable_directory", request.executable_directory.string());
+		append("executable_name", request.executable_name);
+		append("trace_path", request.trace_path.string());
+		append("optimization_level", std::to_string(static_cast<u32>(settings.optimization_level)));
+		append("size_optimization_level", std::to_string(static_cast<u32>(settings.size_optimization_level)));
+		append("vectorize", std::to_string(settings.vectorize));
+		append("target_cpu", settings.target_cpu);
+		append("profile_generate", settings.profile_generate.string());
+		append("profile_use", settings.profile_use.string());
+		append("optimization_pipeline", settings.optimization_pipeline);
+		append("print_pass_statistics", std::to_string(settings.print_pass_statistics));
+		append("tokenization_mode", std::to_string(static_cast<u32>(settings.tokenization_mode)));
+		append("token_stream_capacity", std::to_string(settings.token_stream_capacity));
+		append("cache_directory", settings.cache_directory.string());
+		append("cache_size_limit", std::to_string(settings.cache_size_limit));
+		append("codegen_threads", std::to_string(settings.codegen_threads));
+		append("frontend_threads", std::to_string(settings.frontend_threads));
+		append("flatten_expressions", std::to_string(settings.flatten_expressions));
+
+		for (const std::string& function : settings.multiversioned_functions) {
+			append("multiversioned_function", function);
+		}
+
+		return message;
+	}
+
+	std::optional<compile_request> compile_server::deserialize_request(
+		std::string_view message
+	) {
+		compile_request request;
+		compiler_settings& settings = request.settings;
+		bool first_line = true;
+
+		while (!message.empty()) {
+			const u64 line_end = std::min(message.find('\n'), message.size());
+			const std::string_view line = message.substr(0, line_end);
+			message.remove_prefix(std::min(line_end + 1, message.size()));
+
+			if (first_line) {
+				if (line != compile_command) {
+					return std::nullopt;
+				}
+
+				first_line = false;
+				continue;
+			}
+
+			const auto [key, value] = split_line(line);
+			const std::string text(value);
+			u64 number = 0;
+
+			// numerical settings
+			if (
+				key == "optimization_level" ||
+				key == "size_optimization_level" ||
+				key == "vectorize" ||
+				key == "print_pass_statistics" ||
+				key == "tokenization_mode" ||
+				key == "token_stream_capacity" ||
+				key == "cache_size_limit" ||
+				key == "codegen_threads" ||
+				key == "frontend_threads" ||
+				key == "flatten_expressions"
+			) {
+				if (!parse_number(value, number)) {
+					return std::nullopt;
+				}
+			}
+
+			if (key == "source_path") {
+				request.source_path = text;
+			}
+			else if (key == "executable_directory") {
+				request.executable_directory = text;
+			}
+			else if (key == "executable_name") {
+				request.executable_name = text;
+			}
+			else if (key == "optimization_level") {
+				settings.optimization_level = static_cast<optimization_level>(number);
+			}
+			else if (key == "size_optimization_level") {
+				settings.size_optimization_level = static_cast<size_optimization_level>(number);
+			}
+			else if (key == "vectorize") {
+				settings.vectorize = number != 0;
+			}
+			else if (key == "target_cpu") {
+				settings.target_cpu = text;
+			}
+			else if (key == "multiversioned_function") {
+				settings.multiversioned_functions.push_back(text);
+			}
+			else if (key == "profile_generate") {
+				settings.profile_generate = text;
+			}
+			else if (key == "profile_use") {
+				settings.profile_use = text;
+			}
+			else if (key == "optimization_pipeline") {
+				settings.optimization_pipeline = text;
+			}
+			else if (key == "print_pass_statistics") {
+				settings.print_pass_statistics = number != 0;
+			}
+			else if (key == "trace_path") {
+				request.trace_path = text;
+			}
+			else if (key == "tokenization_mode") {
+				settings.tokenization_mode = static_cast<tokenization_mode>(number);
+			}
+			else if (key == "token_stream_capacity") {
+				settings.token_stream_capacity = number;
+			}
+			else if (key == "cache_directory") {
+				settings.cache_directory = text;
+			}
+			else if (key == "cache_size_limit") {
+				settings.cache_size_limit = number;
+			}
+			else if (key == "codegen_threads") {
+				settings.codegen_threads = static_cast<u32>(number);
+			}
+			else if (key == "frontend_threads") {
+				settings.frontend_threads = static_cast<u32>(number);
+			}
+			else if (key == "flatten_expressions") {
+				settings.flatten_expressions = number != 0;
+			}
+			else {
+				return std::nullopt;
+			}
+		}
+
+		if (first_line || request.source_path.empty()) {
+			return std::nullopt;
+		}
+
+		return request;
+	}
+
+	std::expected<std::string, error_msg> compile_server::exchange(
+		const filepath& socket_path,
+		std::string_view message
+	) {
+		initialize_sockets();
+
+		sockaddr_un address;
+		if (!create_socket_address(socket_path, address)) {
+			return std::unexpected(error::emit<5015>(socket_path, "invalid socket path"));
+		}
+
+		const socket_handle connection = socket(AF_UNIX, SOCK_STREAM, 0);
+		if (connection == invalid_socket) {
+			return std::unexpected(error::emit<5015>(socket_path, get_socket_error_message()));
+		}
+
+		if (connect(connection, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+			const std::string error_message = get_socket_error_message();
+			close_socket(connection);
+			return std::unexpected(error::emit<5015>(socket_path, error_message));
+		}
+
+		// shutting down the sending side marks the end of the message
+		if (!send_all(connection, message) || shutdown(connection, shutdown_send) != 0) {
+			const std::string error_message = get_socket_error_message();
+			close_socket(connection);
+			return std::unexpected(error::emit<5015>(socket_path, error_message));
+		}
+
+		std::optional<std::string> reply = receive_all(connection);
+		close_socket(connection);
+
+		if (!reply.has_value()) {
+			return std::unexpected(error::emit<5015>(socket_path, get_socket_error_message()));
+		}
+
+		return std::move(reply.value());
+	}
+}
\ No newline at end of file
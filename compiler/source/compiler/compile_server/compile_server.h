@@ -0,0 +1,94 @@
+#pragma once
+#include "compiler/compiler.h"
+
+namespace sigma {
+	/**
+	 * \brief Compilation requested by a client of the compile server.
+	 */
+	struct compile_request {
+		filepath source_path;
+		filepath executable_directory;
+		compiler_settings settings;
+		// file name of the generated executable
+		std::string executable_name = "a.exe";
+		// trace file of the compilation, an empty path disables tracing
+		filepath trace_path;
+	};
+
+	/**
+	 * \brief Result of a single compile request.
+	 */
+	struct compile_response {
+		// 0 if the compilation succeeded, 1 otherwise
+		i32 status = 0;
+		// console output of the compilation (UTF-8), including all warnings and errors
+		std::string diagnostics;
+
+		/**
+		 * \brief Prints the diagnostics to the console.
+		 */
+		void print() const;
+	};
+
+	/**
+	 * \brief Long-lived compiler process which accepts compile requests over a Unix domain socket. Keeping a
+	 * single process alive amortizes process startup, LLVM target registration and target machine creation
+	 * (see target_machine_pool) over all requests. Requests are compiled one at a time, in the order in which
+	 * they are accepted.
+	 */
+	class compile_server {
+	public:
+		/**
+		 * \brief Serves compile requests on the given \a socket_path until a shutdown request is received.
+		 * \param socket_path Path of the Unix domain socket to listen on
+		 * \return Optional error message containing information about a potential error.
+		 */
+		static error_result serve(
+			const filepath& socket_path
+		);
+
+		/**
+		 * \brief Sends the given \a request to the server listening on \a socket_path and waits for the
+		 * compilation to finish. Relative paths are resolved on the client, before the request is sent.
+		 * \param socket_path Path of the socket the server listens on
+		 * \param request Compilation to perform
+		 * \return Response of the server, or an error message if the server cannot be reached.
+		 */
+		static std::expected<compile_response, error_msg> send(
+			const filepath& socket_path,
+			const compile_request& request
+		);
+
+		/**
+		 * \brief Asks the server listening on \a socket_path to shut down once it finishes its current request.
+		 * \param socket_path Path of the socket the server listens on
+		 * \return Optional error message containing information about a potential error.
+		 */
+		static error_result stop(
+			const filepath& socket_path
+		);
+	private:
+		/**
+		 * \brief Compiles a single serialized request, while capturing its console output.
+		 */
+		static compile_response handle_request(
+			std::string_view message
+		);
+
+		static std::string serialize_request(
+			const compile_request& request
+		);
+
+		static std::optional<compile_request> deserialize_request(
+			std::string_view message
+		);
+
+		/**
+		 * \brief Connects to the server, sends the given \a message and receives the entire reply.
+		 */
+		static std::expected<std::string, error_msg> exchange(
+			const filepath& socket_path,
+			std::string_view message
+		);
+	};
+}
\ No newline at end of file
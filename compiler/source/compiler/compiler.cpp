@@ -1,29 +1,53 @@
 #include "compiler.h"
 
+#include "compiler/jit/tiered_jit.h"
+#include "compiler/linker/linker.h"
+#include "compiler/multiversioning/multiversioning.h"
+#include "compiler/pass_statistics/pass_statistics.h"
+#include "compiler/target_machine_pool/target_machine_pool.h"
+#include "lexer/token_stream.h"
+
 #include "lexer/char_by_char_lexer/char_by_char_lexer.h"
 #include "parser/recursive_descent_parser/recursive_descent_parser.h"
 #include "code_generator/basic_code_generator/basic_code_generator.h"
+#include "code_generator/constant_folder/constant_folder.h"
+#include "code_generator/expression_flattener/expression_flattener.h"
 
 #include "utility/timer.h"
 
 // llvm
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA256.h>
+#include <llvm/Support/ThreadPool.h>
 #include <llvm/Support/VirtualFileSystem.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Support/Host.h>
+#include <llvm/CodeGen/ParallelCG.h>
+#include <llvm/MC/MCSubtargetInfo.h>
+#include <llvm/MC/SubtargetFeature.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/MC/TargetRegistry.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/ProfileData/InstrProfReader.h>
 #include <llvm/Target/TargetMachine.h>
 #include <llvm/Target/TargetOptions.h>
-#include <llvm/Transforms/IPO.h>
-#include <llvm/Transforms/IPO/PassManagerBuilder.h>
 
 // clang
 #include <clang/Driver/Driver.h>
 #include <clang/Driver/Compilation.h>
 #include <clang/Frontend/TextDiagnosticPrinter.h>
 
+#include <mutex>
+#include <unordered_set>
+
+#include "code_generator/abstract_syntax_tree/functions/function_node.h"
 #include "code_generator/abstract_syntax_tree/keywords/file_include_node.h"
+#include "code_generator/abstract_syntax_tree/variables/declaration/global_declaration_node.h"
 
 namespace sigma {
 	compiler::compiler(
@@ -38,153 +62,629 @@ namespace sigma {
 	error_result compiler::compile(
 		const filepath& root_source_path,
 		const filepath& target_executable_directory
-	) {
-		m_root_source_path = root_source_path;
-		m_target_executable_directory = target_executable_directory;
+	) const {
+		compilation_options options;
+		options.source_path = root_source_path;
+		options.output_directory = target_executable_directory;
+		return compile(options);
+	}
+
+	error_result compiler::compile(
+		const compilation_options& options
+	) const {
+		// console output of the compilation goes to the stream requested by the caller
+		const console_redirect output_redirect(options.output);
+
+		timer compilation_timer;
+		compilation_timer.start();
+
+		compilation_context context;
+		context.root_source_path = options.source_path;
+		context.executable_path = options.output_directory / options.executable_name;
+
+		// compilation scopes are recorded into a trace if requested
+		context.compilation_trace = options.trace_path.empty() ? nullptr : std::make_shared<trace>();
+		error_result compilation_error;
+
+		{
+			const trace::scope compilation_scope(context.compilation_trace.get(), "compilation");
+			compilation_error = compile_executable(context, options.output_directory);
+		}
+
+		// the trace of a failed compilation is written as well, a trace error is only reported if nothing else
+		// failed
+		const error_result trace_error = write_trace(context, options.trace_path);
+
+		if (compilation_error) {
+			return compilation_error; // return on failure
+		}
+
+		if (trace_error) {
+			return trace_error; // return on failure
+		}
+
+		console::out
+			<< color::green
+			<< "compilation finished ("
+			<< compilation_timer.elapsed()
+			<< "ms)\n"
+			<< color::white;
+
+		return {};
+	}
+
+	std::expected<i32, error_msg> compiler::run(
+		const filepath& root_source_path
+	) const {
+		compilation_options options;
+		options.source_path = root_source_path;
+		return run(options);
+	}
+
+	std::expected<i32, error_msg> compiler::run(
+		const compilation_options& options
+	) const {
+		// console output of the compilation goes to the stream requested by the caller
+		const console_redirect output_redirect(options.output);
+
+		// instrumented code depends on the profiling runtime, which is only linked into executables
+		if (!m_settings.profile_generate.empty()) {
+			return std::unexpected(error::emit<5012>());
+		}
+
+		compilation_context context;
+		context.root_source_path = options.source_path;
+		context.compilation_trace = options.trace_path.empty() ? nullptr : std::make_shared<trace>();
+		std::expected<i32, error_msg> exit_code;
+
+		{
+			const trace::scope run_scope(context.compilation_trace.get(), "run");
+			exit_code = run_module(context);
+		}
+
+		// the trace of a failed run is written as well, a trace error is only reported if nothing else failed
+		const error_result trace_error = write_trace(context, options.trace_path);
+
+		if (!exit_code) {
+			return exit_code; // return on failure
+		}
+
+		if (trace_error) {
+			return std::unexpected(trace_error.value()); // return on failure
+		}
 
-		timer m_compilation_timer;
-		m_compilation_timer.start();
+		return exit_code;
+	}
 
+	error_result compiler::compile_executable(
+		const compilation_context& context,
+		const filepath& output_directory
+	) const {
 		// verify the root source file
 		if (auto source_file_error = verify_source_file(
-			m_root_source_path
+			context.root_source_path
 		)) {
 			return source_file_error; // return on failure
 		}
 
 		console::out
 			<< "compiling file '"
-			<< m_root_source_path
+			<< context.root_source_path
 			<< "'\n";
 
+		// verify the executable directory
+		if (auto executable_directory_error = verify_folder(
+			output_directory
+		)) {
+			return executable_directory_error; // return on failure
+		}
+
+		// every codegen thread emits its own object, objects are kept in memory until they are linked
+		std::vector<object_buffer> objects(get_codegen_thread_count());
+
+		// objects which have already been compiled can be linked right away
+		std::optional<object_cache> cache;
+		std::string cache_key;
+
+		if (!m_settings.cache_directory.empty()) {
+			const auto file_map_result = detail::map_file(context.root_source_path);
+			if (!file_map_result.has_value()) {
+				return file_map_result.error(); // return on failure
+			}
+
+			cache.emplace(m_settings.cache_directory, m_settings.cache_size_limit);
+			cache_key = get_cache_key(context, *file_map_result.value());
+		}
+
+		bool cache_hit = false;
+
+		if (cache) {
+			const trace::scope lookup_scope(context.compilation_trace.get(), "object cache lookup");
+			cache_hit = cache->lookup(cache_key, objects);
+		}
+
+		if (cache_hit) {
+			console::out << "object cache hit\n";
+		}
+		else {
+			// generate the module
+			std::vector<filepath> included_files;
+			auto module_generation_result = generate_module(
+				context,
+				context.root_source_path,
+				included_files
+			);
+
+			if (!module_generation_result) {
+				return module_generation_result.error(); // return on failure
+			}
+
+			// compile the module into objects
+			if (auto compilation_error = compile_module(
+				context,
+				module_generation_result.value(),
+				objects
+			)) {
+				return compilation_error; // return on failure
+			}
+
+			if (cache) {
+				const trace::scope store_scope(context.compilation_trace.get(), "object cache store");
+				cache->store(cache_key, objects, included_files);
+			}
+		}
+
+		// link the objects into an executable
+		if (auto link_error = link_executable(
+			context,
+			objects
+		)) {
+			return link_error; // return on failure
+		}
+
+		return {};
+	}
+
+	std::expected<i32, error_msg> compiler::run_module(
+		const compilation_context& context
+	) const {
+		// verify the root source file
+		if (auto source_file_error = verify_source_file(
+			context.root_source_path
+		)) {
+			return std::unexpected(source_file_error.value()); // return on failure
+		}
+
 		// generate the module
+		std::vector<filepath> included_files;
 		auto module_generation_result = generate_module(
-			m_root_source_path
+			context,
+			context.root_source_path,
+			included_files
 		);
 
 		if (!module_generation_result) {
-			return module_generation_result.error(); // return on failure
+			return std::unexpected(module_generation_result.error()); // return on failure
 		}
 
-		// verify the executable directory
-		if (auto executable_directory_error = verify_folder(
-			m_target_executable_directory
-		)) {
-			return executable_directory_error; // return on failure
+		const std::shared_ptr<llvm_context> llvm_context = module_generation_result.value();
+
+		auto jit_result = m_settings.tiered_jit
+			? tiered_jit::create(m_settings.tier_up_threshold)
+			: jit::create();
+
+		if (!jit_result) {
+			return std::unexpected(jit_result.error()); // return on failure
 		}
 
-		// compile the module into an executable
-		if (auto compilation_error = compile_module(
-			module_generation_result.value()
-		)) {
-			return compilation_error; // return on failure
+		const std::unique_ptr<jit> jit = std::move(jit_result.value());
+		jit->prepare_module(llvm_context);
+
+		// the tiered JIT starts out with unoptimized code, and optimizes hot functions by itself
+		if (!m_settings.tiered_jit) {
+			const trace::scope optimization_scope(context.compilation_trace.get(), "optimization");
+
+			if (auto optimization_error = optimize_module(
+				context,
+				llvm_context,
+				jit->get_target_machine()
+			)) {
+				return std::unexpected(optimization_error.value()); // return on failure
+			}
 		}
 
-		console::out
-			<< color::green
-			<< "compilation finished ("
-			<< m_compilation_timer.elapsed()
-			<< "ms)\n"
-			<< color::white;
+		if (auto add_module_error = jit->add_module(llvm_context)) {
+			return std::unexpected(add_module_error.value()); // return on failure
+		}
 
-		return {};
+		// the entry point gets compiled when it's first looked up, the execution scope covers both
+		const trace::scope execution_scope(context.compilation_trace.get(), "execution");
+		return jit->run_main();
+	}
+
+	error_result compiler::write_trace(
+		const compilation_context& context,
+		const filepath& path
+	) {
+		if (!context.compilation_trace) {
+			return {};
+		}
+
+		return context.compilation_trace->write(path);
 	}
 
 	std::expected<
 		std::shared_ptr<llvm_context>,
 		error_msg
 	> compiler::generate_module(
-		const filepath& source_path
+		const compilation_context& context,
+		const filepath& source_path,
+		std::vector<filepath>& included_files
 	) const {
-		// tokenize the source file
-		timer lexer_timer;
-		lexer_timer.start();
+		// every file is compiled into a single module, no matter how many files include it
+		std::mutex module_mutex;
+		std::map<filepath, std::unique_ptr<source_module>> modules;
+
+		const auto insert_module = [&](const filepath& path) -> source_module* {
+			const std::lock_guard lock(module_mutex);
+			auto [it, inserted] = modules.try_emplace(path);
+
+			if (!inserted) {
+				return nullptr; // the file has already been scheduled
+			}
+
+			it->second = std::make_unique<source_module>();
+			it->second->path = path;
+			return it->second.get();
+		};
+
+		// included files are processed by the worker pool, the root module is processed by the calling thread
+		llvm::ThreadPool thread_pool(llvm::hardware_concurrency(m_settings.frontend_threads));
+
+		std::function<void(source_module&)> parse_task = [&](source_module& module) {
+			module.error = parse_module(context, module);
+
+			if (module.error) {
+				return;
+			}
+
+			// files included by the module are parsed as soon as they're discovered
+			for (const filepath& include : module.includes) {
+				if (source_module* included_module = insert_module(include)) {
+					thread_pool.async([&parse_task, included_module] {
+						const console_redirect output_redirect(&included_module->output);
+						parse_task(*included_module);
+					});
+				}
+			}
+		};
+
+		source_module& root_module = *insert_module(std::filesystem::weakly_canonical(source_path));
+		parse_task(root_module);
+		thread_pool.wait();
+
+		// order the modules by their distance from the root module, so that diagnostics and the layout of the
+		// linked module don't depend on the order in which the modules were processed
+		std::vector<source_module*> module_order = { &root_module };
+		std::unordered_set<const source_module*> ordered_modules = { &root_module };
+
+		for (u64 i = 0; i < module_order.size(); i++) {
+			for (const filepath& include : module_order[i]->includes) {
+				source_module* included_module = modules.at(include).get();
+
+				if (ordered_modules.insert(included_module).second) {
+					module_order.push_back(included_module);
+				}
+			}
+		}
+
+		for (source_module* module : module_order) {
+			console::out << module->output.str();
+			module->output.str(L"");
+
+			if (module->error) {
+				return std::unexpected(module->error.value()); // return on failure
+			}
 
+			module->syntax_tree->print_nodes();
+
+			if (module != &root_module) {
+				included_files.push_back(module->path);
+			}
+		}
+
+		// the modules are linked into a single module, top level definitions have to be unique across them
+		std::unordered_set<std::string> function_names;
+		std::unordered_set<std::string> global_names;
+
+		for (source_module* module : module_order) {
+			for (node* n : *module->syntax_tree) {
+				if (const auto* function = dynamic_cast<function_node*>(n)) {
+					if (!function_names.insert(function->get_function_identifier().get_name()).second) {
+						return std::unexpected(error::emit<4000>(
+							function->get_declared_location(),
+							function->get_function_identifier().get_name()
+						)); // return on failure
+					}
+				}
+				else if (const auto* global = dynamic_cast<global_declaration_node*>(n)) {
+					if (!global_names.insert(global->get_declaration_identifier().get_name()).second) {
+						return std::unexpected(error::emit<4006>(
+							global->get_declared_location(),
+							global->get_declaration_identifier().get_name()
+						)); // return on failure
+					}
+				}
+			}
+		}
+
+		// every module imports the functions of all modules it includes, directly or indirectly
+		const auto get_imported_functions = [&](const source_module& module) {
+			std::vector<std::pair<std::string, function_declaration_ptr>> imported_functions;
+			std::vector<const source_module*> reachable_modules = { &module };
+			std::unordered_set<const source_module*> visited_modules = { &module };
+
+			for (u64 i = 0; i < reachable_modules.size(); i++) {
+				for (const filepath& include : reachable_modules[i]->includes) {
+					const source_module* included_module = modules.at(include).get();
+
+					if (!visited_modules.insert(included_module).second) {
+						continue;
+					}
+
+					reachable_modules.push_back(included_module);
+					imported_functions.insert(
+						imported_functions.end(),
+						included_module->exported_functions.begin(),
+						included_module->exported_functions.end()
+					);
+				}
+			}
+
+			return imported_functions;
+		};
+
+		// independent modules are generated concurrently
+		for (source_module* module : module_order) {
+			if (module == &root_module) {
+				continue;
+			}
+
+			thread_pool.async([&, module] {
+				const console_redirect output_redirect(&module->output);
+				module->error = generate_module_code(context, *module, get_imported_functions(*module), false);
+			});
+		}
+
+		root_module.error = generate_module_code(context, root_module, get_imported_functions(root_module), true);
+		thread_pool.wait();
+
+		for (source_module* module : module_order) {
+			console::out << module->output.str();
+
+			if (module->error) {
+				return std::unexpected(module->error.value()); // return on failure
+			}
+		}
+
+		const std::shared_ptr<llvm_context> llvm_context = root_module.generated_module;
+
+		if (module_order.size() == 1) {
+			return llvm_context;
+		}
+
+		// link the included modules into the root module
+		const trace::scope linking_scope(context.compilation_trace.get(), "module linking");
+		llvm::Linker linker(*llvm_context->get_module());
+
+		for (source_module* module : module_order) {
+			if (module == &root_module) {
+				continue;
+			}
+
+			const llvm::MemoryBufferRef bitcode(
+				llvm::StringRef(module->bitcode.data(), module->bitcode.size()),
+				module->path.string()
+			);
+
+			// the bitcode has been written by the worker thread, reading it back cannot fail
+			std::unique_ptr<llvm::Module> included_module = llvm::cantFail(
+				llvm::parseBitcodeFile(bitcode, llvm_context->get_context())
+			);
+
+			if (linker.linkInModule(std::move(included_module))) {
+				return std::unexpected(error::emit<4016>()); // return on failure
+			}
+		}
+
+		linking_scope.add_counter("modules", static_cast<i64>(module_order.size()));
+		return llvm_context;
+	}
+
+	error_result compiler::parse_module(
+		const compilation_context& context,
+		source_module& module
+	) const {
+		if (auto source_file_error = verify_source_file(
+			module.path
+		)) {
+			return source_file_error; // return on failure
+		}
+
+		// identifiers are interned once, all later stages refer to them by their symbols
+		module.symbols = std::make_shared<symbol_table>();
+
+		// tokenize the source file
 		const std::shared_ptr<lexer> lexer = m_lexer_generator();
+		lexer->set_symbol_table(module.symbols);
+
 		if(auto set_source_error = lexer->set_source_filepath(
-			source_path
+			module.path
 		)) {
-			return std::unexpected(set_source_error.value());
+			return set_source_error;
 		}
 
-		if (auto tokenization_error = lexer->tokenize()) {
-			return std::unexpected(
-				tokenization_error.value()
-			); // return on failure 
+		token_list tokens;
+		std::shared_ptr<token_stream> stream;
+
+		if (m_settings.tokenization_mode == tokenization_mode::complete) {
+			const trace::scope lexing_scope(context.compilation_trace.get(), "lexing");
+
+			if (auto tokenization_error = lexer->tokenize()) {
+				return tokenization_error; // return on failure 
+			}
+
+			tokens = lexer->get_token_list();
+			lexing_scope.add_counter("tokens", static_cast<i64>(lexer->get_token_count()));
 		}
+		else {
+			// tokens are lexed while the parser consumes them
+			stream = std::make_shared<token_stream>(
+				lexer,
+				m_settings.token_stream_capacity,
+				m_settings.tokenization_mode == tokenization_mode::streamed_threaded
+			);
 
-		console::out
-			<< "lexing finished ("
-			<< lexer_timer.elapsed()
-			<< "ms)\n";
+			tokens = token_list(stream);
+		}
 
 		// generate the AST
-		timer parser_timer;
-		parser_timer.start();
-
 		const std::shared_ptr<parser> parser = m_parser_generator();
-		parser->set_token_list(
-			lexer->get_token_list()
-		);
+		parser->set_token_list(tokens);
+
+		{
+			// streamed tokens are lexed while they are being parsed
+			const trace::scope parsing_scope(context.compilation_trace.get(), stream ? "lexing and parsing" : "parsing");
+			const error_result parser_error = parser->parse();
+
+			// lexer errors cause the parser to fail as well, report the original error
+			if (stream) {
+				if (auto tokenization_error = stream->get_error()) {
+					return tokenization_error; // return on failure 
+				}
+			}
+
+			if (parser_error) {
+				return parser_error; // return on failure 
+			}
 
-		if (auto parser_error = parser->parse()) {
-			return std::unexpected(
-				parser_error.value()
-			); // return on failure 
+			// the parser has consumed the last token, the lexer has finished
+			if (stream) {
+				parsing_scope.add_counter("tokens", static_cast<i64>(lexer->get_token_count()));
+			}
+
+			parsing_scope.add_counter(
+				"nodes",
+				static_cast<i64>(parser->get_abstract_syntax_tree()->get_node_count())
+			);
 		}
 
-		console::out
-			<< "parsing finished ("
-			<< parser_timer.elapsed()
-			<< "ms)\n";
+		module.syntax_tree = parser->get_abstract_syntax_tree();
+
+		{
+			// convert literals and fold constant expressions before the code generator sees them
+			const trace::scope folding_scope(context.compilation_trace.get(), "constant folding");
+			constant_folder folder(module.syntax_tree);
+
+			if (auto folding_error = folder.fold()) {
+				return folding_error; // return on failure 
+			}
 
-		// 
-		for(node* n : *parser->get_abstract_syntax_tree()) {
+			folding_scope.add_counter("folded nodes", static_cast<i64>(folder.get_folded_node_count()));
+		}
+
+		if (m_settings.flatten_expressions) {
+			// operator expressions are generated from the flat expression table of the tree
+			const trace::scope flattening_scope(context.compilation_trace.get(), "expression flattening");
+			expression_flattener flattener(module.syntax_tree);
+			flattener.flatten();
+
+			flattening_scope.add_counter(
+				"flattened expressions",
+				static_cast<i64>(flattener.get_flattened_expression_count())
+			);
+		}
+
+		for(node* n : *module.syntax_tree) {
+			// included files are resolved relative to the including file
 			if(const auto* include = dynamic_cast<file_include_node*>(n)) {
-				console::out
-					<< color::red
-					<< include->get_path()
-					<< color::white
-					<< '\n';
+				module.includes.push_back(
+					std::filesystem::weakly_canonical(module.path.parent_path() / include->get_path())
+				);
+			}
+			// functions are exported under their name, since every module interns identifiers into its own table
+			else if (const auto* function = dynamic_cast<function_node*>(n)) {
+				std::vector<std::pair<std::string, type>> arguments;
+				for (const auto& [argument_name, argument_type] : function->get_function_arguments()) {
+					arguments.emplace_back(argument_name.get_name(), argument_type);
+				}
+
+				module.exported_functions.emplace_back(
+					function->get_function_identifier().get_name(),
+					std::make_shared<function_declaration>(
+						function->get_function_return_type(),
+						arguments,
+						function->is_var_arg(),
+						function->get_function_identifier().get_name()
+					)
+				);
 			}
 		}
 
-		parser->get_abstract_syntax_tree()->print_nodes();
+		return {};
+	}
 
-		// generate the module
-		timer code_generator_timer;
-		code_generator_timer.start();
+	error_result compiler::generate_module_code(
+		const compilation_context& context,
+		source_module& module,
+		std::vector<std::pair<std::string, function_declaration_ptr>> imported_functions,
+		bool is_root_module
+	) const {
+		const trace::scope codegen_scope(context.compilation_trace.get(), "codegen");
 		const std::shared_ptr<code_generator> code_generator = m_code_generator_generator();
-		code_generator->set_abstract_syntax_tree(
-			parser->get_abstract_syntax_tree()
-		);
+		code_generator->set_abstract_syntax_tree(module.syntax_tree);
+		code_generator->set_symbol_table(module.symbols);
+		code_generator->set_trace(context.compilation_trace);
+		code_generator->set_imported_functions(std::move(imported_functions));
+		code_generator->set_root_module(is_root_module);
 
 		if (auto visitor_error_message = code_generator->generate()) {
-			return std::unexpected(
-				visitor_error_message.value()
-			); // return on failure 
+			return visitor_error_message; // return on failure 
 		}
 
-		console::out
-			<< "codegen finished ("
-			<< code_generator_timer.elapsed()
-			<< "ms)\n";
+		codegen_scope.add_counter(
+			"instructions",
+			static_cast<i64>(code_generator->get_llvm_context()->get_module()->getInstructionCount())
+		);
+
+		// included modules are linked into the root module, which lives in a different LLVM context
+		if (!is_root_module) {
+			llvm::raw_svector_ostream bitcode_stream(module.bitcode);
+			llvm::WriteBitcodeToFile(*code_generator->get_llvm_context()->get_module(), bitcode_stream);
+			return {};
+		}
 
 		// code_generator->get_llvm_context()->print_intermediate_representation();
-		return code_generator->get_llvm_context();
+		module.generated_module = code_generator->get_llvm_context();
+		return {};
 	}
 
 	error_result compiler::compile_module(
-		const std::shared_ptr<llvm_context>& llvm_context
+		const compilation_context& context,
+		const std::shared_ptr<llvm_context>& llvm_context,
+		std::vector<object_buffer>& objects
 	) const {
 		const std::string target_triple = llvm::sys::getDefaultTargetTriple();
 
-		// initialize LLVM targets
-		llvm::InitializeAllTargetInfos();
-		llvm::InitializeAllTargets();
-		llvm::InitializeAllTargetMCs();
-		llvm::InitializeAllAsmParsers();
-		llvm::InitializeAllAsmPrinters();
+		// initialize LLVM targets, target registration is process-wide and only happens once per process
+		static std::once_flag targets_initialized;
+		std::call_once(targets_initialized, [] {
+			llvm::InitializeAllTargetInfos();
+			llvm::InitializeAllTargets();
+			llvm::InitializeAllTargetMCs();
+			llvm::InitializeAllAsmParsers();
+			llvm::InitializeAllAsmPrinters();
+		});
 
 		// create the target machine 
 		std::string error;
@@ -193,19 +693,41 @@ namespace sigma {
 			error
 		);
 
-		constexpr auto cpu = "generic";
-		constexpr auto features = "";
-
-		const llvm::TargetOptions target_options;
-		constexpr auto relocation_model = llvm::Optional<llvm::Reloc::Model>();
-		const auto target_machine = target->createTargetMachine(
-			target_triple,
-			cpu,
-			features,
-			target_options, 
-			relocation_model
-		);
+		std::string cpu;
+		std::string features;
+		std::tie(cpu, features) = get_target_cpu();
+
+		// validate the CPU before a target machine for it gets created, and pooled (the subtarget info is created
+		// for the default CPU, so that LLVM doesn't print a warning of its own for unknown CPUs)
+		{
+			const std::unique_ptr<llvm::MCSubtargetInfo> subtarget_info(
+				target->createMCSubtargetInfo(target_triple, "", "")
+			);
+
+			if (!subtarget_info || !subtarget_info->isCPUStringValid(cpu)) {
+				return error::emit<5009>(cpu);
+			}
+		}
+
+		// target machines aren't thread safe, every codegen thread creates its own
+
+		const auto create_target_machine = [&] {
+			const llvm::TargetOptions target_options;
+			constexpr auto relocation_model = llvm::Optional<llvm::Reloc::Model>();
+			return std::unique_ptr<llvm::TargetMachine>(target->createTargetMachine(
+				target_triple,
+				cpu,
+				features,
+				target_options, 
+				relocation_model
+			));
+		};
 
+		// the target machine used for optimization and single threaded emission is reused between compilations
+		const target_machine_pool::handle target_machine = target_machine_pool::acquire(
+			target_triple + ' ' + cpu + ' ' + features,
+			create_target_machine
+		);
 
 		llvm_context->get_module()->setDataLayout(
 			target_machine->createDataLayout()
@@ -215,57 +737,295 @@ namespace sigma {
 			target_triple
 		);
 
-		const std::string o_file = m_target_executable_directory.string() + "a.o";
-		const std::string exe_file = m_target_executable_directory.string() + "a.exe";
+		// split code generation treats targets which cannot emit object files as fatal errors, check for them
+		// beforehand
+		{
+			llvm::legacy::PassManager pass_manager;
+			llvm::raw_null_ostream dest;
+
+			if (target_machine->addPassesToEmitFile(
+				pass_manager,
+				dest, 
+				nullptr,
+				llvm::CGFT_ObjectFile
+			)) {
+				return error::emit<5000>();
+			}
+		}
+
+		// multiversioned functions are dispatched using ifuncs, which are specific to ELF
+		if (!m_settings.multiversioned_functions.empty()) {
+			const llvm::Triple triple(target_triple);
+
+			if (triple.getArch() == llvm::Triple::x86_64 && triple.isOSBinFormatELF()) {
+				if (auto multiversioning_error = multiversioning::apply(
+					*llvm_context->get_module(),
+					m_settings.multiversioned_functions
+				)) {
+					return multiversioning_error; // return on failure
+				}
+			}
+			else {
+				warning::emit<3500>(target_triple)->print();
+			}
+		}
 
-		// generate the .o file
+		// optimize the entire module before splitting it, so that optimizations (ie. inlining) aren't limited
+		// by partition boundaries
 		{
-			std::error_code error_code;
-			llvm::raw_fd_ostream dest(
-				o_file, 
-				error_code, 
-				llvm::sys::fs::OF_None
+			const trace::scope optimization_scope(context.compilation_trace.get(), "optimization");
+
+			if (auto optimization_error = optimize_module(
+				context,
+				llvm_context,
+				target_machine.get()
+			)) {
+				return optimization_error; // return on failure
+			}
+
+			optimization_scope.add_counter(
+				"instructions",
+				static_cast<i64>(llvm_context->get_module()->getInstructionCount())
 			);
+		}
+
+		const trace::scope emission_scope(context.compilation_trace.get(), "emission");
+
+		// objects are emitted straight into memory
+		std::vector<std::unique_ptr<llvm::raw_svector_ostream>> destinations;
+		std::vector<llvm::raw_pwrite_stream*> destination_streams;
 
+		for (object_buffer& object : objects) {
+			object.clear();
+			destinations.push_back(std::make_unique<llvm::raw_svector_ostream>(object));
+			destination_streams.push_back(destinations.back().get());
+		}
+
+		if (destination_streams.size() == 1) {
+			// a single destination compiles the module on the current thread, using the pooled target machine
 			llvm::legacy::PassManager pass_manager;
-			llvm::PassManagerBuilder builder;
-
-			// add optimization passes
-			builder.OptLevel = static_cast<u32>(m_settings.optimization_level);
-			builder.SizeLevel = static_cast<u32>(m_settings.size_optimization_level);
-			builder.Inliner = llvm::createFunctionInliningPass(
-				builder.OptLevel, 
-				builder.SizeLevel,
-				false
+
+			target_machine->addPassesToEmitFile(
+				pass_manager,
+				*destination_streams.front(),
+				nullptr,
+				llvm::CGFT_ObjectFile
 			);
 
-			builder.LoopVectorize = m_settings.vectorize;
-			builder.SLPVectorize = m_settings.vectorize;
-			builder.populateModulePassManager(
-				pass_manager
+			pass_manager.run(*llvm_context->get_module());
+		}
+		else {
+			// the module is partitioned by function, each partition gets compiled on its own thread
+			llvm::splitCodeGen(
+				*llvm_context->get_module(),
+				destination_streams,
+				{},
+				create_target_machine,
+				llvm::CGFT_ObjectFile
 			);
+		}
 
-			if (target_machine->addPassesToEmitFile(
+		i64 emitted_byte_count = 0;
+		for (const object_buffer& object : objects) {
+			emitted_byte_count += static_cast<i64>(object.size());
+		}
+
+		emission_scope.add_counter("bytes", emitted_byte_count);
+		emission_scope.add_counter("partitions", static_cast<i64>(objects.size()));
+
+		return {};
+	}
+
+	error_result compiler::optimize_module(
+		const compilation_context& context,
+		const std::shared_ptr<llvm_context>& llvm_context,
+		llvm::TargetMachine* target_machine
+	) const {
+		llvm::LoopAnalysisManager loop_analysis_manager;
+		llvm::FunctionAnalysisManager function_analysis_manager;
+		llvm::CGSCCAnalysisManager cgscc_analysis_manager;
+		llvm::ModuleAnalysisManager module_analysis_manager;
+
+		llvm::PipelineTuningOptions tuning_options;
+		tuning_options.LoopVectorization = m_settings.vectorize;
+		tuning_options.SLPVectorization = m_settings.vectorize;
+
+		llvm::PassInstrumentationCallbacks callbacks;
+		pass_statistics statistics(context.compilation_trace.get());
+
+		if (m_settings.print_pass_statistics || context.compilation_trace) {
+			statistics.register_callbacks(callbacks);
+		}
+
+		std::optional<llvm::PGOOptions> pgo_options;
+
+		if (!m_settings.profile_generate.empty()) {
+			if (!m_settings.profile_use.empty()) {
+				return error::emit<5010>();
+			}
+
+			pgo_options = llvm::PGOOptions(
+				m_settings.profile_generate.string(),
+				"",
+				"",
+				llvm::PGOOptions::IRInstr
+			);
+		}
+		else if (!m_settings.profile_use.empty()) {
+			// the profile loader treats unreadable profiles as fatal errors, check the profile beforehand
+			auto profile_reader = llvm::IndexedInstrProfReader::create(m_settings.profile_use.string());
+			if (!profile_reader) {
+				return error::emit<5011>(
+					m_settings.profile_use,
+					llvm::toString(profile_reader.takeError())
+				);
+			}
+
+			pgo_options = llvm::PGOOptions(
+				m_settings.profile_use.string(),
+				"",
+				"",
+				llvm::PGOOptions::IRUse
+			);
+		}
+
+		llvm::PassBuilder pass_builder(
+			target_machine,
+			tuning_options,
+			pgo_options,
+			&callbacks
+		);
+
+		pass_builder.registerModuleAnalyses(module_analysis_manager);
+		pass_builder.registerCGSCCAnalyses(cgscc_analysis_manager);
+		pass_builder.registerFunctionAnalyses(function_analysis_manager);
+		pass_builder.registerLoopAnalyses(loop_analysis_manager);
+		pass_builder.crossRegisterProxies(
+			loop_analysis_manager,
+			function_analysis_manager,
+			cgscc_analysis_manager,
+			module_analysis_manager
+		);
+
+		llvm::ModulePassManager pass_manager;
+
+		if (!m_settings.optimization_pipeline.empty()) {
+			if (llvm::Error pipeline_error = pass_builder.parsePassPipeline(
 				pass_manager,
-				dest, 
-				nullptr,
-				llvm::CGFT_ObjectFile
+				m_settings.optimization_pipeline
 			)) {
-				return error::emit<5000>();
+				return error::emit<5002>(
+					m_settings.optimization_pipeline,
+					llvm::toString(std::move(pipeline_error))
+				);
+			}
+		}
+		else {
+			const llvm::OptimizationLevel level = get_optimization_level();
+
+			if (level == llvm::OptimizationLevel::O0) {
+				pass_manager = pass_builder.buildO0DefaultPipeline(level);
 			}
+			else {
+				pass_manager = pass_builder.buildPerModuleDefaultPipeline(level);
+			}
+		}
+
+		pass_manager.run(
+			*llvm_context->get_module(),
+			module_analysis_manager
+		);
+
+		if (m_settings.print_pass_statistics) {
+			statistics.print();
+		}
+
+		return {};
+	}
+
+	llvm::OptimizationLevel compiler::get_optimization_level() const {
+		// size optimizations are only applied to optimized builds, and take precedence over speed
+		// optimizations
+		if (m_settings.optimization_level == optimization_level::none) {
+			return llvm::OptimizationLevel::O0;
+		}
+
+		switch (m_settings.size_optimization_level) {
+		case size_optimization_level::high:
+			return llvm::OptimizationLevel::Oz;
+		case size_optimization_level::medium:
+			return llvm::OptimizationLevel::Os;
+		case size_optimization_level::none:
+			break;
+		}
+
+		switch (m_settings.optimization_level) {
+		case optimization_level::low:
+			return llvm::OptimizationLevel::O1;
+		case optimization_level::medium:
+			return llvm::OptimizationLevel::O2;
+		default:
+			return llvm::OptimizationLevel::O3;
+		}
+	}
 
-			pass_manager.run(
-				*llvm_context->get_module()
+	std::pair<std::string, std::string> compiler::get_target_cpu() const {
+		if (m_settings.target_cpu != "native") {
+			return { m_settings.target_cpu, "" };
+		}
+
+		// the host CPU name alone doesn't cover features which differ between CPUs of the same model (ie.
+		// AVX-512 on some hybrid CPUs)
+		llvm::SubtargetFeatures features;
+		llvm::StringMap<bool> host_features;
+
+		if (llvm::sys::getHostCPUFeatures(host_features)) {
+			for (const auto& feature : host_features) {
+				features.AddFeature(feature.first(), feature.second);
+			}
+		}
+
+		return { llvm::sys::getHostCPUName().str(), features.getString() };
+	}
+
+	error_result compiler::link_executable(
+		const compilation_context& context,
+		const std::vector<object_buffer>& objects
+	) const {
+		const std::string target_triple = llvm::sys::getDefaultTargetTriple();
+		const std::string exe_file = context.executable_path.string();
+		const trace::scope linking_scope(context.compilation_trace.get(), "linking");
+
+#ifdef __linux__
+		// ELF executables are linked in-process, straight from the in-memory objects
+		if (const llvm::Triple triple(target_triple); triple.isOSBinFormatELF()) {
+			return linker::link(objects, exe_file, triple, !m_settings.profile_generate.empty());
+		}
+#endif
+
+		// other targets are linked by the clang driver, which reads the objects from disk
+		std::vector<filepath> object_files;
+
+		for (u64 i = 0; i < objects.size(); ++i) {
+			object_files.emplace_back(
+				context.executable_path.parent_path() /
+				(context.executable_path.stem().string() + std::to_string(i) + ".o")
 			);
 
-			dest.flush();
+			std::ofstream file(object_files.back(), std::ios::binary | std::ios::trunc);
+			if (!file.write(objects[i].data(), static_cast<std::streamsize>(objects[i].size()))) {
+				return error::emit<1000>(object_files.back());
+			}
 		}
 
 		// compile the .o file with clang
-		// create the compiler 
+		// create the compiler, diagnostics are forwarded to the console output of the compilation, which may
+		// be redirected
+		std::string driver_diagnostics;
+		llvm::raw_string_ostream driver_diagnostic_stream(driver_diagnostics);
 		const llvm::IntrusiveRefCntPtr diagnostic_options = new clang::DiagnosticOptions;
 		auto* diagnostic_client = new clang::TextDiagnosticPrinter(
-			llvm::errs(), 
+			driver_diagnostic_stream, 
 			&*diagnostic_options
 		);
 
@@ -286,13 +1046,27 @@ namespace sigma {
 		);
 
 		// generate clang arguments
-		const std::vector argument_vector{
-			"-g",
-			o_file.c_str(),
-			"-o",
-			exe_file.c_str()
+		std::vector<std::string> object_file_strings;
+		for (const filepath& object_file : object_files) {
+			object_file_strings.push_back(object_file.string());
+		}
+
+		std::vector<const char*> argument_vector{
+			"-g"
 		};
 
+		// link the profiling runtime
+		if (!m_settings.profile_generate.empty()) {
+			argument_vector.push_back("-fprofile-generate");
+		}
+
+		for (const std::string& object_file : object_file_strings) {
+			argument_vector.push_back(object_file.c_str());
+		}
+
+		argument_vector.push_back("-o");
+		argument_vector.push_back(exe_file.c_str());
+
 		// run the compiler 
 		const llvm::ArrayRef arguments(
 			argument_vector
@@ -302,27 +1076,99 @@ namespace sigma {
 			driver.BuildCompilation(arguments)
 		);
 
+		// output of the commands run by the driver is collected in a log file next to the executable
+		const std::string command_log_file = (
+			context.executable_path.parent_path() /
+			(context.executable_path.stem().string() + ".log")
+		).string();
+
 		// check for compilation errors
 		if (compilation) {
 			if (compilation->containsError()) {
 				error::emit<5001>();
 			}
 
+			const llvm::StringRef command_log = command_log_file;
+			compilation->Redirect({ std::nullopt, command_log, command_log });
+
 			llvm::SmallVector<std::pair<i32, const clang::driver::Command*>, 4> failing_commands;
 			driver.ExecuteCompilation(
 				*compilation,
 				failing_commands
 			);
+
+			if (const auto command_output = detail::read_file(command_log_file)) {
+				console::out << command_output.value();
+			}
+
+			detail::delete_file(command_log_file);
 		}
 
-		// delete the .o file
-		if (!detail::delete_file(o_file)) {
-			return error::emit<1001>(o_file);
+		if (!driver_diagnostic_stream.str().empty()) {
+			console::out << driver_diagnostic_stream.str();
+		}
+
+		// delete the .o files
+		for (const filepath& object_file : object_files) {
+			if (!detail::delete_file(object_file)) {
+				return error::emit<1001>(object_file);
+			}
 		}
 
 		return {};
 	}
 
+	std::string compiler::get_cache_key(
+		const compilation_context& context,
+		const source_file& source
+	) const {
+		// every setting which affects the generated object has to be part of the key
+		const auto [cpu, features] = get_target_cpu();
+		std::string settings =
+			std::to_string(static_cast<u32>(m_settings.optimization_level)) + ' ' +
+			std::to_string(static_cast<u32>(m_settings.size_optimization_level)) + ' ' +
+			std::to_string(m_settings.vectorize) + ' ' +
+			std::to_string(get_codegen_thread_count()) + ' ' +
+			m_settings.optimization_pipeline + ' ' +
+			cpu + ' ' +
+			features + ' ' +
+			m_settings.profile_generate.string();
+
+		for (const std::string& function : m_settings.multiversioned_functions) {
+			settings += ' ' + function;
+		}
+
+		// includes are resolved relative to the source file, identical sources in different directories may
+		// therefore depend on different files
+		const std::string directory = std::filesystem::absolute(context.root_source_path).parent_path().string();
+		const std::string_view contents = source.get_source();
+
+		llvm::SHA256 hash;
+		hash.update(compiler_version);
+		hash.update(llvm::sys::getDefaultTargetTriple());
+		hash.update(settings);
+		hash.update(directory);
+
+		// profiles change the generated code without changing the source
+		if (!m_settings.profile_use.empty()) {
+			if (const auto profile = llvm::MemoryBuffer::getFile(m_settings.profile_use.string())) {
+				hash.update((*profile)->getBuffer());
+			}
+		}
+
+		hash.update(llvm::StringRef(contents.data(), contents.size()));
+
+		return llvm::toHex(hash.final(), true);
+	}
+
+	u32 compiler::get_codegen_thread_count() const {
+		if (m_settings.codegen_threads == 0) {
+			return std::max(std::thread::hardware_concurrency(), 1u);
+		}
+
+		return m_settings.codegen_threads;
+	}
+
 	error_result compiler::verify_source_file(
 		const filepath& path
 	) {
@@ -3,8 +3,20 @@
 #include "lexer/lexer.h"
 #include "parser/parser.h"
 #include "code_generator/code_generator.h"
+#include "compiler/trace/trace.h"
+#include "compiler/object_cache/object_cache.h"
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Passes/OptimizationLevel.h>
+#include <llvm/Target/TargetMachine.h>
+
+#include <sstream>
 
 namespace sigma {
+	// compiler version, part of the object cache key so that objects generated by different versions of the
+	// compiler are never mixed
+	constexpr auto compiler_version = "0.1.0 (" __DATE__ " " __TIME__ ")";
+
 	enum class optimization_level {
 		none = 0,
 		low = 1,
@@ -18,6 +30,15 @@ namespace sigma {
 		high = 2
 	};
 
+	enum class tokenization_mode {
+		// tokenize the entire source file before parsing it
+		complete = 0,
+		// lex tokens on demand while they are being parsed
+		streamed = 1,
+		// lex tokens on a separate thread while they are being parsed
+		streamed_threaded = 2
+	};
+
 	struct compiler_settings {
 		// optimization level, higher optimization levels can result in higher performance
 		optimization_level optimization_level = optimization_level::none;
@@ -25,10 +46,103 @@ namespace sigma {
 		size_optimization_level size_optimization_level = size_optimization_level::none;
 		// vectorize loops and enable auto vectorization 
 		bool vectorize = false;
+		// CPU the generated code targets (ie. "x86-64-v3"), "native" targets the CPU of the host including all of
+		// its features, "generic" runs on every CPU of the target architecture
+		std::string target_cpu = "generic";
+		// functions which are additionally compiled for the x86-64-v2, x86-64-v3 and x86-64-v4 ISA levels, the
+		// best version supported by the CPU gets selected when the executable is loaded (x86-64 ELF targets only)
+		std::vector<std::string> multiversioned_functions;
+		// instrument the executable for profile-guided optimization, running it writes a raw profile to the given
+		// path ("%m" is replaced by a signature of the executable), raw profiles are merged into a .profdata file
+		// using 'llvm-profdata merge'
+		filepath profile_generate;
+		// merged profile (.profdata) of an instrumented executable, guides branch weights, inlining and function
+		// layout
+		filepath profile_use;
+		// custom optimization pipeline in LLVM's textual pipeline format (ie. "function(sroa,instcombine)"),
+		// replaces the default pipeline selected by the optimization levels when not empty
+		std::string optimization_pipeline;
+		// print the time spent in every optimization pass, and the change in instruction count it caused
+		bool print_pass_statistics = false;
+		// streamed tokenization keeps the number of tokens held in memory bounded
+		tokenization_mode tokenization_mode = tokenization_mode::complete;
+		// number of tokens a token stream holds at once (has to be a power of 2), limits the parser lookahead
+		u64 token_stream_capacity = 4096;
+		// directory used for caching object files between compilations, an empty path disables the cache
+		filepath cache_directory;
+		// maximum size of the object cache in bytes, least recently used objects are evicted first
+		u64 cache_size_limit = 1ull << 30;
+		// number of threads used for backend code generation, the module is split into one partition per
+		// thread, 0 uses all available hardware threads
+		u32 codegen_threads = 1;
+		// number of threads which lex, parse and generate the modules of included files, every file is compiled
+		// into its own module, independent modules are processed concurrently, 0 uses all available hardware
+		// threads
+		u32 frontend_threads = 0;
+		// store operator expressions in the flat expression table of the abstract syntax tree and generate them
+		// from there, instead of generating them from the tree itself (the generated code is the same)
+		bool flatten_expressions = false;
+		// run programs using tiered compilation, functions are first compiled without optimizations and
+		// recompiled with full optimizations on a background thread once they become hot
+		bool tiered_jit = false;
+		// number of calls and loop iterations after which a function is considered hot
+		u64 tier_up_threshold = 10000;
 	};
 
 	/**
-	 * \brief Compiler instance, used for compiling sigma files into an executable.
+	 * \brief Inputs and outputs of a single compilation. Unlike the compiler settings, options aren't shared
+	 * between compilations, outputs of concurrent compilations therefore never collide.
+	 */
+	struct compilation_options {
+		// root source file of the compilation
+		filepath source_path;
+		// directory the executable is written to
+		filepath output_directory;
+		// file name of the generated executable, temporary object files are named after it ("<name>0.o", ...)
+		std::string executable_name = "a.exe";
+		// stream which receives the console output and warnings of the compilation (including the output of
+		// the linker), the console is used when no stream is given
+		std::wostream* output = nullptr;
+		// path of a Chrome trace_event JSON file the compilation profile is written to, failed compilations are
+		// traced as well, an empty path disables tracing
+		filepath trace_path;
+	};
+
+	/**
+	 * \brief State of a single compilation. Every compile() and run() call creates its own context.
+	 */
+	struct compilation_context {
+		filepath root_source_path;
+		filepath executable_path;
+		// trace the compilation is recorded into, nullptr if tracing is disabled
+		std::shared_ptr<trace> compilation_trace;
+	};
+
+	/**
+	 * \brief Source file of a compilation. Every file is lexed, parsed and code generated into a separate module,
+	 * the modules of included files are linked into the module of the root source file.
+	 */
+	struct source_module {
+		filepath path;
+		// symbol table the identifiers of the abstract syntax tree were interned into
+		std::shared_ptr<symbol_table> symbols;
+		std::shared_ptr<abstract_syntax_tree> syntax_tree;
+		// absolute paths of the files included by the module, in order of appearance
+		std::vector<filepath> includes;
+		// functions defined by the module, modules which include it import them
+		std::vector<std::pair<std::string, function_declaration_ptr>> exported_functions;
+		std::shared_ptr<llvm_context> generated_module;
+		// bitcode of the generated module, modules are moved into the LLVM context of the root module through it
+		llvm::SmallVector<char, 0> bitcode;
+		// console output of modules processed by worker threads, printed once all modules are done
+		std::wostringstream output;
+		error_result error;
+	};
+
+	/**
+	 * \brief Compiler instance, used for compiling sigma files into an executable. Compilations don't modify
+	 * the compiler, a single instance can therefore be used by multiple threads at once, as long as the
+	 * compilation steps aren't replaced (set_lexer, set_parser, set_code_generator) in the meantime.
 	 */
 	class compiler {
 	public:
@@ -70,17 +184,162 @@ namespace sigma {
 		error_result compile(
 			const filepath& root_source_path,
 			const filepath& target_executable_directory
-		);
+		) const;
+
+		/**
+		 * \brief Compiles the source file given by \a options using the underlying compiler settings.
+		 * \param options Source file, output location and output stream of the compilation
+		 * \return Optional error message containing information about a potential error.
+		 */
+		error_result compile(
+			const compilation_options& options
+		) const;
+
+		/**
+		 * \brief Compiles the given \a root_source_path using the underlying compiler settings and runs it in-process
+		 * using the JIT, without generating an executable.
+		 * \param root_source_path Path to the file to be run
+		 * \return Value returned by the main entry point, or an error message containing information about a potential error.
+		 */
+		std::expected<i32, error_msg> run(
+			const filepath& root_source_path
+		) const;
+
+		/**
+		 * \brief Compiles the source file given by \a options using the underlying compiler settings and runs it
+		 * in-process using the JIT, the output directory and executable name are ignored.
+		 * \param options Source file, output stream and trace path of the compilation
+		 * \return Value returned by the main entry point, or an error message containing information about a potential error.
+		 */
+		std::expected<i32, error_msg> run(
+			const compilation_options& options
+		) const;
+
+		/**
+		 * \brief Optimizes the given module, splits it into one partition per object and emits every partition
+		 * into its in-memory object on a separate thread.
+		 * \param context Compilation the module belongs to
+		 * \param llvm_context Context containing the module to compile
+		 * \param objects Objects to emit, one per codegen thread
+		 * \return Optional error message containing information about a potential error.
+		 */
+		error_result compile_module(
+			const compilation_context& context,
+			const std::shared_ptr<llvm_context>& llvm_context,
+			std::vector<object_buffer>& objects
+		) const;
+
+		/**
+		 * \brief Gets the number of threads used for code generation, which is also the number of objects
+		 * compile_module emits.
+		 * \return Codegen thread count.
+		 */
+		u32 get_codegen_thread_count() const;
 	private:
+		/**
+		 * \brief Compiles the root source file of the given compilation into an executable, called by compile()
+		 * inside of the root scope of the compilation trace.
+		 * \param context Compilation to run
+		 * \param output_directory Directory the executable is written to
+		 * \return Optional error message containing information about a potential error.
+		 */
+		error_result compile_executable(
+			const compilation_context& context,
+			const filepath& output_directory
+		) const;
+
+		/**
+		 * \brief Compiles the root source file of the given compilation and runs it using the JIT, called by run()
+		 * inside of the root scope of the compilation trace.
+		 * \param context Compilation to run
+		 * \return Value returned by the main entry point, or an error message containing information about a potential error.
+		 */
+		std::expected<i32, error_msg> run_module(
+			const compilation_context& context
+		) const;
+
+		/**
+		 * \brief Writes the trace of the given compilation into a Chrome trace_event JSON file at the given \a path,
+		 * does nothing if tracing is disabled.
+		 */
+		static error_result write_trace(
+			const compilation_context& context,
+			const filepath& path
+		);
+
+		/**
+		 * \brief Generates the module of the given source file, files included by the source file (directly or
+		 * indirectly) are compiled into modules of their own and linked into it. Every file is processed once, no
+		 * matter how many files include it.
+		 * \param context Compilation the module belongs to
+		 * \param source_path Root source file
+		 * \param included_files Receives the paths of all included files
+		 * \return Linked module, or an error message containing information about a potential error.
+		 */
 		std::expected<
 			std::shared_ptr<llvm_context>,
 			error_msg
 		> generate_module(
-			const filepath& source_path
+			const compilation_context& context,
+			const filepath& source_path,
+			std::vector<filepath>& included_files
 		) const;
 
-		error_result compile_module(
-			const std::shared_ptr<llvm_context>& llvm_context
+		/**
+		 * \brief Lexes and parses the source file of the given \a module, and collects its includes and the
+		 * functions it defines.
+		 */
+		error_result parse_module(
+			const compilation_context& context,
+			source_module& module
+		) const;
+
+		/**
+		 * \brief Generates the IR of the given parsed \a module.
+		 * \param imported_functions Functions defined by the modules \a module includes
+		 * \param is_root_module Whether \a module belongs to the root source file
+		 */
+		error_result generate_module_code(
+			const compilation_context& context,
+			source_module& module,
+			std::vector<std::pair<std::string, function_declaration_ptr>> imported_functions,
+			bool is_root_module
+		) const;
+
+		/**
+		 * \brief Runs the optimization pipeline over the given module.
+		 */
+		error_result optimize_module(
+			const compilation_context& context,
+			const std::shared_ptr<llvm_context>& llvm_context,
+			llvm::TargetMachine* target_machine
+		) const;
+
+		llvm::OptimizationLevel get_optimization_level() const;
+
+		/**
+		 * \brief Gets the CPU name and the feature string the target machine is created with, resolves the
+		 * "native" CPU to the host CPU and its features.
+		 */
+		std::pair<std::string, std::string> get_target_cpu() const;
+
+		/**
+		 * \brief Links the given \a objects into an executable. ELF executables are linked in-process by lld,
+		 * other targets are linked by the clang driver.
+		 */
+		error_result link_executable(
+			const compilation_context& context,
+			const std::vector<object_buffer>& objects
+		) const;
+
+		/**
+		 * \brief Computes the object cache key of the given source file. The key covers the compiler version, the
+		 * target and the compiler settings which affect the generated code, settings which don't (ie.
+		 * tokenization_mode) are left out so that they don't cause cache misses.
+		 */
+		std::string get_cache_key(
+			const compilation_context& context,
+			const source_file& source
 		) const;
 
 		static error_result verify_source_file(
@@ -99,10 +358,6 @@ namespace sigma {
 		std::function<std::shared_ptr<parser>()> m_parser_generator;
 		// code generator used for generating LLVM IR
 		std::function<std::shared_ptr<code_generator>()> m_code_generator_generator;
-
-		// compilation specific 
-		filepath m_root_source_path;
-		filepath m_target_executable_directory;
 	};
 
 	template<typename lexer>
@@ -26,6 +26,7 @@ namespace sigma {
 		std::pair{ 2004, "'lexer': invalid number format - floating point number must contain a '.' character" },
 		std::pair{ 2005, "'lexer': invalid unterminated character literal detected" },
 		std::pair{ 2006, "'lexer': invalid unterminated string literal detected" },
+		std::pair{ 2007, "'lexer': token lookahead of {} tokens exceeds the capacity of the token stream ({})" },
 		// *********************************************************************************************************************
 		// parser 
 		// *********************************************************************************************************************
@@ -68,12 +69,30 @@ namespace sigma {
 		std::pair{ 4014, "unable to declare a numerical literal using a pointer type" },
 		std::pair{ 4015, "unable to declare a numerical literal using the given type '{}'" },
 		std::pair{ 4016, "IR module contains errors" },
+		std::pair{ 4017, "'{}': numerical literal is out of range" },
 		// *********************************************************************************************************************
 		// compiler errors
 		// *********************************************************************************************************************
 		std::pair{ 5000, "the target machine cannot emit a file of this type" },
 		std::pair{ 5001, "clang compilation contains errors" },
-		std::pair{ 5002, "" }
+		std::pair{ 5002, "'{}': invalid optimization pipeline ({})" },
+		std::pair{ 5003, "'{}': linking failed ({})" },
+		std::pair{ 5004, "unable to locate the C runtime of target '{}'" },
+		std::pair{ 5005, "'{}': unable to create an in-memory object file" },
+		std::pair{ 5006, "unable to initialize the JIT ({})" },
+		std::pair{ 5007, "JIT compilation failed ({})" },
+		std::pair{ 5008, "'{}': multiversioned function does not exist" },
+		std::pair{ 5009, "'{}': unknown target CPU" },
+		std::pair{ 5010, "profile instrumentation and profile use cannot be combined" },
+		std::pair{ 5011, "'{}': unable to read profile ({})" },
+		std::pair{ 5012, "profile instrumentation requires an executable, and is not supported by the JIT" },
+		std::pair{ 5013, "unable to locate the profiling runtime of target '{}'" },
+		std::pair{ 5014, "'{}': unable to start the compile server ({})" },
+		std::pair{ 5015, "'{}': unable to reach the compile server ({})" },
+		std::pair{ 5016, "'{}': malformed compile server response" },
+		std::pair{ 5017, "malformed compile request" },
+		std::pair{ 5018, "'{}': the compile server stopped accepting connections ({})" },
+		std::pair{ 5019, "" }
 	);
 
 	class error_message : public diagnostic_message {
@@ -9,7 +9,12 @@ namespace sigma {
 		// *********************************************************************************************************************
 		std::pair{ 3000, "'{}': implicit function return generated" },
 		std::pair{ 3001, "'initializing': implicit function type cast '{}' to '{}'" },
-		std::pair{ 3002, "'initializing': implicit type cast '{}' to '{}'" }
+		std::pair{ 3002, "'initializing': implicit type cast '{}' to '{}'" },
+		// *********************************************************************************************************************
+		// compiler warnings
+		// *********************************************************************************************************************
+		std::pair{ 3500, "'{}': function multiversioning requires an x86-64 ELF target, multiversioned functions are compiled for the default target" },
+		std::pair{ 3501, "'{}': optimized recompilation failed, the function keeps running unoptimized code ({})" }
 	);
 
 	class warning_message : public diagnostic_message {
@@ -0,0 +1,136 @@
+#include "jit.h"
+
+#include <llvm/ExecutionEngine/Orc/ExecutionUtils.h>
+#include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+#include <llvm/Support/TargetSelect.h>
+
+namespace sigma {
+	std::expected<
+		std::unique_ptr<jit>,
+		error_msg
+	> jit::create() {
+		auto host_jit = create_host_jit({});
+		if (!host_jit) {
+			return std::unexpected(host_jit.error()); // return on failure
+		}
+
+		return std::unique_ptr<jit>(new jit(
+			std::move(host_jit->first),
+			std::move(host_jit->second)
+		));
+	}
+
+	std::expected<
+		std::pair<std::unique_ptr<llvm::orc::LLJIT>, std::unique_ptr<llvm::TargetMachine>>,
+		error_msg
+	> jit::create_host_jit(
+		llvm::orc::LLJITBuilder::CompileFunctionCreator compile_function_creator
+	) {
+		llvm::InitializeNativeTarget();
+		llvm::InitializeNativeTargetAsmPrinter();
+
+		auto target_machine_builder = llvm::orc::JITTargetMachineBuilder::detectHost();
+		if (!target_machine_builder) {
+			return std::unexpected(
+				error::emit<5006>(llvm::toString(target_machine_builder.takeError()))
+			);
+		}
+
+		// the JIT generates code using its own target machine, a separate one is used for optimizing modules
+		auto target_machine = target_machine_builder->createTargetMachine();
+		if (!target_machine) {
+			return std::unexpected(
+				error::emit<5006>(llvm::toString(target_machine.takeError()))
+			);
+		}
+
+		auto lljit = llvm::orc::LLJITBuilder()
+			.setJITTargetMachineBuilder(std::move(target_machine_builder.get()))
+			.setCompileFunctionCreator(std::move(compile_function_creator))
+			.create();
+
+		if (!lljit) {
+			return std::unexpected(
+				error::emit<5006>(llvm::toString(lljit.takeError()))
+			);
+		}
+
+		// resolve external functions against the symbols loaded into the host process
+		auto process_symbols = llvm::orc::DynamicLibrarySearchGenerator::GetForCurrentProcess(
+			lljit.get()->getDataLayout().getGlobalPrefix()
+		);
+
+		if (!process_symbols) {
+			return std::unexpected(
+				error::emit<5006>(llvm::toString(process_symbols.takeError()))
+			);
+		}
+
+		lljit.get()->getMainJITDylib().addGenerator(std::move(process_symbols.get()));
+
+		return std::pair(
+			std::move(lljit.get()),
+			std::move(target_machine.get())
+		);
+	}
+
+	llvm::TargetMachine* jit::get_target_machine() const {
+		return m_target_machine.get();
+	}
+
+	void jit::prepare_module(
+		const std::shared_ptr<llvm_context>& llvm_context
+	) const {
+		llvm_context->get_module()->setDataLayout(
+			m_lljit->getDataLayout()
+		);
+
+		llvm_context->get_module()->setTargetTriple(
+			m_lljit->getTargetTriple().str()
+		);
+	}
+
+	error_result jit::add_module(
+		const std::shared_ptr<llvm_context>& llvm_context
+	) {
+		if (auto error = m_lljit->addIRModule(llvm_context->release_module())) {
+			return error::emit<5007>(llvm::toString(std::move(error)));
+		}
+
+		return {};
+	}
+
+	std::expected<i32, error_msg> jit::run_main() {
+		// looking the entry point up compiles it, along with everything it references
+		auto main_address = m_lljit->lookup("main");
+		if (!main_address) {
+			return std::unexpected(
+				error::emit<5007>(llvm::toString(main_address.takeError()))
+			);
+		}
+
+		// run static initializers (ie. dynamic initialization of globals)
+		if (auto error = m_lljit->initialize(m_lljit->getMainJITDylib())) {
+			return std::unexpected(
+				error::emit<5007>(llvm::toString(std::move(error)))
+			);
+		}
+
+		// the console writes UTF-16 text, while programs write narrow text through the C runtime, switch the
+		// mode of stdout for the duration of the program
+		const i32 console_mode = _setmode(_fileno(stdout), _O_TEXT);
+
+		const auto entry_point = main_address->toPtr<i32(*)()>();
+		const i32 exit_code = entry_point();
+
+		std::fflush(stdout);
+		_setmode(_fileno(stdout), console_mode);
+		return exit_code;
+	}
+
+	jit::jit(
+		std::unique_ptr<llvm::orc::LLJIT> lljit,
+		std::unique_ptr<llvm::TargetMachine> target_machine
+	) : m_lljit(std::move(lljit)),
+	m_target_machine(std::move(target_machine)) {}
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+#include "compiler/diagnostics/error.h"
+#include "llvm_wrappers/llvm_context.h"
+
+#include <llvm/ExecutionEngine/Orc/LLJIT.h>
+#include <llvm/Target/TargetMachine.h>
+
+namespace sigma {
+	/**
+	 * \brief In-process JIT for the host, used for running sigma programs without generating an executable.
+	 * Calls to external functions (ie. printf, malloc, sin) are resolved against the host process.
+	 */
+	class jit {
+	public:
+		/**
+		 * \brief Creates a JIT targeting the host.
+		 * \return JIT instance, or an error message if the host target isn't supported.
+		 */
+		static std::expected<
+			std::unique_ptr<jit>,
+			error_msg
+		> create();
+
+		virtual ~jit() = default;
+
+		/**
+		 * \brief Gets the target machine of the host, which modules should be optimized for before they are
+		 * added to the JIT.
+		 * \return Host target machine.
+		 */
+		llvm::TargetMachine* get_target_machine() const;
+
+		/**
+		 * \brief Prepares the module of the given \a llvm_context for the host, by setting its data layout and
+		 * target triple.
+		 */
+		void prepare_module(
+			const std::shared_ptr<llvm_context>& llvm_context
+		) const;
+
+		/**
+		 * \brief Hands the module of the given \a llvm_context over to the JIT, the context cannot be used
+		 * afterwards. The module is compiled once its symbols are first looked up.
+		 * \return Optional error message containing information about a potential error.
+		 */
+		virtual error_result add_module(
+			const std::shared_ptr<llvm_context>& llvm_context
+		);
+
+		/**
+		 * \brief Compiles and calls the main entry point, static initializers are run beforehand.
+		 * \return Value returned by the main entry point.
+		 */
+		std::expected<i32, error_msg> run_main();
+	protected:
+		jit(
+			std::unique_ptr<llvm::orc::LLJIT> lljit,
+			std::unique_ptr<llvm::TargetMachine> target_machine
+		);
+
+		/**
+		 * \brief Creates an LLJIT instance for the host, and a separate target machine used for optimizing
+		 * modules.
+		 * \param compile_function_creator Creates the compiler used by the JIT, LLJIT's default compiler is used
+		 * if empty
+		 */
+		static std::expected<
+			std::pair<std::unique_ptr<llvm::orc::LLJIT>, std::unique_ptr<llvm::TargetMachine>>,
+			error_msg
+		> create_host_jit(
+			llvm::orc::LLJITBuilder::CompileFunctionCreator compile_function_creator
+		);
+	protected:
+		std::unique_ptr<llvm::orc::LLJIT> m_lljit;
+		std::unique_ptr<llvm::TargetMachine> m_target_machine;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,385 @@
+#include "tiered_jit.h"
+#include "compiler/diagnostics/warning.h"
+
+#include <llvm/Analysis/CFG.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+#include <llvm/IR/MDBuilder.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Transforms/Utils/BasicBlockUtils.h>
+
+namespace sigma {
+	namespace {
+		constexpr auto tier_0_module_name = "sigma.tier0";
+		constexpr auto tier_1_module_name = "sigma.tier1";
+		constexpr auto tier_0_suffix = ".tier0";
+		constexpr auto tier_1_suffix = ".tier1";
+
+		/**
+		 * \brief Compiler used by the tiered JIT, unoptimized modules are generated as quickly as possible,
+		 * optimized modules are generated using aggressive code generation. Creates a target machine for every
+		 * module, so that modules can be compiled concurrently.
+		 */
+		class tiered_compiler : public llvm::orc::IRCompileLayer::IRCompiler {
+		public:
+			tiered_compiler(
+				llvm::orc::JITTargetMachineBuilder target_machine_builder
+			) : IRCompiler(llvm::orc::irManglingOptionsFromTargetOptions(target_machine_builder.getOptions())),
+			m_target_machine_builder(std::move(target_machine_builder)) {}
+
+			llvm::Expected<std::unique_ptr<llvm::MemoryBuffer>> operator()(
+				llvm::Module& module
+			) override {
+				llvm::orc::JITTargetMachineBuilder target_machine_builder = m_target_machine_builder;
+				target_machine_builder.setCodeGenOptLevel(
+					module.getModuleIdentifier() == tier_0_module_name
+					? llvm::CodeGenOpt::None
+					: llvm::CodeGenOpt::Aggressive
+				);
+
+				auto target_machine = target_machine_builder.createTargetMachine();
+				if (!target_machine) {
+					return target_machine.takeError();
+				}
+
+				return llvm::orc::SimpleCompiler(**target_machine)(module);
+			}
+		private:
+			llvm::orc::JITTargetMachineBuilder m_target_machine_builder;
+		};
+	}
+
+	std::expected<
+		std::unique_ptr<jit>,
+		error_msg
+	> tiered_jit::create(
+		u64 tier_up_threshold
+	) {
+		auto host_jit = create_host_jit([](llvm::orc::JITTargetMachineBuilder target_machine_builder)
+			-> llvm::Expected<std::unique_ptr<llvm::orc::IRCompileLayer::IRCompiler>> {
+			return std::make_unique<tiered_compiler>(std::move(target_machine_builder));
+		});
+
+		if (!host_jit) {
+			return std::unexpected(host_jit.error()); // return on failure
+		}
+
+		return std::unique_ptr<jit>(new tiered_jit(
+			std::move(host_jit->first),
+			std::move(host_jit->second),
+			tier_up_threshold
+		));
+	}
+
+	tiered_jit::~tiered_jit() {
+		// functions which are still waiting for optimization are dropped, the compilation in progress has to
+		// finish before the JIT gets destroyed
+		{
+			const std::lock_guard lock(m_compile_queue_mutex);
+			m_stop_compile_thread = true;
+		}
+
+		m_compile_queue_condition.notify_one();
+		m_compile_thread.join();
+	}
+
+	error_result tiered_jit::add_module(
+		const std::shared_ptr<llvm_context>& llvm_context
+	) {
+		llvm::Module* module = llvm_context->get_module();
+
+		// optimized functions are recompiled from the module as it is before instrumentation
+		{
+			llvm::raw_string_ostream bitcode_stream(m_module_bitcode);
+			llvm::WriteBitcodeToFile(*module, bitcode_stream);
+		}
+
+		// every function of the source file is tiered, internal functions (ie. global initializers) only run
+		// once
+		std::vector<llvm::Function*> functions;
+		for (llvm::Function& function : *module) {
+			if (!function.isDeclaration() && !function.hasLocalLinkage()) {
+				functions.push_back(&function);
+			}
+		}
+
+		llvm::orc::SymbolMap stub_symbols;
+
+		for (u64 i = 0; i < functions.size(); ++i) {
+			llvm::Function* function = functions[i];
+			const std::string name = function->getName().str();
+
+			m_function_names.push_back(name);
+			instrument_function(function, i);
+
+			// calls are redirected to the stub, which initially points to the unoptimized function
+			function->setName(name + tier_0_suffix);
+
+			llvm::Function* stub_declaration = llvm::Function::Create(
+				function->getFunctionType(),
+				llvm::GlobalValue::ExternalLinkage,
+				name,
+				module
+			);
+
+			function->replaceAllUsesWith(stub_declaration);
+
+			if (auto error = m_stubs->createStub(name, 0, llvm::JITSymbolFlags::Exported)) {
+				return error::emit<5007>(llvm::toString(std::move(error)));
+			}
+
+			stub_symbols[m_lljit->mangleAndIntern(name)] = m_stubs->findStub(name, true);
+		}
+
+		if (auto error = m_lljit->getMainJITDylib().define(
+			llvm::orc::absoluteSymbols(std::move(stub_symbols))
+		)) {
+			return error::emit<5007>(llvm::toString(std::move(error)));
+		}
+
+		module->setModuleIdentifier(tier_0_module_name);
+
+		if (auto error = m_lljit->addIRModule(llvm_context->release_module())) {
+			return error::emit<5007>(llvm::toString(std::move(error)));
+		}
+
+		// the first lookup compiles the entire unoptimized module
+		for (const std::string& name : m_function_names) {
+			auto address = m_lljit->lookup(name + tier_0_suffix);
+			if (!address) {
+				return error::emit<5007>(llvm::toString(address.takeError()));
+			}
+
+			if (auto error = m_stubs->updatePointer(name, address->getValue())) {
+				return error::emit<5007>(llvm::toString(std::move(error)));
+			}
+		}
+
+		return {};
+	}
+
+	tiered_jit::tiered_jit(
+		std::unique_ptr<llvm::orc::LLJIT> lljit,
+		std::unique_ptr<llvm::TargetMachine> target_machine,
+		u64 tier_up_threshold
+	) : jit(std::move(lljit), std::move(target_machine)),
+	m_tier_up_threshold(tier_up_threshold),
+	m_stubs(llvm::orc::createLocalIndirectStubsManagerBuilder(m_lljit->getTargetTriple())()) {
+		m_compile_thread = std::thread(&tiered_jit::run_compile_thread, this);
+	}
+
+	void tiered_jit::instrument_function(
+		llvm::Function* function,
+		u64 function_index
+	) {
+		llvm::Module* module = function->getParent();
+		llvm::IRBuilder<> builder(module->getContext());
+		llvm::Type* counter_type = builder.getInt64Ty();
+
+		auto* counter = new llvm::GlobalVariable(
+			*module,
+			counter_type,
+			false,
+			llvm::GlobalValue::InternalLinkage,
+			llvm::ConstantInt::get(counter_type, 0),
+			function->getName() + ".counter"
+		);
+
+		// the JIT and its callback are referenced by their addresses, so that they don't have to be resolved as
+		// symbols
+		llvm::FunctionType* tier_up_type = llvm::FunctionType::get(
+			builder.getVoidTy(),
+			{ builder.getInt8PtrTy(), counter_type },
+			false
+		);
+
+		llvm::Constant* tier_up_callee = llvm::ConstantExpr::getIntToPtr(
+			builder.getInt64(reinterpret_cast<u64>(&tier_up)),
+			tier_up_type->getPointerTo()
+		);
+
+		llvm::Constant* jit_pointer = llvm::ConstantExpr::getIntToPtr(
+			builder.getInt64(reinterpret_cast<u64>(this)),
+			builder.getInt8PtrTy()
+		);
+
+		// the tier up branch is taken at most once
+		llvm::MDNode* unlikely = llvm::MDBuilder(module->getContext()).createBranchWeights(1, 1u << 20);
+
+		const auto insert_counter = [&](llvm::Instruction* insertion_point) {
+			builder.SetInsertPoint(insertion_point);
+
+			llvm::Value* count = builder.CreateAdd(
+				builder.CreateLoad(counter_type, counter),
+				builder.getInt64(1)
+			);
+
+			builder.CreateStore(count, counter);
+
+			// the counter crosses the threshold exactly once
+			llvm::Value* is_hot = builder.CreateICmpEQ(count, builder.getInt64(m_tier_up_threshold));
+			builder.SetInsertPoint(llvm::SplitBlockAndInsertIfThen(is_hot, insertion_point, false, unlikely));
+			builder.CreateCall(tier_up_type, tier_up_callee, { jit_pointer, builder.getInt64(function_index) });
+		};
+
+		// back edges have to be collected before the control flow graph gets modified
+		llvm::SmallVector<std::pair<const llvm::BasicBlock*, const llvm::BasicBlock*>> back_edges;
+		llvm::FindFunctionBackedges(*function, back_edges);
+
+		llvm::SmallPtrSet<llvm::BasicBlock*, 8> latches;
+		for (const auto& [from, to] : back_edges) {
+			latches.insert(const_cast<llvm::BasicBlock*>(from));
+		}
+
+		// the entry block can't be a latch, counting at its end keeps its allocas in place
+		insert_counter(function->getEntryBlock().getTerminator());
+
+		for (llvm::BasicBlock* latch : latches) {
+			insert_counter(latch->getTerminator());
+		}
+	}
+
+	void tiered_jit::tier_up(
+		tiered_jit* jit,
+		u64 function_index
+	) {
+		{
+			const std::lock_guard lock(jit->m_compile_queue_mutex);
+			jit->m_compile_queue.push_back(function_index);
+		}
+
+		jit->m_compile_queue_condition.notify_one();
+	}
+
+	void tiered_jit::compile_optimized_function(
+		u64 function_index
+	) {
+		const std::string& name = m_function_names[function_index];
+
+		// every optimized function lives in its own module and context
+		auto context = std::make_unique<llvm::LLVMContext>();
+		auto module_result = llvm::parseBitcodeFile(
+			llvm::MemoryBufferRef(m_module_bitcode, tier_1_module_name),
+			*context
+		);
+
+		if (!module_result) {
+			report_tier_up_error(name, module_result.takeError());
+			return;
+		}
+
+		std::unique_ptr<llvm::Module> module = std::move(module_result.get());
+		module->setModuleIdentifier(tier_1_module_name);
+
+		// static initializers have already been run by the unoptimized module
+		if (llvm::GlobalVariable* global_ctors = module->getNamedGlobal("llvm.global_ctors")) {
+			global_ctors->eraseFromParent();
+		}
+
+		for (llvm::Function& function : llvm::make_early_inc_range(*module)) {
+			if (function.isDeclaration()) {
+				continue;
+			}
+
+			if (function.getName() == name) {
+				function.setName(name + tier_1_suffix);
+			}
+			else if (function.hasLocalLinkage()) {
+				function.eraseFromParent();
+			}
+			else {
+				// other functions stay available for inlining, calls which don't get inlined go through their
+				// stubs
+				function.setLinkage(llvm::GlobalValue::AvailableExternallyLinkage);
+			}
+		}
+
+		// mutable globals are owned by the unoptimized module, constants (ie. string literals) are duplicated
+		for (llvm::GlobalVariable& global : module->globals()) {
+			if (global.isDeclaration() || (global.isConstant() && global.hasLocalLinkage())) {
+				continue;
+			}
+
+			// constant globals keep their initializer, so that loads from them can be folded
+			if (global.isConstant()) {
+				global.setLinkage(llvm::GlobalValue::AvailableExternallyLinkage);
+				continue;
+			}
+
+			global.setInitializer(nullptr);
+			global.setLinkage(llvm::GlobalValue::ExternalLinkage);
+		}
+
+		// optimize the function, the compile thread is the only user of the target machine at this point
+		{
+			llvm::LoopAnalysisManager loop_analysis_manager;
+			llvm::FunctionAnalysisManager function_analysis_manager;
+			llvm::CGSCCAnalysisManager cgscc_analysis_manager;
+			llvm::ModuleAnalysisManager module_analysis_manager;
+
+			llvm::PassBuilder pass_builder(m_target_machine.get());
+			pass_builder.registerModuleAnalyses(module_analysis_manager);
+			pass_builder.registerCGSCCAnalyses(cgscc_analysis_manager);
+			pass_builder.registerFunctionAnalyses(function_analysis_manager);
+			pass_builder.registerLoopAnalyses(loop_analysis_manager);
+			pass_builder.crossRegisterProxies(
+				loop_analysis_manager,
+				function_analysis_manager,
+				cgscc_analysis_manager,
+				module_analysis_manager
+			);
+
+			pass_builder.buildPerModuleDefaultPipeline(llvm::OptimizationLevel::O3).run(
+				*module,
+				module_analysis_manager
+			);
+		}
+
+		if (auto error = m_lljit->addIRModule(llvm::orc::ThreadSafeModule(std::move(module), std::move(context)))) {
+			report_tier_up_error(name, std::move(error));
+			return;
+		}
+
+		auto address = m_lljit->lookup(name + tier_1_suffix);
+		if (!address) {
+			report_tier_up_error(name, address.takeError());
+			return;
+		}
+
+		// new calls enter the optimized function
+		if (auto error = m_stubs->updatePointer(name, address->getValue())) {
+			report_tier_up_error(name, std::move(error));
+		}
+	}
+
+	void tiered_jit::report_tier_up_error(
+		const std::string& name,
+		llvm::Error error
+	) {
+		// the function keeps running its baseline body, which is still correct, just slower
+		warning::emit<3501>(name, llvm::toString(std::move(error)))->print();
+	}
+
+	void tiered_jit::run_compile_thread() {
+		while (true) {
+			u64 function_index;
+
+			{
+				std::unique_lock lock(m_compile_queue_mutex);
+				m_compile_queue_condition.wait(lock, [&] {
+					return m_stop_compile_thread || !m_compile_queue.empty();
+				});
+
+				if (m_stop_compile_thread) {
+					return;
+				}
+
+				function_index = m_compile_queue.front();
+				m_compile_queue.pop_front();
+			}
+
+			compile_optimized_function(function_index);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+#include "compiler/jit/jit.h"
+
+#include <llvm/ExecutionEngine/Orc/IndirectionUtils.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace sigma {
+	/**
+	 * \brief JIT which runs programs using tiered compilation. Every function is first compiled without any
+	 * optimizations and counts its calls and loop iterations, functions which cross the tier up threshold are
+	 * recompiled with full optimizations on a background thread. All calls go through indirect stubs, which
+	 * are pointed to the optimized code once it's ready, calls which are already in progress finish in the
+	 * unoptimized code.
+	 */
+	class tiered_jit : public jit {
+	public:
+		/**
+		 * \brief Creates a tiered JIT targeting the host.
+		 * \param tier_up_threshold Number of calls and loop iterations after which a function gets optimized
+		 * \return JIT instance, or an error message if the host target isn't supported.
+		 */
+		static std::expected<
+			std::unique_ptr<jit>,
+			error_msg
+		> create(
+			u64 tier_up_threshold
+		);
+
+		~tiered_jit() override;
+
+		/**
+		 * \brief Instruments the module of the given \a llvm_context, and compiles it without optimizations.
+		 * The context cannot be used afterwards.
+		 * \return Optional error message containing information about a potential error.
+		 */
+		error_result add_module(
+			const std::shared_ptr<llvm_context>& llvm_context
+		) override;
+	private:
+		tiered_jit(
+			std::unique_ptr<llvm::orc::LLJIT> lljit,
+			std::unique_ptr<llvm::TargetMachine> target_machine,
+			u64 tier_up_threshold
+		);
+
+		/**
+		 * \brief Inserts a counter into the given \a function, which is incremented on entry and on every loop
+		 * back edge. Once it reaches the tier up threshold the function gets queued for optimization.
+		 */
+		void instrument_function(
+			llvm::Function* function,
+			u64 function_index
+		);
+
+		/**
+		 * \brief Called by instrumented code, queues the given function for optimization.
+		 */
+		static void tier_up(
+			tiered_jit* jit,
+			u64 function_index
+		);
+
+		/**
+		 * \brief Recompiles the given function with full optimizations, and points its stub to the optimized
+		 * code. Failures are reported, and leave the unoptimized code in place.
+		 */
+		void compile_optimized_function(
+			u64 function_index
+		);
+
+		/**
+		 * \brief Reports a failed recompilation of the given function as a warning.
+		 * \param name Name of the function
+		 * \param error Error which caused the recompilation to fail
+		 */
+		static void report_tier_up_error(
+			const std::string& name,
+			llvm::Error error
+		);
+
+		void run_compile_thread();
+	private:
+		u64 m_tier_up_threshold;
+
+		// names of the tiered functions, indexed by the function index passed to tier_up
+		std::vector<std::string> m_function_names;
+		// bitcode of the module before it has been instrumented, optimized functions are extracted from it
+		std::string m_module_bitcode;
+		std::unique_ptr<llvm::orc::IndirectStubsManager> m_stubs;
+
+		// functions waiting for optimization, processed by the compile thread
+		std::deque<u64> m_compile_queue;
+		std::mutex m_compile_queue_mutex;
+		std::condition_variable m_compile_queue_condition;
+		bool m_stop_compile_thread = false;
+		std::thread m_compile_thread;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include "linker.h"
+
+#ifdef __linux__
+#include <clang/Driver/Driver.h>
+#include <lld/Common/CommonLinkerContext.h>
+#include <lld/Common/Driver.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Program.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <mutex>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace sigma {
+	error_result linker::link(
+		const std::vector<object_buffer>& objects,
+		const filepath& executable_path,
+		const llvm::Triple& triple,
+		bool profile_instrumented
+	) {
+		const auto runtime = find_c_runtime(triple);
+		if (!runtime.has_value()) {
+			return error::emit<5004>(triple.str());
+		}
+
+		std::string profile_runtime;
+		if (profile_instrumented) {
+			const auto profile_runtime_path = find_profile_runtime(triple);
+			if (!profile_runtime_path.has_value()) {
+				return error::emit<5013>(triple.str());
+			}
+
+			profile_runtime = profile_runtime_path->string();
+		}
+
+		// lld only reads its inputs from paths, the objects are handed over as anonymous in-memory files
+		std::vector<i32> descriptors;
+		std::vector<std::string> object_paths;
+
+		const auto close_descriptors = [&] {
+			for (const i32 descriptor : descriptors) {
+				close(descriptor);
+			}
+		};
+
+		for (const object_buffer& object : objects) {
+			const i32 descriptor = create_memory_file(object);
+			if (descriptor == -1) {
+				close_descriptors();
+				return error::emit<5005>(executable_path);
+			}
+
+			descriptors.push_back(descriptor);
+			object_paths.push_back("/proc/self/fd/" + std::to_string(descriptor));
+		}
+
+		// generate lld arguments, executables are position dependent, since objects are emitted using the
+		// static relocation model
+		const std::string executable = executable_path.string();
+		const std::string crt1 = (runtime->directory / "crt1.o").string();
+		const std::string crti = (runtime->directory / "crti.o").string();
+		const std::string crtn = (runtime->directory / "crtn.o").string();
+		const std::string library_directory = "-L" + runtime->directory.string();
+
+		// functions placed into .text.hot and .text.unlikely by profile-guided optimization are kept in separate
+		// output sections, so that hot code ends up packed together
+		std::vector<const char*> arguments{
+			"ld.lld",
+			"-o",
+			executable.c_str(),
+			"--eh-frame-hdr",
+			"-z",
+			"keep-text-section-prefix",
+			"-dynamic-linker",
+			runtime->dynamic_linker.c_str(),
+			crt1.c_str(),
+			crti.c_str()
+		};
+
+		for (const std::string& object_path : object_paths) {
+			arguments.push_back(object_path.c_str());
+		}
+
+		// the runtime registers itself through __llvm_profile_runtime, which nothing references
+		if (profile_instrumented) {
+			arguments.push_back("-u");
+			arguments.push_back("__llvm_profile_runtime");
+			arguments.push_back(profile_runtime.c_str());
+		}
+
+		arguments.push_back(library_directory.c_str());
+		arguments.push_back("-lc");
+		arguments.push_back("-lm");
+		arguments.push_back(crtn.c_str());
+
+		// the output of lld is forwarded to the console output of the compilation, which may be redirected
+		std::string output;
+		llvm::raw_string_ostream output_stream(output);
+		std::string diagnostics;
+		llvm::raw_string_ostream diagnostic_stream(diagnostics);
+		bool linked;
+
+		{
+			// lld keeps its state in a global context, only one link can run at a time
+			static std::mutex link_mutex;
+			const std::lock_guard lock(link_mutex);
+
+			linked = lld::elf::link(
+				arguments,
+				output_stream,
+				diagnostic_stream,
+				false,
+				false
+			);
+
+			lld::CommonLinkerContext::destroy();
+		}
+
+		close_descriptors();
+
+		if (!output_stream.str().empty()) {
+			console::out << output_stream.str();
+		}
+
+		if (!linked) {
+			return error::emit<5003>(executable_path, llvm::StringRef(diagnostic_stream.str()).trim().str());
+		}
+
+		return {};
+	}
+
+	std::optional<linker::c_runtime> linker::find_c_runtime(
+		const llvm::Triple& triple
+	) {
+		std::string dynamic_linker;
+
+		switch (triple.getArch()) {
+		case llvm::Triple::x86_64:
+			dynamic_linker = "/lib64/ld-linux-x86-64.so.2";
+			break;
+		case llvm::Triple::aarch64:
+			dynamic_linker = "/lib/ld-linux-aarch64.so.1";
+			break;
+		default:
+			return std::nullopt;
+		}
+
+		// distributions place the C runtime into different directories, debian based distributions use
+		// multiarch directories
+		const std::string multiarch = triple.getArchName().str() + "-linux-gnu";
+		const std::array<filepath, 5> directories{
+			filepath("/usr/lib") / multiarch,
+			filepath("/usr/lib64"),
+			filepath("/usr/lib"),
+			filepath("/lib") / multiarch,
+			filepath("/lib64")
+		};
+
+		for (const filepath& directory : directories) {
+			std::error_code error_code;
+
+			if (std::filesystem::exists(directory / "crt1.o", error_code)) {
+				return c_runtime{ directory, dynamic_linker };
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	std::optional<filepath> linker::find_profile_runtime(
+		const llvm::Triple& triple
+	) {
+		// the raw profile format changes between LLVM versions, prefer the clang of the same version
+		const std::array<std::string, 2> clang_names{
+			"clang-" + std::to_string(LLVM_VERSION_MAJOR),
+			"clang"
+		};
+
+		for (const std::string& clang_name : clang_names) {
+			const auto clang_path = llvm::sys::findProgramByName(clang_name);
+			if (!clang_path) {
+				continue;
+			}
+
+			llvm::SmallString<256> real_clang_path;
+			if (llvm::sys::fs::real_path(*clang_path, real_clang_path)) {
+				continue;
+			}
+
+			const filepath resource_directory = clang::driver::Driver::GetResourcesPath(real_clang_path);
+
+			// runtimes are either stored in per-target directories, or in a shared directory with the
+			// architecture as a suffix
+			const std::array<filepath, 2> candidates{
+				resource_directory / "lib" / triple.str() / "libclang_rt.profile.a",
+				resource_directory / "lib" / "linux" / ("libclang_rt.profile-" + triple.getArchName().str() + ".a")
+			};
+
+			for (const filepath& candidate : candidates) {
+				std::error_code error_code;
+
+				if (std::filesystem::exists(candidate, error_code)) {
+					return candidate;
+				}
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	i32 linker::create_memory_file(
+		const object_buffer& object
+	) {
+		const i32 descriptor = memfd_create("sigma_object", MFD_CLOEXEC);
+		if (descriptor == -1) {
+			return -1;
+		}
+
+		const char* data = object.data();
+		u64 remaining = object.size();
+
+		while (remaining > 0) {
+			const ssize_t written = write(descriptor, data, remaining);
+			if (written <= 0) {
+				close(descriptor);
+				return -1;
+			}
+
+			data += written;
+			remaining -= static_cast<u64>(written);
+		}
+
+		return descriptor;
+	}
+}
+#endif
\ No newline at end of file
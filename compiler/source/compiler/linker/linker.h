@@ -0,0 +1,62 @@
+#pragma once
+#include "compiler/object_cache/object_cache.h"
+#include "compiler/diagnostics/error.h"
+
+#include <llvm/ADT/Triple.h>
+
+namespace sigma {
+	/**
+	 * \brief In-process ELF linker. Links in-memory object files into an executable using lld's ELF driver,
+	 * without spawning a linker process or writing the objects to disk. Only available on Linux hosts.
+	 */
+	class linker {
+	public:
+		/**
+		 * \brief Links the given \a objects against the C runtime of the target into an executable.
+		 * \param objects Contents of the object files to link
+		 * \param executable_path Path of the executable to generate
+		 * \param triple Target triple the objects have been compiled for
+		 * \param profile_instrumented Link the profiling runtime required by instrumented objects
+		 * \return Optional error message containing information about a potential error.
+		 */
+		static error_result link(
+			const std::vector<object_buffer>& objects,
+			const filepath& executable_path,
+			const llvm::Triple& triple,
+			bool profile_instrumented
+		);
+	private:
+		struct c_runtime {
+			// directory containing the startup objects (crt1.o, crti.o, crtn.o) and the C library
+			filepath directory;
+			// path of the dynamic linker executables are loaded by
+			std::string dynamic_linker;
+		};
+
+		/**
+		 * \brief Locates the C runtime of the given target on the host.
+		 * \return C runtime of the target, or std::nullopt if the target isn't supported or the startup
+		 * objects cannot be found.
+		 */
+		static std::optional<c_runtime> find_c_runtime(
+			const llvm::Triple& triple
+		);
+
+		/**
+		 * \brief Locates the profiling runtime (compiler-rt) of the given target, the runtime is taken from the
+		 * resource directory of the clang installation matching the LLVM version the compiler is built with.
+		 * \return Path of the runtime library, or std::nullopt if it cannot be found.
+		 */
+		static std::optional<filepath> find_profile_runtime(
+			const llvm::Triple& triple
+		);
+
+		/**
+		 * \brief Copies the given \a object into an anonymous in-memory file.
+		 * \return File descriptor of the file, -1 on failure.
+		 */
+		static i32 create_memory_file(
+			const object_buffer& object
+		);
+	};
+}
\ No newline at end of file
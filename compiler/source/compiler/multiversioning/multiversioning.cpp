@@ -0,0 +1,216 @@
+#include "multiversioning.h"
+
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/InlineAsm.h>
+#include <llvm/Transforms/Utils/Cloning.h>
+
+#include <array>
+
+namespace sigma {
+	namespace {
+		// ISA levels, ordered by their level as returned by the ISA level function
+		constexpr std::array<const char*, 3> isa_levels{
+			"x86-64-v2",
+			"x86-64-v3",
+			"x86-64-v4"
+		};
+
+		// CPUID leaf 1 ecx: sse3, ssse3, cx16, sse4.1, sse4.2, popcnt
+		constexpr u32 v2_leaf_1_ecx = 1u << 0 | 1u << 9 | 1u << 13 | 1u << 19 | 1u << 20 | 1u << 23;
+		// CPUID leaf 0x80000001 ecx: lahf/sahf
+		constexpr u32 v2_extended_ecx = 1u << 0;
+		// CPUID leaf 1 ecx: fma, movbe, osxsave, avx, f16c
+		constexpr u32 v3_leaf_1_ecx = 1u << 12 | 1u << 22 | 1u << 27 | 1u << 28 | 1u << 29;
+		// CPUID leaf 7 ebx: bmi1, avx2, bmi2
+		constexpr u32 v3_leaf_7_ebx = 1u << 3 | 1u << 5 | 1u << 8;
+		// CPUID leaf 0x80000001 ecx: lzcnt
+		constexpr u32 v3_extended_ecx = 1u << 5;
+		// XCR0: sse and avx state enabled by the OS
+		constexpr u32 v3_xcr0 = 0x6;
+		// CPUID leaf 7 ebx: avx512f, avx512dq, avx512cd, avx512bw, avx512vl
+		constexpr u32 v4_leaf_7_ebx = 1u << 16 | 1u << 17 | 1u << 28 | 1u << 30 | 1u << 31;
+		// XCR0: sse, avx, opmask and zmm state enabled by the OS
+		constexpr u32 v4_xcr0 = 0xe6;
+	}
+
+	error_result multiversioning::apply(
+		llvm::Module& module,
+		const std::vector<std::string>& functions
+	) {
+		if (functions.empty()) {
+			return {};
+		}
+
+		llvm::IRBuilder<> builder(module.getContext());
+		llvm::Function* isa_level_function = create_isa_level_function(module);
+
+		for (const std::string& name : functions) {
+			llvm::Function* function = module.getFunction(name);
+
+			if (function == nullptr || function->isDeclaration()) {
+				return error::emit<5008>(name);
+			}
+
+			// the default version keeps the target of the module
+			function->setName(name + ".default");
+			function->setLinkage(llvm::GlobalValue::InternalLinkage);
+
+			std::vector<llvm::Function*> versions;
+
+			for (const char* isa_level : isa_levels) {
+				llvm::ValueToValueMapTy value_map;
+				llvm::Function* version = llvm::CloneFunction(function, value_map);
+				version->setName(name + "." + isa_level);
+
+				// the features of the module target (ie. a host CPU) would override the features implied by
+				// the ISA level
+				version->addFnAttr("target-cpu", isa_level);
+				version->addFnAttr("target-features", "");
+				versions.push_back(version);
+			}
+
+			// the resolver picks the most capable version supported by the host
+			llvm::Function* resolver = llvm::Function::Create(
+				llvm::FunctionType::get(function->getType(), false),
+				llvm::GlobalValue::InternalLinkage,
+				name + ".resolver",
+				module
+			);
+
+			builder.SetInsertPoint(llvm::BasicBlock::Create(module.getContext(), "", resolver));
+			llvm::Value* isa_level = builder.CreateCall(isa_level_function);
+			llvm::Value* selected_version = function;
+
+			for (u64 i = 0; i < versions.size(); ++i) {
+				selected_version = builder.CreateSelect(
+					builder.CreateICmpUGE(isa_level, builder.getInt32(static_cast<u32>(i + 1))),
+					versions[i],
+					selected_version
+				);
+			}
+
+			builder.CreateRet(selected_version);
+
+			llvm::GlobalIFunc* ifunc = llvm::GlobalIFunc::create(
+				function->getFunctionType(),
+				function->getAddressSpace(),
+				llvm::GlobalValue::ExternalLinkage,
+				name,
+				resolver,
+				&module
+			);
+
+			// every call (including recursive ones) goes through the ifunc, the clones have been created
+			// beforehand, so that they don't refer to the default version either
+			function->replaceUsesWithIf(ifunc, [&](const llvm::Use& use) {
+				const auto* instruction = llvm::dyn_cast<llvm::Instruction>(use.getUser());
+				return instruction == nullptr || instruction->getFunction() != resolver;
+			});
+		}
+
+		return {};
+	}
+
+	llvm::Function* multiversioning::create_isa_level_function(
+		llvm::Module& module
+	) {
+		llvm::LLVMContext& context = module.getContext();
+		llvm::IRBuilder<> builder(context);
+		llvm::Type* i32_type = builder.getInt32Ty();
+
+		llvm::Function* function = llvm::Function::Create(
+			llvm::FunctionType::get(i32_type, false),
+			llvm::GlobalValue::InternalLinkage,
+			"sigma.isa_level",
+			module
+		);
+
+		llvm::BasicBlock* entry_block = llvm::BasicBlock::Create(context, "", function);
+		llvm::BasicBlock* baseline_block = llvm::BasicBlock::Create(context, "baseline", function);
+		llvm::BasicBlock* v2_block = llvm::BasicBlock::Create(context, "v2", function);
+		llvm::BasicBlock* v3_block = llvm::BasicBlock::Create(context, "v3", function);
+
+		llvm::StructType* cpuid_result_type = llvm::StructType::get(i32_type, i32_type, i32_type, i32_type);
+		llvm::InlineAsm* cpuid = llvm::InlineAsm::get(
+			llvm::FunctionType::get(cpuid_result_type, { i32_type, i32_type }, false),
+			"cpuid",
+			"={ax},={bx},={cx},={dx},{ax},{cx},~{dirflag},~{fpsr},~{flags}",
+			true
+		);
+
+		llvm::InlineAsm* xgetbv = llvm::InlineAsm::get(
+			llvm::FunctionType::get(llvm::StructType::get(i32_type, i32_type), { i32_type }, false),
+			"xgetbv",
+			"={ax},={dx},{cx},~{dirflag},~{fpsr},~{flags}",
+			true
+		);
+
+		// executes CPUID for the given leaf, the result contains eax, ebx, ecx and edx
+		const auto call_cpuid = [&](u32 leaf) {
+			return builder.CreateCall(cpuid, { builder.getInt32(leaf), builder.getInt32(0) });
+		};
+
+		// checks whether all bits of the given mask are set
+		const auto has_bits = [&](llvm::Value* value, u32 mask) {
+			return builder.CreateICmpEQ(
+				builder.CreateAnd(value, builder.getInt32(mask)),
+				builder.getInt32(mask)
+			);
+		};
+
+		// x86-64-v2
+		builder.SetInsertPoint(entry_block);
+		llvm::Value* max_leaf = builder.CreateExtractValue(call_cpuid(0), 0);
+		llvm::Value* leaf_1_ecx = builder.CreateExtractValue(call_cpuid(1), 2);
+		llvm::Value* extended_ecx = builder.CreateExtractValue(call_cpuid(0x80000001), 2);
+
+		builder.CreateCondBr(
+			builder.CreateAnd(has_bits(leaf_1_ecx, v2_leaf_1_ecx), has_bits(extended_ecx, v2_extended_ecx)),
+			v2_block,
+			baseline_block
+		);
+
+		builder.SetInsertPoint(baseline_block);
+		builder.CreateRet(builder.getInt32(0));
+
+		// x86-64-v3, XGETBV and leaf 7 may only be used if they're supported
+		builder.SetInsertPoint(v2_block);
+		llvm::BasicBlock* v2_return_block = llvm::BasicBlock::Create(context, "v2.return", function);
+		llvm::BasicBlock* v3_check_block = llvm::BasicBlock::Create(context, "v3.check", function);
+
+		builder.CreateCondBr(
+			builder.CreateAnd(
+				has_bits(leaf_1_ecx, v3_leaf_1_ecx),
+				builder.CreateICmpUGE(max_leaf, builder.getInt32(7))
+			),
+			v3_check_block,
+			v2_return_block
+		);
+
+		builder.SetInsertPoint(v2_return_block);
+		builder.CreateRet(builder.getInt32(1));
+
+		builder.SetInsertPoint(v3_check_block);
+		llvm::Value* xcr0 = builder.CreateExtractValue(builder.CreateCall(xgetbv, { builder.getInt32(0) }), 0);
+		llvm::Value* leaf_7_ebx = builder.CreateExtractValue(call_cpuid(7), 1);
+
+		builder.CreateCondBr(
+			builder.CreateAnd(
+				builder.CreateAnd(has_bits(leaf_7_ebx, v3_leaf_7_ebx), has_bits(extended_ecx, v3_extended_ecx)),
+				has_bits(xcr0, v3_xcr0)
+			),
+			v3_block,
+			v2_return_block
+		);
+
+		// x86-64-v4
+		builder.SetInsertPoint(v3_block);
+		builder.CreateRet(builder.CreateSelect(
+			builder.CreateAnd(has_bits(leaf_7_ebx, v4_leaf_7_ebx), has_bits(xcr0, v4_xcr0)),
+			builder.getInt32(3),
+			builder.getInt32(2)
+		));
+
+		return function;
+	}
+}
\ No newline at end of file
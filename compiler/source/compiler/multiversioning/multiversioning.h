@@ -0,0 +1,35 @@
+#pragma once
+#include "compiler/diagnostics/error.h"
+
+#include <llvm/IR/Module.h>
+
+namespace sigma {
+	/**
+	 * \brief Function multiversioning for x86-64 ELF targets. Every multiversioned function is compiled for the
+	 * x86-64-v2, x86-64-v3 and x86-64-v4 ISA levels in addition to the default target, the version used is
+	 * selected once by an ifunc resolver when the executable gets loaded, based on the CPUID of the host.
+	 */
+	class multiversioning {
+	public:
+		/**
+		 * \brief Replaces the given \a functions by ifuncs which dispatch to their ISA level specific versions.
+		 * Has to be applied before the module gets optimized, so that every version gets optimized for its own
+		 * ISA level.
+		 * \param module Module containing the functions
+		 * \param functions Names of the functions to multiversion
+		 * \return Optional error message containing information about a potential error.
+		 */
+		static error_result apply(
+			llvm::Module& module,
+			const std::vector<std::string>& functions
+		);
+	private:
+		/**
+		 * \brief Generates a function which determines the highest x86-64 ISA level supported by the host (0
+		 * for the baseline, 1-3 for x86-64-v2 to x86-64-v4), using CPUID and XGETBV.
+		 */
+		static llvm::Function* create_isa_level_function(
+			llvm::Module& module
+		);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "object_cache.h"
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/SHA256.h>
+
+#include <random>
+
+namespace sigma {
+	object_cache::object_cache(
+		const filepath& directory,
+		u64 size_limit
+	) : m_directory(directory),
+	m_size_limit(size_limit) {
+		std::error_code error_code;
+		std::filesystem::create_directories(m_directory, error_code);
+	}
+
+	bool object_cache::lookup(
+		const std::string& key,
+		std::vector<object_buffer>& objects
+	) const {
+		// the manifest contains the list of files which have been included by the source file, the object key
+		// depends on their contents
+		std::ifstream manifest(m_directory / (key + ".deps"));
+		if (!manifest.is_open()) {
+			return false;
+		}
+
+		std::vector<filepath> dependencies;
+		std::string dependency;
+		while (std::getline(manifest, dependency)) {
+			dependencies.emplace_back(dependency);
+		}
+
+		const std::string object_key = get_object_key(key, dependencies);
+		if (object_key.empty()) {
+			return false;
+		}
+
+		// the entry may get evicted by another process at any point, a failed read is a miss
+		std::error_code error_code;
+
+		for (u64 i = 0; i < objects.size(); ++i) {
+			const filepath object = m_directory / (object_key + "." + std::to_string(i) + ".o");
+
+			std::ifstream file(object, std::ios::binary | std::ios::ate);
+			if (!file.is_open()) {
+				return false;
+			}
+
+			objects[i].resize_for_overwrite(static_cast<u64>(file.tellg()));
+			file.seekg(0);
+
+			if (!file.read(objects[i].data(), static_cast<std::streamsize>(objects[i].size()))) {
+				return false;
+			}
+
+			// mark the entry as recently used
+			std::filesystem::last_write_time(object, std::filesystem::file_time_type::clock::now(), error_code);
+		}
+
+		std::filesystem::last_write_time(m_directory / (key + ".deps"), std::filesystem::file_time_type::clock::now(), error_code);
+		return true;
+	}
+
+	void object_cache::store(
+		const std::string& key,
+		const std::vector<object_buffer>& objects,
+		const std::vector<filepath>& dependencies
+	) {
+		const std::string object_key = get_object_key(key, dependencies);
+		if (object_key.empty()) {
+			return;
+		}
+
+		// publish the objects before the manifest, so that readers never find a manifest which refers to
+		// missing objects (unless they have been evicted)
+		std::error_code error_code;
+
+		for (u64 i = 0; i < objects.size(); ++i) {
+			const filepath object_path = m_directory / (object_key + "." + std::to_string(i) + ".o");
+			const filepath temporary_object_path = get_temporary_path(object_path);
+
+			{
+				std::ofstream file(temporary_object_path, std::ios::binary | std::ios::trunc);
+				file.write(objects[i].data(), static_cast<std::streamsize>(objects[i].size()));
+
+				if (!file) {
+					file.close();
+					std::filesystem::remove(temporary_object_path, error_code);
+					return;
+				}
+			}
+
+			if (!publish(temporary_object_path, object_path)) {
+				return;
+			}
+		}
+
+		const filepath manifest_path = m_directory / (key + ".deps");
+		const filepath temporary_manifest_path = get_temporary_path(manifest_path);
+		{
+			std::ofstream manifest(temporary_manifest_path, std::ios::trunc);
+			for (const filepath& dependency : dependencies) {
+				manifest << dependency.string() << '\n';
+			}
+		}
+
+		publish(temporary_manifest_path, manifest_path);
+		evict();
+	}
+
+	std::string object_cache::get_object_key(
+		const std::string& key,
+		const std::vector<filepath>& dependencies
+	) {
+		llvm::SHA256 hash;
+		hash.update(key);
+
+		for (const filepath& dependency : dependencies) {
+			const auto file_map_result = detail::map_file(dependency);
+			if (!file_map_result.has_value()) {
+				return {};
+			}
+
+			const std::string_view contents = file_map_result.value()->get_source();
+			hash.update(dependency.string());
+			hash.update(llvm::StringRef(contents.data(), contents.size()));
+		}
+
+		return llvm::toHex(hash.final(), true);
+	}
+
+	filepath object_cache::get_temporary_path(
+		const filepath& target
+	) const {
+		// temporary files have to be unique across processes and threads
+		return m_directory / (target.filename().string() + "." + std::to_string(std::random_device()()) + ".tmp");
+	}
+
+	bool object_cache::publish(
+		const filepath& temporary,
+		const filepath& target
+	) {
+		// renames within a single directory are atomic, concurrent writers of the same entry write identical
+		// contents, so whichever rename comes last wins
+		std::error_code error_code;
+		std::filesystem::rename(temporary, target, error_code);
+
+		if (error_code) {
+			std::filesystem::remove(temporary, error_code);
+			return false;
+		}
+
+		return true;
+	}
+
+	void object_cache::evict() const {
+		struct entry {
+			filepath path;
+			u64 size;
+			std::filesystem::file_time_type last_use;
+		};
+
+		std::vector<entry> entries;
+		u64 cache_size = 0;
+		std::error_code error_code;
+
+		const auto now = std::filesystem::file_time_type::clock::now();
+
+		for (const auto& file : std::filesystem::directory_iterator(m_directory, error_code)) {
+			const std::string extension = file.path().extension().string();
+
+			if (!file.is_regular_file(error_code)) {
+				continue;
+			}
+
+			// temporary files are being written by other processes, unless they have been left behind by a
+			// process which didn't finish
+			if (extension == ".tmp") {
+				if (now - file.last_write_time(error_code) > std::chrono::hours(1)) {
+					std::filesystem::remove(file.path(), error_code);
+				}
+
+				continue;
+			}
+
+			if (extension != ".o" && extension != ".deps") {
+				continue;
+			}
+
+			const u64 size = file.file_size(error_code);
+			entries.push_back({ file.path(), size, file.last_write_time(error_code) });
+			cache_size += size;
+		}
+
+		if (cache_size <= m_size_limit) {
+			return;
+		}
+
+		// evict the least recently used entries first
+		std::sort(entries.begin(), entries.end(), [](const entry& left, const entry& right) {
+			return left.last_use < right.last_use;
+		});
+
+		for (const entry& entry : entries) {
+			if (cache_size <= m_size_limit) {
+				break;
+			}
+
+			// another process may have evicted the entry already
+			std::filesystem::remove(entry.path, error_code);
+			cache_size -= entry.size;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+#include "utility/filesystem.h"
+
+#include <llvm/ADT/SmallVector.h>
+
+namespace sigma {
+	/**
+	 * \brief Contents of a single in-memory object file.
+	 */
+	using object_buffer = llvm::SmallVector<char, 0>;
+
+	/**
+	 * \brief On-disk cache of compiled object files, shared between compiler processes. Objects are content
+	 * addressed: the key of an object is derived from everything which affects its contents (see
+	 * compiler::get_cache_key), combined with the contents of all files the source includes. Entries are
+	 * published using atomic renames, so concurrent readers never observe partially written files. Once the
+	 * cache exceeds its size limit the least recently used entries are evicted.
+	 */
+	class object_cache {
+	public:
+		/**
+		 * \brief Constructs the object cache, the cache directory is created if it doesn't exist.
+		 * \param directory Cache directory
+		 * \param size_limit Maximum size of the cache in bytes
+		 */
+		object_cache(
+			const filepath& directory,
+			u64 size_limit
+		);
+
+		/**
+		 * \brief Attempts to retrieve the object files stored under the given \a key, and reads them into
+		 * \a objects. The lookup fails if any of the included files have changed since the objects were
+		 * stored.
+		 * \param key Key of the source file
+		 * \param objects Buffers to read the object files into, one per stored object
+		 * \return True if all objects have been found and read, otherwise false.
+		 */
+		bool lookup(
+			const std::string& key,
+			std::vector<object_buffer>& objects
+		) const;
+
+		/**
+		 * \brief Stores the given object files under the given \a key.
+		 * \param key Key of the source file
+		 * \param objects Contents of the object files to store
+		 * \param dependencies Files which have been included while compiling the objects
+		 */
+		void store(
+			const std::string& key,
+			const std::vector<object_buffer>& objects,
+			const std::vector<filepath>& dependencies
+		);
+	private:
+		/**
+		 * \brief Combines the source \a key with the hashes of the current contents of all \a dependencies.
+		 * \return Key of the object file, or an empty string if any of the dependencies cannot be read.
+		 */
+		static std::string get_object_key(
+			const std::string& key,
+			const std::vector<filepath>& dependencies
+		);
+
+		/**
+		 * \brief Generates a unique path for a temporary file which will eventually be renamed to \a target.
+		 */
+		filepath get_temporary_path(
+			const filepath& target
+		) const;
+
+		/**
+		 * \brief Publishes a fully written \a temporary file by atomically renaming it to \a target.
+		 * \return True if the file has been published, otherwise false.
+		 */
+		static bool publish(
+			const filepath& temporary,
+			const filepath& target
+		);
+
+		/**
+		 * \brief Removes the least recently used entries until the cache fits into its size limit.
+		 */
+		void evict() const;
+	private:
+		filepath m_directory;
+		u64 m_size_limit;
+	};
+}
\ No newline at end of file
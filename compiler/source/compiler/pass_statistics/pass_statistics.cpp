@@ -0,0 +1,192 @@
+#include "pass_statistics.h"
+
+#include <llvm/Analysis/LazyCallGraph.h>
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/IR/Module.h>
+
+namespace sigma {
+	pass_statistics::pass_statistics(
+		trace* trace
+	) : m_trace(trace) {}
+
+	void pass_statistics::register_callbacks(
+		llvm::PassInstrumentationCallbacks& callbacks
+	) {
+		// pass managers and adaptors only run other passes, which are measured on their own
+		static const std::vector<llvm::StringRef> wrapper_passes = {
+			"PassManager",
+			"PassAdaptor",
+			"AnalysisManagerProxy",
+			"DevirtSCCRepeatedPass",
+			"ModuleInlinerWrapperPass"
+		};
+
+		callbacks.registerBeforeNonSkippedPassCallback([this](llvm::StringRef name, llvm::Any ir) {
+			if (!llvm::isSpecialPass(name, wrapper_passes)) {
+				begin_pass(name, ir, false);
+			}
+		});
+
+		callbacks.registerAfterPassCallback([this](llvm::StringRef name, llvm::Any ir, const llvm::PreservedAnalyses&) {
+			if (!llvm::isSpecialPass(name, wrapper_passes)) {
+				end_pass(&ir);
+			}
+		});
+
+		// the IR unit may have been deleted, its instruction count cannot be determined
+		callbacks.registerAfterPassInvalidatedCallback([this](llvm::StringRef name, const llvm::PreservedAnalyses&) {
+			if (!llvm::isSpecialPass(name, wrapper_passes)) {
+				end_pass(nullptr);
+			}
+		});
+
+		callbacks.registerBeforeAnalysisCallback([this](llvm::StringRef name, llvm::Any ir) {
+			begin_pass(name, ir, true);
+		});
+
+		callbacks.registerAfterAnalysisCallback([this](llvm::StringRef, llvm::Any) {
+			end_pass(nullptr);
+		});
+	}
+
+	void pass_statistics::print() const {
+		std::vector<const pass_record*> records;
+		clock::duration total_time = {};
+		i64 total_instruction_delta = 0;
+
+		for (const pass_record& record : m_records) {
+			records.push_back(&record);
+			total_time += record.time;
+			total_instruction_delta += record.instruction_delta;
+		}
+
+		std::sort(records.begin(), records.end(), [](const pass_record* left, const pass_record* right) {
+			return left->time > right->time;
+		});
+
+		const auto to_milliseconds = [](clock::duration duration) {
+			return std::chrono::duration<double, std::milli>(duration).count();
+		};
+
+		const double total_milliseconds = to_milliseconds(total_time);
+
+		console::out << std::format(
+			"{:<48} {:>8} {:>12} {:>8} {:>14}\n",
+			"pass",
+			"runs",
+			"time (ms)",
+			"time %",
+			"instructions"
+		);
+
+		for (const pass_record* record : records) {
+			const double milliseconds = to_milliseconds(record->time);
+
+			console::out << std::format(
+				"{:<48} {:>8} {:>12.3f} {:>8.2f} {:>+14}\n",
+				record->name,
+				record->run_count,
+				milliseconds,
+				total_milliseconds > 0.0 ? milliseconds / total_milliseconds * 100.0 : 0.0,
+				record->instruction_delta
+			);
+		}
+
+		console::out << std::format(
+			"{:<48} {:>8} {:>12.3f} {:>8.2f} {:>+14}\n",
+			"total",
+			"",
+			total_milliseconds,
+			100.0,
+			total_instruction_delta
+		);
+	}
+
+	void pass_statistics::begin_pass(
+		llvm::StringRef name,
+		const llvm::Any& ir,
+		bool is_analysis
+	) {
+		// count the instructions before starting the clock, so that counting isn't attributed to the pass
+		const i64 instruction_count = is_analysis ? 0 : get_instruction_count(ir);
+		std::string pass_name = is_analysis ? (name + " (analysis)").str() : name.str();
+		const u64 event_index = m_trace ? m_trace->begin_event(pass_name) : 0;
+
+		m_active_passes.push_back({
+			std::move(pass_name),
+			clock::now(),
+			{},
+			instruction_count,
+			is_analysis,
+			event_index
+		});
+	}
+
+	void pass_statistics::end_pass(
+		const llvm::Any* ir
+	) {
+		const clock::time_point end = clock::now();
+		const active_pass pass = std::move(m_active_passes.back());
+		m_active_passes.pop_back();
+
+		if (m_trace) {
+			m_trace->end_event(pass.event_index);
+		}
+
+		const clock::duration time = end - pass.start;
+
+		if (!m_active_passes.empty()) {
+			m_active_passes.back().nested_time += time;
+		}
+
+		const auto [it, inserted] = m_record_indices.try_emplace(pass.name, m_records.size());
+		if (inserted) {
+			m_records.push_back({ pass.name });
+		}
+
+		pass_record& record = m_records[it->second];
+		record.run_count++;
+		record.time += time - pass.nested_time;
+
+		if (!pass.is_analysis && ir) {
+			const i64 instruction_delta = get_instruction_count(*ir) - pass.instruction_count;
+			record.instruction_delta += instruction_delta;
+
+			if (m_trace) {
+				m_trace->add_counter(pass.event_index, "instructions", instruction_delta);
+			}
+		}
+	}
+
+	i64 pass_statistics::get_instruction_count(
+		const llvm::Any& ir
+	) {
+		if (const auto* module = llvm::any_cast<const llvm::Module*>(&ir)) {
+			return static_cast<i64>((*module)->getInstructionCount());
+		}
+
+		if (const auto* function = llvm::any_cast<const llvm::Function*>(&ir)) {
+			return static_cast<i64>((*function)->getInstructionCount());
+		}
+
+		if (const auto* scc = llvm::any_cast<const llvm::LazyCallGraph::SCC*>(&ir)) {
+			i64 count = 0;
+			for (const llvm::LazyCallGraph::Node& node : **scc) {
+				count += static_cast<i64>(node.getFunction().getInstructionCount());
+			}
+
+			return count;
+		}
+
+		if (const auto* loop = llvm::any_cast<const llvm::Loop*>(&ir)) {
+			i64 count = 0;
+			for (const llvm::BasicBlock* block : (*loop)->blocks()) {
+				count += static_cast<i64>(block->size());
+			}
+
+			return count;
+		}
+
+		return 0;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+#include "compiler/trace/trace.h"
+
+#include <llvm/IR/PassInstrumentation.h>
+
+namespace sigma {
+	/**
+	 * \brief Collects statistics about the passes of an optimization pipeline: the time spent in every pass and
+	 * the change in IR instruction count it caused. Times are exclusive, the time spent in nested passes and
+	 * analyses is only attributed to the nested pass.
+	 */
+	class pass_statistics {
+	public:
+		/**
+		 * \brief Constructs the pass statistics.
+		 * \param trace Trace every pass is additionally recorded into as a nested scope, may be nullptr
+		 */
+		pass_statistics(
+			trace* trace = nullptr
+		);
+
+		/**
+		 * \brief Registers the instrumentation callbacks used for collecting statistics, the statistics object
+		 * has to outlive the pipeline run.
+		 * \param callbacks Callbacks of the pass builder which builds the pipeline
+		 */
+		void register_callbacks(
+			llvm::PassInstrumentationCallbacks& callbacks
+		);
+
+		/**
+		 * \brief Prints a table of all passes which have been run, sorted by the time spent in them.
+		 */
+		void print() const;
+	private:
+		void begin_pass(
+			llvm::StringRef name,
+			const llvm::Any& ir,
+			bool is_analysis
+		);
+
+		void end_pass(
+			const llvm::Any* ir
+		);
+
+		/**
+		 * \brief Counts the instructions contained in the given IR unit (module, SCC, function or loop).
+		 */
+		static i64 get_instruction_count(
+			const llvm::Any& ir
+		);
+	private:
+		using clock = std::chrono::steady_clock;
+
+		struct active_pass {
+			std::string name;
+			clock::time_point start;
+			clock::duration nested_time;
+			i64 instruction_count;
+			bool is_analysis;
+			u64 event_index;
+		};
+
+		struct pass_record {
+			std::string name;
+			u64 run_count = 0;
+			clock::duration time = {};
+			i64 instruction_delta = 0;
+		};
+
+		trace* m_trace;
+
+		// passes which are currently running, innermost pass last
+		std::vector<active_pass> m_active_passes;
+
+		std::vector<pass_record> m_records;
+		std::unordered_map<std::string, u64> m_record_indices;
+	};
+}
\ No newline at end of file
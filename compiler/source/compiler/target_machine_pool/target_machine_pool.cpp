@@ -0,0 +1,44 @@
+#include "target_machine_pool.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace sigma {
+	namespace {
+		std::mutex pool_mutex;
+		std::unordered_multimap<std::string, std::unique_ptr<llvm::TargetMachine>> idle_target_machines;
+	}
+
+	target_machine_pool::handle target_machine_pool::acquire(
+		const std::string& key,
+		const factory& create
+	) {
+		std::unique_ptr<llvm::TargetMachine> target_machine;
+
+		{
+			const std::lock_guard lock(pool_mutex);
+
+			if (const auto it = idle_target_machines.find(key); it != idle_target_machines.end()) {
+				target_machine = std::move(it->second);
+				idle_target_machines.erase(it);
+			}
+		}
+
+		// no idle target machine is available, the new one joins the pool once it's released
+		if (!target_machine) {
+			target_machine = create();
+		}
+
+		return handle(target_machine.release(), [key](llvm::TargetMachine* released) {
+			release(key, released);
+		});
+	}
+
+	void target_machine_pool::release(
+		const std::string& key,
+		llvm::TargetMachine* target_machine
+	) {
+		const std::lock_guard lock(pool_mutex);
+		idle_target_machines.emplace(key, std::unique_ptr<llvm::TargetMachine>(target_machine));
+	}
+}
\ No newline at end of file
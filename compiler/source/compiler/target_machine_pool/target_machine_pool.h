@@ -0,0 +1,36 @@
+#pragma once
+#include "utility/types.h"
+
+#include <llvm/Target/TargetMachine.h>
+
+#include <functional>
+
+namespace sigma {
+	/**
+	 * \brief Process-wide pool of target machines. Target machines, and the subtargets they create lazily, are
+	 * expensive to construct, long-lived processes (ie. the compile server) reuse them between compilations.
+	 * Target machines aren't thread safe, a pooled target machine is only ever handed out to one user at a time.
+	 */
+	class target_machine_pool {
+	public:
+		using factory = std::function<std::unique_ptr<llvm::TargetMachine>()>;
+		using handle = std::unique_ptr<llvm::TargetMachine, std::function<void(llvm::TargetMachine*)>>;
+
+		/**
+		 * \brief Takes an idle target machine with the given \a key out of the pool, or creates a new one using
+		 * \a create. The target machine returns to the pool once its handle is destroyed.
+		 * \param key Configuration of the target machine (triple, CPU and features)
+		 * \param create Factory used when no idle target machine is available
+		 * \return Handle of the target machine, empty if \a create fails.
+		 */
+		static handle acquire(
+			const std::string& key,
+			const factory& create
+		);
+	private:
+		static void release(
+			const std::string& key,
+			llvm::TargetMachine* target_machine
+		);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#include "trace.h"
+
+namespace sigma {
+	trace::scope::scope(
+		trace* trace,
+		std::string name
+	) : m_trace(trace),
+	m_event_index(trace ? trace->begin_event(std::move(name)) : 0) {}
+
+	trace::scope::~scope() {
+		if (m_trace) {
+			m_trace->end_event(m_event_index);
+		}
+	}
+
+	void trace::scope::add_counter(
+		std::string name,
+		i64 value
+	) const {
+		if (m_trace) {
+			m_trace->add_counter(m_event_index, std::move(name), value);
+		}
+	}
+
+	trace::trace()
+		: m_start(clock::now()) {}
+
+	u64 trace::begin_event(
+		std::string name
+	) {
+		const clock::duration start = clock::now() - m_start;
+
+		const std::lock_guard lock(m_mutex);
+		m_events.push_back({ std::move(name), start, {}, get_thread_index(), {} });
+		return m_events.size() - 1;
+	}
+
+	void trace::end_event(
+		u64 event_index
+	) {
+		const clock::duration end = clock::now() - m_start;
+
+		const std::lock_guard lock(m_mutex);
+		m_events[event_index].duration = end - m_events[event_index].start;
+	}
+
+	void trace::add_counter(
+		u64 event_index,
+		std::string name,
+		i64 value
+	) {
+		const std::lock_guard lock(m_mutex);
+		m_events[event_index].counters.emplace_back(std::move(name), value);
+	}
+
+	error_result trace::write(
+		const filepath& path
+	) const {
+		std::ofstream file(path, std::ios::trunc);
+		if (!file.is_open()) {
+			return error::emit<1000>(path);
+		}
+
+		const auto to_microseconds = [](clock::duration duration) {
+			return std::chrono::duration<double, std::micro>(duration).count();
+		};
+
+		const std::lock_guard lock(m_mutex);
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		for (u64 i = 0; i < m_events.size(); ++i) {
+			const event& event = m_events[i];
+
+			file << (i == 0 ? "\n" : ",\n") << std::format(
+				R"({{"name":"{}","cat":"sigma","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f},"args":{{)",
+				escape_json(event.name),
+				event.thread_index,
+				to_microseconds(event.start),
+				to_microseconds(event.duration)
+			);
+
+			for (u64 j = 0; j < event.counters.size(); ++j) {
+				file << (j == 0 ? "" : ",") << std::format(
+					R"("{}":{})",
+					escape_json(event.counters[j].first),
+					event.counters[j].second
+				);
+			}
+
+			file << "}}";
+		}
+
+		file << "\n]}\n";
+
+		if (!file.good()) {
+			return error::emit<1000>(path);
+		}
+
+		return {};
+	}
+
+	u64 trace::get_thread_index() {
+		const std::thread::id id = std::this_thread::get_id();
+		const auto it = std::find(m_threads.begin(), m_threads.end(), id);
+
+		if (it != m_threads.end()) {
+			return static_cast<u64>(it - m_threads.begin());
+		}
+
+		m_threads.push_back(id);
+		return m_threads.size() - 1;
+	}
+
+	std::string trace::escape_json(
+		const std::string& value
+	) {
+		std::string output;
+		output.reserve(value.size());
+
+		for (const char c : value) {
+			switch (c) {
+			case '"':  output.append("\\\""); break;
+			case '\\': output.append("\\\\"); break;
+			case '\n': output.append("\\n"); break;
+			case '\t': output.append("\\t"); break;
+			default:
+				if (static_cast<u8>(c) < 0x20) {
+					output.append(std::format("\\u{:04x}", static_cast<u32>(c)));
+				}
+				else {
+					output.push_back(c);
+				}
+			}
+		}
+
+		return output;
+	}
+}
\ No newline at end of file
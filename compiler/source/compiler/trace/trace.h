@@ -0,0 +1,99 @@
+#pragma once
+#include "compiler/diagnostics/error.h"
+
+#include <mutex>
+#include <thread>
+
+namespace sigma {
+	/**
+	 * \brief Records timed, hierarchical scopes of a compilation and writes them into a Chrome trace_event
+	 * JSON file, which can be loaded into chrome://tracing or Perfetto. Scopes nest by time on the thread which
+	 * recorded them, and carry counters (ie. token or instruction counts). Events can be recorded from
+	 * multiple threads at once.
+	 */
+	class trace {
+	public:
+		/**
+		 * \brief RAII wrapper which records an event for its lifetime. Scopes constructed with a null trace
+		 * don't record anything, which allows instrumentation to stay in place when tracing is disabled.
+		 */
+		class scope {
+		public:
+			scope(
+				trace* trace,
+				std::string name
+			);
+
+			~scope();
+
+			scope(const scope&) = delete;
+			scope& operator=(const scope&) = delete;
+
+			/**
+			 * \brief Attaches a counter to the recorded event.
+			 * \param name Name of the counter
+			 * \param value Value of the counter
+			 */
+			void add_counter(
+				std::string name,
+				i64 value
+			) const;
+		private:
+			trace* m_trace;
+			u64 m_event_index;
+		};
+
+		trace();
+
+		/**
+		 * \brief Begins a new event on the current thread.
+		 * \param name Name of the event
+		 * \return Index of the event, used for ending it and attaching counters.
+		 */
+		u64 begin_event(
+			std::string name
+		);
+
+		void end_event(
+			u64 event_index
+		);
+
+		void add_counter(
+			u64 event_index,
+			std::string name,
+			i64 value
+		);
+
+		/**
+		 * \brief Writes all recorded events into a trace_event JSON file at the given \a path.
+		 * \return Optional error message containing information about a potential error.
+		 */
+		error_result write(
+			const filepath& path
+		) const;
+	private:
+		/**
+		 * \brief Gets a small, stable identifier of the calling thread.
+		 */
+		u64 get_thread_index();
+
+		static std::string escape_json(
+			const std::string& value
+		);
+	private:
+		using clock = std::chrono::steady_clock;
+
+		struct event {
+			std::string name;
+			clock::duration start;
+			clock::duration duration;
+			u64 thread_index;
+			std::vector<std::pair<std::string, i64>> counters;
+		};
+
+		mutable std::mutex m_mutex;
+		clock::time_point m_start;
+		std::vector<event> m_events;
+		std::vector<std::thread::id> m_threads;
+	};
+}
\ No newline at end of file
@@ -1,23 +1,31 @@
 #include "char_by_char_lexer.h"
 
 namespace sigma {
-	error_result char_by_char_lexer::tokenize() {
-		// tokenize
-		token tok = token::unknown;
-		while(tok != token::end_of_file) {
-			if(auto next_token_error_message = extract_next_token(tok)) {
-				return next_token_error_message;
-			}
+	error_result char_by_char_lexer::tokenize_next(token& tok) {
+		if(auto next_token_error_message = extract_next_token(tok)) {
+			return next_token_error_message;
+		}
 
-			m_tokens.push_back({ 
+		// char and string literals have their escape sequences decoded, the rest of our token values are
+		// spans of the source text
+		if (tok == token::char_literal || tok == token::string_literal) {
+			m_tokens->add_literal_token(
 				tok,
 				m_value_string,
-				file_position {
-					m_source_path,
-					m_current_line,
-					m_current_character
-				}
-			});
+				static_cast<u32>(m_current_line),
+				static_cast<u32>(m_current_character)
+			);
+		}
+		else {
+			m_tokens->add_token(
+				tok,
+				static_cast<u32>(m_token_start),
+				static_cast<u32>(m_value_string.size()),
+				static_cast<u32>(m_current_line),
+				static_cast<u32>(m_current_character),
+				// intern identifiers so that later stages can use integer keys
+				tok == token::identifier ? m_symbol_table->intern(m_value_string) : symbol{}
+			);
 		}
 
 		return {};
@@ -41,6 +49,9 @@ namespace sigma {
 			read_char();
 		}
 
+		// the last character has already been consumed by the accessor
+		m_token_start = m_accessor.get_position() > 0 ? m_accessor.get_position() - 1 : 0;
+
 		// identifiers
 		// extract identifiers
 		if(isalpha(m_last_character) && !m_accessor.end()) {
@@ -285,19 +296,4 @@ namespace sigma {
 		tok = token::string_literal;
 		return {};
 	}
-
-	token_data::token_data(token tok, const std::string& value, const file_position& location)
-		: m_token(tok), m_value(value), m_position(location) {}
-
-	token token_data::get_token() const	{
-		return m_token;
-	}
-
-	const std::string& token_data::get_value() const {
-		return m_value;
-	}
-
-	const file_position& token_data::get_token_location() const {
-		return m_position;
-	}
 }
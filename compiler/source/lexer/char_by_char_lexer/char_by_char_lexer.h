@@ -9,7 +9,7 @@ namespace sigma {
 	public:
 		char_by_char_lexer() = default;
 
-		error_result tokenize() override;
+		error_result tokenize_next(token& tok) override;
 	private:
 		/**
 		 * \brief Helper function that reads the next char in the provided source file and advances the accessor caret.
@@ -40,6 +40,7 @@ namespace sigma {
 	private:
 		char m_last_character = ' ';
 		std::string m_value_string;
+		u64 m_token_start = 0; // source offset of the current token
 		u64 m_current_line = 1;
 		u64 m_current_character = 1;
 	};
@@ -1,52 +1,98 @@
 #include "lexer.h"
+#include "lexer/token_stream.h"
 #include "utility/filesystem.h"
 
 namespace sigma {
-	token_list::token_list(std::vector<token_data> tokens)
-		: m_tokens(tokens) {}
+	token_list::token_list(std::shared_ptr<const token_buffer> tokens)
+		: m_tokens(std::move(tokens)) {}
 
+	token_list::token_list(std::shared_ptr<token_stream> stream)
+		: m_stream(std::move(stream)) {}
 
 	void token_list::print_tokens() const {
-		for (const token_data& t : m_tokens) {
-			console::out << std::left << std::setw(40) << token_to_string(t.get_token());
+		if (m_tokens == nullptr) {
+			return;
+		}
+
+		for (u64 i = 0; i < m_tokens->get_token_count(); i++) {
+			console::out << std::left << std::setw(40) << token_to_string(m_tokens->get_token(i));
 
-			if (!t.get_value().empty()) {
+			const std::string_view value = m_tokens->get_value(i);
+			if (!value.empty()) {
 				// the value string may contain escape sequences 
-				console::out << escape_string(t.get_value());
+				console::out << escape_string(std::string(value));
 			}
 
 			console::out << '\n';
 		}
 	}
 
-	const token_data& token_list::get_token() {
+	token_data token_list::get_token() {
 		m_peek_token_index++;
-		return  m_tokens[m_main_token_index++];
+		const token_data data = get_token_data(m_main_token_index++);
+
+		if (m_stream) {
+			// we won't return to the tokens before the main index
+			m_stream->release(m_main_token_index);
+		}
+
+		return data;
 	}
 
-	const token_data& token_list::peek_token() {
-		return m_tokens[m_peek_token_index++];
+	token_data token_list::peek_token() {
+		return get_token_data(m_peek_token_index++);
 	}
 
 	void token_list::synchronize_indices() {
 		m_peek_token_index = m_main_token_index;
 	}
 
+	token_data token_list::get_token_data(
+		u64 index
+	) const {
+		return m_stream ? m_stream->get_token(index) : m_tokens->get_token_data(index);
+	}
+
+	error_result lexer::tokenize() {
+		token tok = token::unknown;
+		while (tok != token::end_of_file) {
+			if (auto next_token_error = tokenize_next(tok)) {
+				return next_token_error; // return on failure
+			}
+		}
+
+		return {};
+	}
+
 	error_result lexer::set_source_filepath(
 		const filepath& path
 	) {
 		// check if the file exists, and if it has been opened successfully
-		auto file_read_result = detail::read_file(path);
-		if(!file_read_result.has_value()) {
-			return file_read_result.error();
+		auto file_map_result = detail::map_file(path);
+		if(!file_map_result.has_value()) {
+			return file_map_result.error();
 		}
 
+		// the token buffer keeps the source file alive, the accessor reads from it directly
 		m_source_path = path;
-		m_accessor = detail::string_accessor(file_read_result.value());
+		m_tokens = std::make_shared<token_buffer>(file_map_result.value());
+		m_source = m_tokens->get_source();
+		m_accessor = detail::string_accessor(m_source);
+
 		return {};
 	}
 
+	void lexer::set_symbol_table(
+		std::shared_ptr<symbol_table> symbol_table
+	) {
+		m_symbol_table = symbol_table;
+	}
+
 	token_list lexer::get_token_list() const {
 		return { m_tokens };
 	}
+
+	u64 lexer::get_token_count() const {
+		return m_tokens ? m_tokens->get_token_count() : 0;
+	}
 }
\ No newline at end of file
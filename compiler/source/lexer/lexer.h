@@ -1,43 +1,29 @@
 #pragma once
-#include "lexer/token.h"
+#include "lexer/token_buffer.h"
 #include "compiler/diagnostics/error.h"
 #include "utility/containers/string_accessor.h"
 
 namespace sigma {
-	/**
-	 * \brief Set of information related to a specific token, at a specific location.
-	 */
-	struct token_data {
-		token_data() = default;
-
-		token_data(
-			token tok,
-			const std::string& value,
-			const file_position& location
-		);
-
-		token get_token() const;
-		const std::string& get_value() const;
-		const file_position& get_token_location() const;
-	private:
-		// token type representation of the given token
-		token m_token = token::unknown;
-		// token value of the given token (ie. the identifier value of an identifier token)
-		std::string m_value;
-		// location of the given token
-		file_position m_position;
-	};
+	class token_stream;
 
 	/**
-	 * \brief Represents a list of tokens. Implements various utility functions for token traversal.
+	 * \brief Represents a list of tokens. Implements various utility functions for token traversal. The list
+	 * shares the underlying token buffer or token stream, copying it does not copy any tokens.
 	 */
 	class token_list {
 	public:
 		token_list() = default;
-		token_list(std::vector<token_data> tokens);
+		token_list(std::shared_ptr<const token_buffer> tokens);
 
 		/**
-		 * \brief Prints all the contained tokens, if there are any.
+		 * \brief Constructs a token list which pulls its tokens from the given \a stream on demand. Tokens
+		 * which precede the main index are released, and may be overwritten by the stream.
+		 * \param stream Token stream to read
+		 */
+		token_list(std::shared_ptr<token_stream> stream);
+
+		/**
+		 * \brief Prints all the contained tokens, if there are any. Streamed tokens cannot be printed.
 		 */
 		void print_tokens() const;
 
@@ -45,20 +31,25 @@ namespace sigma {
 		 * \brief Accesses the next token and advances all indices.
 		 * \return Last token.
 		 */
-		const token_data& get_token();
+		token_data get_token();
 
 		/**
 		 * \brief Accesses the next token and advances the peek index (while leaving the main index same).
 		 * \return Last token.
 		 */
-		const token_data& peek_token();
+		token_data peek_token();
 
 		/**
 		 * \brief Synchronizes the peek and main indices.
 		 */
 		void synchronize_indices();
 	private:
-		std::vector<token_data> m_tokens;
+		token_data get_token_data(
+			u64 index
+		) const;
+	private:
+		std::shared_ptr<const token_buffer> m_tokens;
+		std::shared_ptr<token_stream> m_stream;
 
 		u64 m_main_token_index = 0;
 		u64 m_peek_token_index = 0;
@@ -73,7 +64,14 @@ namespace sigma {
 		 * \brief Traverses the entire file and generates a list of tokens which can be traversed later.
 		 * \return Potentially erroneous result.
 		 */
-		virtual error_result tokenize() = 0;
+		error_result tokenize();
+
+		/**
+		 * \brief Extracts the next token from the source file and appends it to the token buffer.
+		 * \param tok Extracted token
+		 * \return Potentially erroneous result.
+		 */
+		virtual error_result tokenize_next(token& tok) = 0;
 		virtual ~lexer() = default;
 
 		/**
@@ -85,97 +83,116 @@ namespace sigma {
 			const filepath& path
 		);
 
+		/**
+		 * \brief Sets the symbol table which identifiers get interned into.
+		 * \param symbol_table Compilation-wide symbol table
+		 */
+		void set_symbol_table(
+			std::shared_ptr<symbol_table> symbol_table
+		);
+
 		token_list get_token_list() const;
+
+		/**
+		 * \brief Gets the number of tokens which have been extracted from the current source file so far.
+		 * \return Token count.
+		 */
+		u64 get_token_count() const;
 	protected:
-		std::vector<token_data> m_tokens;
+		// token streams swap the token buffer for a bounded one
+		friend class token_stream;
+
+		std::shared_ptr<token_buffer> m_tokens;
+		std::string_view m_source; // source text of the current file
 		filepath m_source_path;
 		detail::string_accessor m_accessor;
+		std::shared_ptr<symbol_table> m_symbol_table;
 
 		// tokens that are longer than one character 
-		const std::unordered_map<std::string, token> m_keyword_tokens = {
-			{ "struct" , token::keyword_type_structure },
-			{ "void"   , token::keyword_type_void      },
-			{ "bool"   , token::keyword_type_bool      },
-			{ "include", token::keyword_include        },
+		static constexpr auto m_keyword_tokens = make_hash_map(
+			std::pair{ "struct" , token::keyword_type_structure },
+			std::pair{ "void"   , token::keyword_type_void      },
+			std::pair{ "bool"   , token::keyword_type_bool      },
+			std::pair{ "include", token::keyword_include        },
 
-			{ "true"   , token::bool_literal_true      },
-			{ "false"  , token::bool_literal_false     },
+			std::pair{ "true"   , token::bool_literal_true      },
+			std::pair{ "false"  , token::bool_literal_false     },
 
 			// signed integers			
-			{ "i8"     , token::keyword_type_i8        },
-			{ "i16"    , token::keyword_type_i16       },
-			{ "i32"    , token::keyword_type_i32       },
-			{ "i64"    , token::keyword_type_i64       },
+			std::pair{ "i8"     , token::keyword_type_i8        },
+			std::pair{ "i16"    , token::keyword_type_i16       },
+			std::pair{ "i32"    , token::keyword_type_i32       },
+			std::pair{ "i64"    , token::keyword_type_i64       },
 
 			// unsigned integers		 
-			{ "u8"     , token::keyword_type_u8        },
-			{ "u16"    , token::keyword_type_u16       },
-			{ "u32"    , token::keyword_type_u32       },
-			{ "u64"    , token::keyword_type_u64       },
+			std::pair{ "u8"     , token::keyword_type_u8        },
+			std::pair{ "u16"    , token::keyword_type_u16       },
+			std::pair{ "u32"    , token::keyword_type_u32       },
+			std::pair{ "u64"    , token::keyword_type_u64       },
 
 			// floating point			 
-			{ "f32"    , token::keyword_type_f32       },
-			{ "f64"    , token::keyword_type_f64       },
+			std::pair{ "f32"    , token::keyword_type_f32       },
+			std::pair{ "f64"    , token::keyword_type_f64       },
 
 			// text
-			{ "char"   , token::keyword_type_char      },
+			std::pair{ "char"   , token::keyword_type_char      },
 
 			// control flow
-			{ "return" , token::keyword_return         },
-			{ "if"     , token::keyword_if             },
-			{ "else"   , token::keyword_else           },
-			{ "while"  , token::keyword_while          },
-			{ "for"    , token::keyword_for            },
-			{ "break"  , token::keyword_break          },
-
-			{ "new"    , token::keyword_new            },
-		};
+			std::pair{ "return" , token::keyword_return         },
+			std::pair{ "if"     , token::keyword_if             },
+			std::pair{ "else"   , token::keyword_else           },
+			std::pair{ "while"  , token::keyword_while          },
+			std::pair{ "for"    , token::keyword_for            },
+			std::pair{ "break"  , token::keyword_break          },
+
+			std::pair{ "new"    , token::keyword_new            }
+		);
 
 		// tokens that consist of special chars (non-alphabetical and non-digit chars), note that the "//"
 		// combination is not included here because it is being handled as a comment and thus needs different
 		// logic.
-		const std::unordered_map<std::string, token> m_special_tokens = {
-			{ "(" , token::l_parenthesis                      },
-			{ ")" , token::r_parenthesis                      },
-			{ "{" , token::l_brace                            },
-			{ "}" , token::r_brace                            },
-			{ "[" , token::l_bracket                          },
-			{ "]" , token::r_bracket                          },
-			{ "," , token::comma                              },
-			{ ";" , token::semicolon                          },
-			{ "\'", token::single_quote                       },
-			{ "\"", token::double_quote                       },
-			{ "#" , token::hash                               },
+		static constexpr auto m_special_tokens = make_hash_map(
+			std::pair{ "(" , token::l_parenthesis                      },
+			std::pair{ ")" , token::r_parenthesis                      },
+			std::pair{ "{" , token::l_brace                            },
+			std::pair{ "}" , token::r_brace                            },
+			std::pair{ "[" , token::l_bracket                          },
+			std::pair{ "]" , token::r_bracket                          },
+			std::pair{ "," , token::comma                              },
+			std::pair{ ";" , token::semicolon                          },
+			std::pair{ "\'", token::single_quote                       },
+			std::pair{ "\"", token::double_quote                       },
+			std::pair{ "#" , token::hash                               },
 
 			// operators								      
-			{ "+" , token::operator_addition                  },
-			{ "++", token::operator_increment                 },
-			{ "+=", token::operator_addition_assignment       },
-			{ "-" , token::operator_subtraction               },
-			{ "--", token::operator_decrement                 },
-			{ "-=", token::operator_subtraction_assignment    },
-			{ "*" , token::operator_multiplication            },
-			{ "*=", token::operator_multiplication_assignment },
-			{ "%" , token::operator_modulo                    },
-			{ "%=", token::operator_modulo_assignment         },
-			{ "/" , token::operator_division                  },
-			{ "/=", token::operator_division_assignment       },
-			{ "=" , token::operator_assignment                },
-			{ "==", token::operator_equals                    },
-			{ ">" , token::operator_greater_than              },
-			{ ">>", token::operator_bitwise_right_shift       },
-			{ ">=", token::operator_greater_than_equal_to     },
-			{ "<" , token::operator_less_than                 },
-			{ "<<", token::operator_bitwise_left_shift        },
-			{ "<=", token::operator_less_than_equal_to        },
-			{ "!" , token::operator_not                       },
-			{ "!=", token::operator_not_equals                },
-			{ "&" , token::operator_bitwise_and               },
-			{ "&&", token::operator_logical_conjunction       },
-			{ "|" , token::operator_bitwise_or                },
-			{ "||", token::operator_logical_disjunction       },
-			{ "~" , token::operator_bitwise_not               },
-			{ "^" , token::operator_bitwise_xor               },
-		};
+			std::pair{ "+" , token::operator_addition                  },
+			std::pair{ "++", token::operator_increment                 },
+			std::pair{ "+=", token::operator_addition_assignment       },
+			std::pair{ "-" , token::operator_subtraction               },
+			std::pair{ "--", token::operator_decrement                 },
+			std::pair{ "-=", token::operator_subtraction_assignment    },
+			std::pair{ "*" , token::operator_multiplication            },
+			std::pair{ "*=", token::operator_multiplication_assignment },
+			std::pair{ "%" , token::operator_modulo                    },
+			std::pair{ "%=", token::operator_modulo_assignment         },
+			std::pair{ "/" , token::operator_division                  },
+			std::pair{ "/=", token::operator_division_assignment       },
+			std::pair{ "=" , token::operator_assignment                },
+			std::pair{ "==", token::operator_equals                    },
+			std::pair{ ">" , token::operator_greater_than              },
+			std::pair{ ">>", token::operator_bitwise_right_shift       },
+			std::pair{ ">=", token::operator_greater_than_equal_to     },
+			std::pair{ "<" , token::operator_less_than                 },
+			std::pair{ "<<", token::operator_bitwise_left_shift        },
+			std::pair{ "<=", token::operator_less_than_equal_to        },
+			std::pair{ "!" , token::operator_not                       },
+			std::pair{ "!=", token::operator_not_equals                },
+			std::pair{ "&" , token::operator_bitwise_and               },
+			std::pair{ "&&", token::operator_logical_conjunction       },
+			std::pair{ "|" , token::operator_bitwise_or                },
+			std::pair{ "||", token::operator_logical_disjunction       },
+			std::pair{ "~" , token::operator_bitwise_not               },
+			std::pair{ "^" , token::operator_bitwise_xor               }
+		);
 	};
 }
@@ -0,0 +1,514 @@
+#include "simd_lexer.h"
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SIMD_LEXER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SIMD_LEXER_SSE2
+#endif
+
+namespace sigma {
+	namespace {
+		// every block function returns a bit mask with one bit per character of the block, bits are set for
+		// characters which belong to the given character class. blocks have to lie inside of the source text.
+#if defined(SIMD_LEXER_AVX2)
+		constexpr u64 block_width = 32;
+		using block = __m256i;
+
+		block load_block(const char* data) {
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+		}
+
+		u64 to_mask(block value) {
+			return static_cast<u32>(_mm256_movemask_epi8(value));
+		}
+
+		block equal(block value, char c) {
+			return _mm256_cmpeq_epi8(value, _mm256_set1_epi8(c));
+		}
+
+		block in_range(block value, char first, char last) {
+			// signed comparisons, characters above 127 are negative and never fall into an ASCII range
+			return _mm256_and_si256(
+				_mm256_cmpgt_epi8(value, _mm256_set1_epi8(static_cast<char>(first - 1))),
+				_mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(last + 1)), value)
+			);
+		}
+
+		block either(block left, block right) {
+			return _mm256_or_si256(left, right);
+		}
+#elif defined(SIMD_LEXER_SSE2)
+		constexpr u64 block_width = 16;
+		using block = __m128i;
+
+		block load_block(const char* data) {
+			return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+		}
+
+		u64 to_mask(block value) {
+			return static_cast<u32>(_mm_movemask_epi8(value));
+		}
+
+		block equal(block value, char c) {
+			return _mm_cmpeq_epi8(value, _mm_set1_epi8(c));
+		}
+
+		block in_range(block value, char first, char last) {
+			// signed comparisons, characters above 127 are negative and never fall into an ASCII range
+			return _mm_and_si128(
+				_mm_cmpgt_epi8(value, _mm_set1_epi8(static_cast<char>(first - 1))),
+				_mm_cmplt_epi8(value, _mm_set1_epi8(static_cast<char>(last + 1)))
+			);
+		}
+
+		block either(block left, block right) {
+			return _mm_or_si128(left, right);
+		}
+#else
+		// scalar fallback, characters are classified one by one
+		constexpr u64 block_width = 16;
+#endif
+
+#if defined(SIMD_LEXER_AVX2) || defined(SIMD_LEXER_SSE2)
+		u64 whitespace_mask(const char* data) {
+			const block value = load_block(data);
+			return to_mask(either(equal(value, ' '), in_range(value, '\t', '\r')));
+		}
+
+		u64 identifier_mask(const char* data) {
+			const block value = load_block(data);
+			return to_mask(either(
+				either(in_range(value, 'a', 'z'), in_range(value, 'A', 'Z')),
+				either(in_range(value, '0', '9'), equal(value, '_'))
+			));
+		}
+
+		u64 digit_mask(const char* data) {
+			return to_mask(in_range(load_block(data), '0', '9'));
+		}
+
+		u64 character_mask(const char* data, char first, char second) {
+			const block value = load_block(data);
+			return to_mask(either(equal(value, first), equal(value, second)));
+		}
+
+		u64 newline_mask(const char* data) {
+			return to_mask(equal(load_block(data), '\n'));
+		}
+#else
+		template<typename predicate>
+		u64 build_mask(const char* data, predicate pred) {
+			u64 mask = 0;
+			for (u64 i = 0; i < block_width; i++) {
+				mask |= static_cast<u64>(pred(static_cast<unsigned char>(data[i]))) << i;
+			}
+
+			return mask;
+		}
+
+		u64 whitespace_mask(const char* data) {
+			return build_mask(data, [](unsigned char c) { return isspace(c) != 0; });
+		}
+
+		u64 identifier_mask(const char* data) {
+			return build_mask(data, [](unsigned char c) { return isalnum(c) || c == '_'; });
+		}
+
+		u64 digit_mask(const char* data) {
+			return build_mask(data, [](unsigned char c) { return isdigit(c) != 0; });
+		}
+
+		u64 character_mask(const char* data, char first, char second) {
+			return build_mask(data, [=](unsigned char c) { return c == static_cast<unsigned char>(first) || c == static_cast<unsigned char>(second); });
+		}
+
+		u64 newline_mask(const char* data) {
+			return build_mask(data, [](unsigned char c) { return c == '\n'; });
+		}
+#endif
+
+		constexpr u64 full_block_mask = block_width == 64 ? ~0ull : (1ull << block_width) - 1;
+
+		/**
+		 * \brief Finds the first character in [index, size) whose block mask bit matches \a match_set.
+		 * \return Offset of the located character, \a size if there is none.
+		 */
+		template<typename block_function, typename scalar_function>
+		u64 find_first(
+			const char* data,
+			u64 index,
+			u64 size,
+			bool match_set,
+			block_function block_mask,
+			scalar_function scalar_match
+		) {
+			while (index + block_width <= size) {
+				u64 mask = block_mask(data + index);
+				if (!match_set) {
+					mask = ~mask & full_block_mask;
+				}
+
+				if (mask) {
+					return index + std::countr_zero(mask);
+				}
+
+				index += block_width;
+			}
+
+			// scalar tail
+			while (index < size && scalar_match(static_cast<unsigned char>(data[index])) != match_set) {
+				index++;
+			}
+
+			return index;
+		}
+
+		// scalar predicates, libc classification functions return int and can't be compared against bool directly
+		bool is_whitespace_character(unsigned char c) {
+			return isspace(c) != 0;
+		}
+
+		bool is_identifier_character(unsigned char c) {
+			return isalnum(c) != 0 || c == '_';
+		}
+
+		bool is_digit_character(unsigned char c) {
+			return isdigit(c) != 0;
+		}
+	}
+
+	simd_lexer::simd_lexer()
+		: m_double_character_tokens(256 * 256, token::unknown) {
+		m_single_character_tokens.fill(token::unknown);
+
+		for (const auto& [str, tok] : m_special_tokens) {
+			if (str.size() == 1) {
+				m_single_character_tokens[static_cast<u8>(str[0])] = tok;
+			}
+			else {
+				m_double_character_tokens[static_cast<u8>(str[0]) << 8 | static_cast<u8>(str[1])] = tok;
+			}
+		}
+	}
+
+	error_result simd_lexer::tokenize_next(token& tok) {
+		if (auto next_token_error_message = extract_next_token(tok)) {
+			return next_token_error_message;
+		}
+
+		update_location();
+
+		// char and string literals have their escape sequences decoded, the rest of our token values are
+		// spans of the source text
+		if (tok == token::char_literal || tok == token::string_literal) {
+			m_tokens->add_literal_token(
+				tok,
+				m_value_string,
+				static_cast<u32>(m_current_line),
+				static_cast<u32>(m_current_character)
+			);
+		}
+		else {
+			const std::string_view value = m_source.substr(m_token_start, m_value_length);
+
+			m_tokens->add_token(
+				tok,
+				static_cast<u32>(m_token_start),
+				static_cast<u32>(m_value_length),
+				static_cast<u32>(m_current_line),
+				static_cast<u32>(m_current_character),
+				// intern identifiers so that later stages can use integer keys
+				tok == token::identifier ? m_symbol_table->intern(value) : symbol{}
+			);
+		}
+
+		return {};
+	}
+
+	error_result simd_lexer::extract_next_token(token& tok) {
+		m_value_length = 0;
+
+		// ignore spaces between tokens 
+		m_position = find_first(m_source.data(), m_position, m_source.size(), false, whitespace_mask, is_whitespace_character);
+		m_token_start = std::min(m_position, m_source.size());
+
+		const char c = get_current_character();
+
+		// identifiers
+		if (isalpha(static_cast<unsigned char>(c)) && !is_at_end()) {
+			return get_identifier_token(tok);
+		}
+
+		// numbers
+		if (isdigit(static_cast<unsigned char>(c)) && !is_at_end()) {
+			return get_numerical_token(tok);
+		}
+
+		if (c == '\'') {
+			return get_char_literal_token(tok);
+		}
+
+		if (c == '"') {
+			return get_string_literal_token(tok);
+		}
+
+		// prevent '.' characters from being located at the beginning of a token
+		if (c == '.') {
+			return error::emit<2000>();
+		}
+
+		if (is_at_end()) {
+			tok = token::end_of_file;
+			return {};
+		}
+
+		// special tokens
+		const token short_token = m_single_character_tokens[static_cast<u8>(c)];
+		if (short_token != token::unknown) {
+			m_position++;
+			const char next = get_current_character();
+
+			// check if we can find a longer token using the next character
+			if (!isspace(static_cast<unsigned char>(next)) && !isalnum(static_cast<unsigned char>(next))) {
+				const token long_token = m_double_character_tokens[static_cast<u8>(c) << 8 | static_cast<u8>(next)];
+				if (long_token != token::unknown) {
+					m_position++;
+					tok = long_token;
+					return {};
+				}
+
+				// comments, ignore all remaining data on the current line and return the following token
+				if (next == '/') {
+					m_position = find_first(
+						m_source.data(),
+						m_position + 1,
+						m_source.size(),
+						true,
+						[](const char* data) { return character_mask(data, '\n', '\r'); },
+						[](unsigned char ch) { return ch == '\n' || ch == '\r'; }
+					);
+
+					return extract_next_token(tok);
+				}
+			}
+
+			tok = short_token;
+			return {};
+		}
+
+		// not a token, return an identifier
+		// note: unlike the char_by_char_lexer we skip the character, which would otherwise be returned forever
+		m_position++;
+		m_value_length = 1;
+		tok = token::identifier;
+		return {};
+	}
+
+	error_result simd_lexer::get_identifier_token(token& tok) {
+		// read until we reach the end of our identifier, or the end of the file
+		const u64 end = find_first(m_source.data(), m_position + 1, m_source.size(), false, identifier_mask, is_identifier_character);
+		const std::string_view identifier(m_source.data() + m_position, end - m_position);
+
+		// prevent two underscore characters from being right next to each other
+		if (identifier.find("__") != std::string_view::npos) {
+			return error::emit<2001>();
+		}
+
+		m_position = end;
+
+		// check if the current identifier is a keyword
+		const auto keyword = m_keyword_tokens.find(identifier);
+		if (keyword != m_keyword_tokens.end()) {
+			tok = keyword->second;
+			return {};
+		}
+
+		m_value_length = identifier.size();
+		tok = token::identifier;
+		return {};
+	}
+
+	error_result simd_lexer::get_numerical_token(token& tok) {
+		// keep track of whether we've met the '.' character
+		bool dot_met = false;
+		u64 end = m_position + 1;
+
+		while (true) {
+			end = find_first(m_source.data(), end, m_source.size(), false, digit_mask, is_digit_character);
+			const char c = end < m_source.size() ? m_source[end] : '\0';
+
+			if (c == '.') {
+				if (dot_met) {
+					return error::emit<2002>();
+				}
+
+				dot_met = true;
+				end++;
+				continue;
+			}
+
+			m_value_length = end - m_position;
+
+			if (c == 'u') {
+				if (dot_met) {
+					return error::emit<2003>();
+				}
+
+				// 0u format
+				m_position = end + 1;
+				tok = token::number_unsigned;
+				return {};
+			}
+
+			if (c == 'f') {
+				if (!dot_met) {
+					return error::emit<2004>();
+				}
+
+				// 0.0f format
+				m_position = end + 1;
+				tok = token::number_f32;
+				return {};
+			}
+
+			break;
+		}
+
+		m_position = end;
+
+		// 0.0 format, 0 format
+		tok = dot_met ? token::number_f64 : token::number_signed;
+		return {};
+	}
+
+	error_result simd_lexer::get_char_literal_token(token& tok) {
+		m_value_string.clear();
+		m_position++; // read the character after the opening quote
+
+		if (is_at_end()) {
+			return error::emit<2005>();
+		}
+
+		// handle escape characters
+		if (get_current_character() == '\\') {
+			m_position++;
+			switch (get_current_character()) {
+			case '\\': m_value_string += '\\'; break;
+			case '\'': m_value_string += '\''; break;
+			case 'n': m_value_string += '\n'; break;
+			case 't': m_value_string += '\t'; break;
+			case 'r': m_value_string += '\r'; break;
+			default: m_value_string += get_current_character(); break;
+			}
+		}
+		else {
+			m_value_string += get_current_character();
+		}
+
+		m_position++; // read the character after the literal
+
+		if (get_current_character() == '\'') {
+			m_position++; // read the character after the closing quote
+			tok = token::char_literal;
+			return {};
+		}
+
+		return error::emit<2005>();
+	}
+
+	error_result simd_lexer::get_string_literal_token(token& tok) {
+		m_value_string.clear();
+		m_position++;
+
+		while (true) {
+			// copy everything up to the closing quote or the next escape sequence
+			const u64 end = find_first(
+				m_source.data(),
+				m_position,
+				m_source.size(),
+				true,
+				[](const char* data) { return character_mask(data, '"', '\\'); },
+				[](unsigned char c) { return c == '"' || c == '\\'; }
+			);
+
+			m_value_string.append(m_source.data() + m_position, end - m_position);
+			m_position = end;
+
+			if (is_at_end() || get_current_character() == '"') {
+				break;
+			}
+
+			// handle escape sequences
+			m_position++;
+			switch (get_current_character()) {
+			case '\\': m_value_string += '\\'; break;
+			case '\"': m_value_string += '\"'; break;
+			case 'n': m_value_string += '\n'; break;
+			case 't': m_value_string += '\t'; break;
+			case 'r': m_value_string += '\r'; break;
+			case 'x': { // handle hexadecimal escape sequence
+				char hex_chars[3] = { 0 };
+				m_position++;
+				hex_chars[0] = get_current_character();
+				m_position++;
+				hex_chars[1] = get_current_character();
+				u64 hex_value;
+				sscanf_s(hex_chars, "%" SCNx64, &hex_value);
+				m_value_string += static_cast<char>(hex_value);
+				break;
+			}
+			default: m_value_string += '\\'; m_value_string += get_current_character(); break;
+			}
+
+			m_position++;
+		}
+
+		if (is_at_end()) {
+			return error::emit<2006>();
+		}
+
+		m_position++;
+		tok = token::string_literal;
+		return {};
+	}
+
+	void simd_lexer::update_location() {
+		// the char_by_char_lexer counts a newline once it reads the character that follows it, so newlines up
+		// to the current character (exclusive) are counted
+		const u64 end = std::min(m_position, m_source.size());
+		u64 index = m_line_cursor;
+
+		while (index + block_width <= end) {
+			const u64 mask = newline_mask(m_source.data() + index);
+			if (mask) {
+				m_line_count += std::popcount(mask);
+				m_last_newline = static_cast<i64>(index + std::bit_width(mask) - 1);
+			}
+
+			index += block_width;
+		}
+
+		for (; index < end; index++) {
+			if (m_source[index] == '\n') {
+				m_line_count++;
+				m_last_newline = static_cast<i64>(index);
+			}
+		}
+
+		m_line_cursor = std::max(m_line_cursor, end);
+		m_current_line = m_line_count + 1;
+		m_current_character = m_position + 1 - m_last_newline;
+	}
+
+	char simd_lexer::get_current_character() const {
+		// the end of the source behaves like a null terminator
+		return m_position < m_source.size() ? m_source[m_position] : '\0';
+	}
+
+	bool simd_lexer::is_at_end() const {
+		return m_position >= m_source.size();
+	}
+}
\ No newline at end of file
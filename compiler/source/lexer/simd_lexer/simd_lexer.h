@@ -0,0 +1,67 @@
+#pragma once
+#include "lexer/lexer.h"
+
+namespace sigma {
+	/**
+	 * \brief Lexer which classifies the source text in blocks of 32 (AVX2) or 16 (SSE2) characters at a time,
+	 * with a scalar fallback for other targets and for the tail of the source. Whitespace, comments, identifiers,
+	 * numbers and string literals are scanned block by block, everything else is handled one character at a time.
+	 * Produces the same token stream as the char_by_char_lexer.
+	 */
+	class simd_lexer : public lexer {
+	public:
+		simd_lexer();
+
+		error_result tokenize_next(token& tok) override;
+	private:
+		/**
+		 * \brief Extracts the next token from the source text.
+		 * \param tok Extracted token
+		 * \return Potentially erroneous result.
+		 */
+		error_result extract_next_token(token& tok);
+
+		/**
+		 * \brief Extracts the next identifier or keyword token, the current character has to be alphabetical.
+		 * \param tok Keyword/identifier token, depending on the format and keyword availability
+		 * \return Potentially erroneous result.
+		 */
+		error_result get_identifier_token(token& tok);
+
+		/**
+		 * \brief Extracts the next numerical token, the current character has to be a digit.
+		 * \param tok Best-fitting numerical token
+		 * \return Potentially erroneous result.
+		 */
+		error_result get_numerical_token(token& tok);
+
+		error_result get_char_literal_token(token& tok);
+
+		error_result get_string_literal_token(token& tok);
+
+		/**
+		 * \brief Recalculates the line and character numbers for the current position. The numbers match the
+		 * ones the char_by_char_lexer reports after reading the same character.
+		 */
+		void update_location();
+
+		char get_current_character() const;
+		bool is_at_end() const;
+	private:
+		u64 m_position = 0;     // index of the current character
+		u64 m_token_start = 0;  // source offset of the current token
+		u64 m_value_length = 0; // length of the current token value, for values which are a span of the source
+		std::string m_value_string; // decoded char and string literal value
+
+		// special token lookup tables, generated from m_special_tokens
+		std::array<token, 256> m_single_character_tokens;
+		std::vector<token> m_double_character_tokens; // indexed by (first << 8) | second
+
+		// line tracking
+		u64 m_line_cursor = 0;   // newlines before this offset have already been counted
+		u64 m_line_count = 0;
+		i64 m_last_newline = -1; // offset of the last counted newline
+		u64 m_current_line = 1;
+		u64 m_current_character = 1;
+	};
+}
\ No newline at end of file
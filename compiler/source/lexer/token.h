@@ -1,8 +1,9 @@
 #pragma once
 #include "utility/macros.h"
+#include "utility/source_file.h"
 
 namespace sigma {
-	enum class token {
+	enum class token : u8 {
 		l_parenthesis,                      // (
 		r_parenthesis,                      // )
 		l_brace,                            // {
@@ -117,15 +118,24 @@ namespace sigma {
 	struct file_position {
 		file_position() = default;
 		file_position(
-			const filepath& path, 
+			std::shared_ptr<const source_file> file,
 			u64 line_number,
 			u64 character_number
-		) : m_path(path),
+		) : m_file(std::move(file)),
 		m_line_number(line_number),
 		m_character_number(character_number) {}
 
 		const filepath& get_path() const {
-			return m_path;
+			static const filepath empty_path;
+			return m_file ? m_file->get_path() : empty_path;
+		}
+
+		/**
+		 * \brief Gets the source file the position refers to, the file stays loaded for as long as it is referenced.
+		 * \return Source file, nullptr for default constructed positions.
+		 */
+		const std::shared_ptr<const source_file>& get_source_file() const {
+			return m_file;
 		}
 
 		u64 get_line_number() const {
@@ -136,9 +146,9 @@ namespace sigma {
 			return m_character_number;
 		}
 	private:
-		filepath m_path;
-		u64 m_line_number;
-		u64 m_character_number;
+		std::shared_ptr<const source_file> m_file;
+		u64 m_line_number = 0;
+		u64 m_character_number = 0;
 	};
 
 	inline std::string token_to_string(token token) {
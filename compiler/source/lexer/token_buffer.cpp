@@ -0,0 +1,204 @@
+#include "token_buffer.h"
+
+namespace sigma {
+	token_buffer::token_buffer(
+		std::shared_ptr<const source_file> file,
+		u64 capacity
+	) : m_file(std::move(file)),
+	m_source(m_file->get_source()),
+	m_capacity(capacity),
+	m_slot_mask(capacity == 0 ? ~0ull : capacity - 1) {
+		ASSERT((capacity & (capacity - 1)) == 0, "token buffer capacity has to be a power of 2");
+
+		// bounded buffers never grow, allocate all slots up front
+		if (m_capacity != 0) {
+			m_tokens.resize(m_capacity);
+			m_values.resize(m_capacity);
+			m_value_lengths.resize(m_capacity);
+			m_line_numbers.resize(m_capacity);
+			m_character_numbers.resize(m_capacity);
+			m_symbols.resize(m_capacity);
+		}
+	}
+
+	void token_buffer::add_token(
+		token tok,
+		u32 value_offset,
+		u32 value_length,
+		u32 line_number,
+		u32 character_number,
+		symbol identifier
+	) {
+		const char* value = m_source.data() + value_offset;
+
+		if (m_capacity == 0) {
+			m_tokens.push_back(tok);
+			m_values.push_back(value);
+			m_value_lengths.push_back(value_length);
+			m_line_numbers.push_back(line_number);
+			m_character_numbers.push_back(character_number);
+			m_symbols.push_back(identifier);
+		}
+		else {
+			// overwrite the oldest token
+			const u64 slot = get_slot(m_token_count);
+			m_tokens[slot] = tok;
+			m_values[slot] = value;
+			m_value_lengths[slot] = value_length;
+			m_line_numbers[slot] = line_number;
+			m_character_numbers[slot] = character_number;
+			m_symbols[slot] = identifier;
+		}
+
+		m_token_count++;
+	}
+
+	void token_buffer::add_literal_token(
+		token tok,
+		std::string_view value,
+		u32 line_number,
+		u32 character_number
+	) {
+		char* storage = static_cast<char*>(get_literal_storage().allocate(value.size(), 1));
+		std::copy(value.begin(), value.end(), storage);
+
+		add_token(
+			tok,
+			0,
+			static_cast<u32>(value.size()),
+			line_number,
+			character_number
+		);
+
+		// the decoded value doesn't live in the source, point the token at its copy instead
+		m_values[get_slot(m_token_count - 1)] = storage;
+	}
+
+	token token_buffer::get_token(
+		u64 index
+	) const {
+		return m_tokens[get_slot(index)];
+	}
+
+	std::string_view token_buffer::get_value(
+		u64 index
+	) const {
+		const u64 slot = get_slot(index);
+		return { m_values[slot], m_value_lengths[slot] };
+	}
+
+	symbol token_buffer::get_symbol(
+		u64 index
+	) const {
+		return m_symbols[get_slot(index)];
+	}
+
+	file_position token_buffer::get_token_location(
+		u64 index
+	) const {
+		const u64 slot = get_slot(index);
+
+		return {
+			m_file,
+			m_line_numbers[slot],
+			m_character_numbers[slot]
+		};
+	}
+
+	token_data token_buffer::get_token_data(
+		u64 index
+	) const {
+		const u64 slot = get_slot(index);
+
+		return {
+			m_tokens[slot],
+			{ m_values[slot], m_value_lengths[slot] },
+			m_symbols[slot],
+			m_line_numbers[slot],
+			m_character_numbers[slot],
+			m_file.get()
+		};
+	}
+
+	u64 token_buffer::get_token_count() const {
+		return m_token_count;
+	}
+
+	u64 token_buffer::get_capacity() const {
+		return m_capacity;
+	}
+
+	std::string_view token_buffer::get_source() const {
+		return m_source;
+	}
+
+	const filepath& token_buffer::get_path() const {
+		return m_file->get_path();
+	}
+
+	const std::shared_ptr<const source_file>& token_buffer::get_file() const {
+		return m_file;
+	}
+
+	u64 token_buffer::get_slot(
+		u64 index
+	) const {
+		return index & m_slot_mask;
+	}
+
+	memory_arena& token_buffer::get_literal_storage() {
+		if (m_capacity == 0) {
+			return m_literal_storage[0];
+		}
+
+		// the consumer may still read literals of the previous lap, anything older has been released
+		const u64 lap = m_token_count / m_capacity;
+		memory_arena& storage = m_literal_storage[lap % literal_storage_count];
+
+		if (lap != m_literal_storage_lap) {
+			storage.clear();
+			m_literal_storage_lap = lap;
+		}
+
+		return storage;
+	}
+
+	token_data::token_data(
+		token tok,
+		std::string_view value,
+		symbol identifier,
+		u32 line_number,
+		u32 character_number,
+		const source_file* file
+	) : m_value(value),
+	m_file(file),
+	m_symbol(identifier),
+	m_line_number(line_number),
+	m_character_number(character_number),
+	m_token(tok) {}
+
+	token token_data::get_token() const {
+		return m_token;
+	}
+
+	std::string_view token_data::get_value() const {
+		return m_value;
+	}
+
+	symbol token_data::get_symbol() const {
+		return m_symbol;
+	}
+
+	file_position token_data::get_token_location() const {
+		// default constructed snapshots (ie. before the first token has been read) don't refer to a file
+		if (m_file == nullptr) {
+			return {};
+		}
+
+		return {
+			m_file->shared_from_this(),
+			m_line_number,
+			m_character_number
+		};
+	}
+}
\ No newline at end of file
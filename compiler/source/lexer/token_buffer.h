@@ -0,0 +1,162 @@
+#pragma once
+#include "lexer/token.h"
+#include "utility/containers/symbol_table.h"
+#include "utility/containers/memory_arena.h"
+#include <array>
+
+namespace sigma {
+	struct token_data;
+
+	/**
+	 * \brief Struct-of-arrays storage for the tokens of a single source file. The buffer keeps the source file
+	 * alive, token values are views into it (or into the literal storage for literals that contain escape
+	 * sequences). Bounded buffers act as ring buffers and only hold the most recent tokens.
+	 */
+	class token_buffer {
+	public:
+		/**
+		 * \brief Constructs the token buffer.
+		 * \param file Tokenized source file, shared by all tokens
+		 * \param capacity Number of tokens the buffer can hold at once, has to be a power of 2; new tokens
+		 * overwrite the oldest ones. 0 creates an unbounded buffer which holds every token.
+		 */
+		token_buffer(
+			std::shared_ptr<const source_file> file,
+			u64 capacity = 0
+		);
+
+		token_buffer(const token_buffer&) = delete;
+		token_buffer& operator=(const token_buffer&) = delete;
+
+		/**
+		 * \brief Appends a token whose value is a span of the source text.
+		 * \param tok Token type
+		 * \param value_offset Offset of the token value in the source text
+		 * \param value_length Length of the token value, may be 0
+		 * \param line_number Line number of the token
+		 * \param character_number Character number of the token
+		 * \param identifier Interned identifier, only valid for identifier tokens
+		 */
+		void add_token(
+			token tok,
+			u32 value_offset,
+			u32 value_length,
+			u32 line_number,
+			u32 character_number,
+			symbol identifier = {}
+		);
+
+		/**
+		 * \brief Appends a char or string literal token, the decoded \a value is copied into the literal storage.
+		 * Bounded buffers recycle the storage of a literal two laps of the ring buffer after it was added.
+		 * \param tok Token type
+		 * \param value Decoded literal value
+		 * \param line_number Line number of the token
+		 * \param character_number Character number of the token
+		 */
+		void add_literal_token(
+			token tok,
+			std::string_view value,
+			u32 line_number,
+			u32 character_number
+		);
+
+		token get_token(
+			u64 index
+		) const;
+
+		std::string_view get_value(
+			u64 index
+		) const;
+
+		symbol get_symbol(
+			u64 index
+		) const;
+
+		file_position get_token_location(
+			u64 index
+		) const;
+
+		/**
+		 * \brief Creates a snapshot of the given token, which stays valid after the token gets overwritten (the
+		 * literal values of bounded buffers stay valid until the slot of the token is overwritten again).
+		 * \param index Index of the token, bounded buffers only contain the last 'capacity' tokens
+		 * \return Token snapshot.
+		 */
+		token_data get_token_data(
+			u64 index
+		) const;
+
+		/**
+		 * \brief Gets the number of tokens which have been appended so far, including overwritten tokens.
+		 * \return Token count.
+		 */
+		u64 get_token_count() const;
+		u64 get_capacity() const;
+		std::string_view get_source() const;
+		const filepath& get_path() const;
+		const std::shared_ptr<const source_file>& get_file() const;
+	private:
+		u64 get_slot(
+			u64 index
+		) const;
+
+		/**
+		 * \brief Gets the literal storage for the next token. Bounded buffers rotate between multiple arenas, one
+		 * per lap of the ring buffer, an arena is cleared once its lap is old enough to no longer be read.
+		 * \return Literal storage arena.
+		 */
+		memory_arena& get_literal_storage();
+	private:
+		// number of literal arenas of bounded buffers, the current lap, the lap which may still be read by the
+		// consumer, and the lap whose storage gets recycled next
+		static constexpr u64 literal_storage_count = 3;
+
+		std::shared_ptr<const source_file> m_file;
+		std::string_view m_source;
+		std::array<memory_arena, literal_storage_count> m_literal_storage; // decoded char and string literal values
+		u64 m_literal_storage_lap = 0; // lap of the ring buffer the current literal storage belongs to
+
+		u64 m_capacity;
+		u64 m_slot_mask;
+		u64 m_token_count = 0;
+
+		// token data, one element per token (slot) in every array
+		std::vector<token> m_tokens;
+		std::vector<const char*> m_values; // value in the source, or in the literal storage for literals
+		std::vector<u32> m_value_lengths;
+		std::vector<u32> m_line_numbers;
+		std::vector<u32> m_character_numbers;
+		std::vector<symbol> m_symbols;
+	};
+
+	/**
+	 * \brief Snapshot of a single token. The value is a view into the source file or into the literal storage
+	 * of the token buffer, and thus stays valid for as long as the buffer exists (literal values of bounded
+	 * buffers are recycled, see token_buffer::get_token_data).
+	 */
+	struct token_data {
+		token_data() = default;
+
+		token_data(
+			token tok,
+			std::string_view value,
+			symbol identifier,
+			u32 line_number,
+			u32 character_number,
+			const source_file* file
+		);
+
+		token get_token() const;
+		std::string_view get_value() const;
+		symbol get_symbol() const;
+		file_position get_token_location() const;
+	private:
+		std::string_view m_value;
+		const source_file* m_file = nullptr;
+		symbol m_symbol;
+		u32 m_line_number = 0;
+		u32 m_character_number = 0;
+		token m_token = token::unknown;
+	};
+}
\ No newline at end of file
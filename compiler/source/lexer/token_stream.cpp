@@ -0,0 +1,179 @@
+#include "token_stream.h"
+#include "lexer/lexer.h"
+
+namespace sigma {
+	token_stream::token_stream(
+		std::shared_ptr<lexer> lexer,
+		u64 capacity,
+		bool threaded
+	) : m_lexer(std::move(lexer)),
+	m_capacity(capacity),
+	m_batch_size(threaded ? std::max<u64>(capacity / 8, 1) : 1),
+	m_threaded(threaded) {
+		// replace the lexer's unbounded token buffer by a ring buffer
+		const auto tokens = std::make_shared<token_buffer>(m_lexer->m_tokens->get_file(), m_capacity);
+		m_lexer->m_tokens = tokens;
+		m_tokens = tokens;
+
+		if (m_threaded) {
+			m_lexer_thread = std::thread(&token_stream::lex_tokens, this);
+		}
+	}
+
+	token_stream::~token_stream() {
+		if (m_threaded) {
+			// wake the lexer thread up, in case it's waiting for free slots
+			m_stop.store(true, std::memory_order_release);
+			m_released.store(finished_flag, std::memory_order_release);
+			m_released.notify_one();
+
+			m_lexer_thread.join();
+		}
+	}
+
+	token_data token_stream::get_token(
+		u64 index
+	) {
+		u64 available = m_available.load(std::memory_order_acquire);
+
+		while (index >= (available & ~finished_flag)) {
+			if (available & finished_flag) {
+				// reading past the end of the stream
+				const u64 token_count = available & ~finished_flag;
+
+				if (m_error || token_count == 0) {
+					return {};
+				}
+
+				return m_tokens->get_token_data(token_count - 1);
+			}
+
+			// the slot of the token is still occupied by a token the consumer hasn't released, lexing it would
+			// overwrite that token (or wait for a release which never happens)
+			const u64 released = m_released.load(std::memory_order_relaxed);
+			if (index >= released + m_capacity) {
+				return report_lookahead_error(index - released);
+			}
+
+			if (m_threaded) {
+				m_available.wait(available, std::memory_order_acquire);
+			}
+			else {
+				lex_next_token();
+			}
+
+			available = m_available.load(std::memory_order_acquire);
+		}
+
+		// the token has already been overwritten
+		if (index + m_capacity < (available & ~finished_flag)) {
+			return report_lookahead_error((available & ~finished_flag) - index);
+		}
+
+		return m_tokens->get_token_data(index);
+	}
+
+	void token_stream::release(
+		u64 index
+	) {
+		if (index % m_batch_size != 0) {
+			return;
+		}
+
+		m_released.store(index, std::memory_order_release);
+
+		if (m_threaded) {
+			m_released.notify_one();
+		}
+	}
+
+	error_result token_stream::get_error() const {
+		if (m_lookahead_error) {
+			return m_lookahead_error;
+		}
+
+		// the error is written before the finished flag is published
+		if (m_available.load(std::memory_order_acquire) & finished_flag) {
+			return m_error;
+		}
+
+		return {};
+	}
+
+	void token_stream::lex_next_token() {
+		// only the producer modifies the token count
+		const u64 token_count = m_available.load(std::memory_order_relaxed);
+
+		token tok = token::unknown;
+		if (auto tokenization_error = m_lexer->tokenize_next(tok)) {
+			m_error = tokenization_error;
+			publish(token_count, true);
+			return;
+		}
+
+		publish(token_count + 1, tok == token::end_of_file);
+	}
+
+	void token_stream::lex_tokens() {
+		u64 token_count = 0;
+
+		while (true) {
+			u64 released = m_released.load(std::memory_order_acquire);
+
+			// wait until the consumer releases the slots of the oldest tokens, publish everything we have
+			// first so that the consumer can make progress
+			if (token_count >= released + m_capacity) {
+				publish(token_count, false);
+
+				while (token_count >= released + m_capacity && !m_stop.load(std::memory_order_acquire)) {
+					m_released.wait(released, std::memory_order_acquire);
+					released = m_released.load(std::memory_order_acquire);
+				}
+			}
+
+			if (m_stop.load(std::memory_order_acquire)) {
+				return;
+			}
+
+			token tok = token::unknown;
+			if (auto tokenization_error = m_lexer->tokenize_next(tok)) {
+				m_error = tokenization_error;
+				publish(token_count, true);
+				return;
+			}
+
+			token_count++;
+
+			if (tok == token::end_of_file) {
+				publish(token_count, true);
+				return;
+			}
+
+			if (token_count % m_batch_size == 0) {
+				publish(token_count, false);
+			}
+		}
+	}
+
+	token_data token_stream::report_lookahead_error(
+		u64 lookahead
+	) {
+		if (!m_lookahead_error) {
+			m_lookahead_error = error::emit<2007>(lookahead, m_capacity);
+		}
+
+		// unknown tokens make the parser fail, which then reports the stream error
+		return {};
+	}
+
+	void token_stream::publish(
+		u64 token_count,
+		bool finished
+	) {
+		m_available.store(token_count | (finished ? finished_flag : 0), std::memory_order_release);
+
+		if (m_threaded) {
+			m_available.notify_one();
+		}
+	}
+}
\ No newline at end of file
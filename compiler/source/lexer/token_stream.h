@@ -0,0 +1,111 @@
+#pragma once
+#include "lexer/token_buffer.h"
+#include "compiler/diagnostics/error.h"
+#include <atomic>
+#include <thread>
+
+namespace sigma {
+	class lexer;
+
+	/**
+	 * \brief Bounded source of tokens which are lexed while they are being consumed. Tokens are stored in a ring
+	 * buffer, so the memory used by the tokens doesn't depend on the size of the source file. The stream either
+	 * lexes tokens on demand, or runs the lexer on a separate thread which fills the ring buffer ahead of the
+	 * consumer (single producer, single consumer). Threaded streams publish and release tokens in batches, so
+	 * that the threads rarely have to synchronize.
+	 */
+	class token_stream {
+	public:
+		/**
+		 * \brief Constructs the token stream, the \a lexer has to have its source file set already.
+		 * \param lexer Lexer to pull the tokens from
+		 * \param capacity Maximum number of tokens held at once, has to be a power of 2; limits the lookahead
+		 * (threaded streams can look ahead by 7/8 of the capacity)
+		 * \param threaded Run the lexer on a separate thread
+		 */
+		token_stream(
+			std::shared_ptr<lexer> lexer,
+			u64 capacity,
+			bool threaded
+		);
+
+		~token_stream();
+
+		token_stream(const token_stream&) = delete;
+		token_stream& operator=(const token_stream&) = delete;
+
+		/**
+		 * \brief Retrieves the given token, lexing or waiting for it if necessary. Reading past the end of the
+		 * stream returns the end of file token, or an unknown token if the lexer has failed. Looking further ahead
+		 * than the capacity allows, or reading a token which has been overwritten already, returns an unknown
+		 * token and sets the error of the stream.
+		 * \param index Index of the token, should be smaller than the last released index + capacity
+		 * \return Token snapshot.
+		 */
+		token_data get_token(
+			u64 index
+		);
+
+		/**
+		 * \brief Marks all tokens before the given \a index as consumed, which allows them to be overwritten.
+		 * \param index Index of the oldest token which may still be read
+		 */
+		void release(
+			u64 index
+		);
+
+		/**
+		 * \brief Retrieves the error the lexer or the consumer has encountered, should be checked once the
+		 * consumer finishes.
+		 * \return Potentially erroneous result.
+		 */
+		error_result get_error() const;
+	private:
+		/**
+		 * \brief Lexes the next token, used by streams which lex on demand.
+		 */
+		void lex_next_token();
+
+		/**
+		 * \brief Entry point of the lexer thread, lexes tokens until the end of the source file is reached,
+		 * or until the stream is destroyed.
+		 */
+		void lex_tokens();
+
+		/**
+		 * \brief Records a lookahead error, only called by the consumer.
+		 * \param lookahead Distance between the requested token and the oldest readable token
+		 * \return Unknown token.
+		 */
+		token_data report_lookahead_error(
+			u64 lookahead
+		);
+
+		/**
+		 * \brief Makes the first \a token_count tokens available to the consumer.
+		 * \param token_count Number of lexed tokens
+		 * \param finished Set once the lexer has finished, or failed
+		 */
+		void publish(
+			u64 token_count,
+			bool finished
+		);
+	private:
+		// set in m_available once the last token has been published
+		static constexpr u64 finished_flag = 1ull << 63;
+
+		std::shared_ptr<lexer> m_lexer;
+		std::shared_ptr<const token_buffer> m_tokens;
+		u64 m_capacity;
+		u64 m_batch_size; // number of tokens published/released at once by threaded streams
+		bool m_threaded;
+
+		std::atomic<u64> m_available = 0; // number of published tokens, combined with finished_flag
+		std::atomic<u64> m_released = 0;  // index of the oldest token which may still be read
+		std::atomic<bool> m_stop = false;
+		error_result m_error;            // written by the producer
+		error_result m_lookahead_error;  // written by the consumer
+
+		std::thread m_lexer_thread;
+	};
+}
\ No newline at end of file
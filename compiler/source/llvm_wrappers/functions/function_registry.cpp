@@ -2,7 +2,7 @@
 
 namespace sigma {
 	function_ptr function_registry::get_function(
-		const std::string& identifier,
+		symbol identifier,
 		const std::shared_ptr<llvm_context>& context
 	) {
 		// locate a defined function
@@ -42,7 +42,7 @@ namespace sigma {
 			function_type,
 			llvm::Function::ExternalLinkage,
 			external_function_decl->get_external_function_name(),
-			context->get_module().get()
+			context->get_module()
 		);
 
 		// insert the function declaration and treat it like a regular function
@@ -62,7 +62,7 @@ namespace sigma {
 	}
 
 	function_declaration_ptr function_registry::get_function_declaration(
-		const std::string& identifier
+		symbol identifier
 	) const {
 		// try and find a regular declaration
 		const auto it = m_function_declarations.find(identifier);
@@ -74,10 +74,10 @@ namespace sigma {
 	}
 
 	function_declaration_ptr function_registry::get_external_function_declaration(
-		const std::string& identifier
+		symbol identifier
 	) const 	{
 		// try and find an external function declaration
-		const auto it = m_external_function_declarations.find(identifier);
+		const auto it = m_external_function_declarations.find(identifier.get_name());
 		if (it != m_external_function_declarations.end()) {
 			return it->second;
 		}
@@ -90,30 +90,37 @@ namespace sigma {
 	}
 
 	void function_registry::insert_function(
-		const std::string& identifier,
+		symbol identifier,
 		function_ptr function
 	) {
 		m_functions[identifier] = function;
 	}
 
 	void function_registry::insert_function_declaration(
-		const std::string& identifier, 
+		symbol identifier, 
 		function_declaration_ptr function
 	) {
 		m_function_declarations[identifier] = function;
 	}
 
+	void function_registry::insert_external_function_declaration(
+		const std::string& name,
+		function_declaration_ptr function
+	) {
+		m_external_function_declarations[name] = function;
+	}
+
 	bool function_registry::contains_function(
-		const std::string& identifier
+		symbol identifier
 	) const {
 		return m_functions.contains(identifier) || 
-			m_external_function_declarations.contains(identifier);
+			m_external_function_declarations.contains(identifier.get_name());
 	}
 
 	bool function_registry::contains_function_declaration(
-		const std::string& identifier
+		symbol identifier
 	) const {
 		return m_function_declarations.contains(identifier) || 
-			m_external_function_declarations.contains(identifier);
+			m_external_function_declarations.contains(identifier.get_name());
 	}
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "llvm_wrappers/type.h"
 #include "llvm_wrappers/functions/function.h"
 #include "llvm_wrappers/llvm_context.h"
+#include "utility/containers/symbol_table.h"
 
 namespace sigma {
 	using function_ptr = std::shared_ptr<function>;
@@ -12,43 +13,57 @@ namespace sigma {
 		function_registry() = default;
 
 		function_ptr get_function(
-			const std::string& identifier,
+			symbol identifier,
 			const std::shared_ptr<llvm_context>& context
 		);
 
 		function_declaration_ptr get_function_declaration(
-			const std::string& identifier
+			symbol identifier
 		) const;
 
 		function_declaration_ptr get_external_function_declaration(
-			const std::string& identifier
+			symbol identifier
 		) const;
 
 		const std::unordered_map<std::string, function_declaration_ptr>& get_external_function_declarations() const;
 
 		void insert_function(
-			const std::string& identifier,
+			symbol identifier,
 			function_ptr function
 		);
 
 		void insert_function_declaration(
-			const std::string& identifier,
+			symbol identifier,
+			function_declaration_ptr function
+		);
+
+		/**
+		 * \brief Inserts a function which is defined outside of the current module, the function gets declared
+		 * once it's first used.
+		 * \param name Name of the function
+		 * \param function Declaration of the function
+		 */
+		void insert_external_function_declaration(
+			const std::string& name,
 			function_declaration_ptr function
 		);
 
 		bool contains_function(
-			const std::string& identifier
+			symbol identifier
 		) const;
 
 		bool contains_function_declaration(
-			const std::string& identifier
+			symbol identifier
 		) const;
 	private:
 		// definitions
-		std::unordered_map<std::string, function_ptr> m_functions;
+		std::unordered_map<symbol, function_ptr> m_functions;
 
 		// declarations
-		std::unordered_map<std::string, function_declaration_ptr> m_function_declarations;
+		std::unordered_map<symbol, function_declaration_ptr> m_function_declarations;
+
+		// external declarations are keyed by name, since they exist before any identifiers get interned. they're
+		// only consulted on a miss, after which the declared function is cached in m_functions.
 		std::unordered_map<std::string, function_declaration_ptr> m_external_function_declarations = {{
 				"print",
 				std::make_shared<function_declaration>(
@@ -2,26 +2,30 @@
 
 namespace sigma {
 	llvm_context::llvm_context()
-		: m_builder(m_context),
-	m_module(std::make_unique<llvm::Module>("sigma", m_context)) {}
+		: m_context(std::make_unique<llvm::LLVMContext>()),
+	m_builder(*m_context),
+	m_module(std::make_unique<llvm::Module>("sigma", *m_context)) {}
 
 	void llvm_context::print_intermediate_representation() const {
 		m_module->print(llvm::outs(), nullptr);
 	}
 
 	llvm::LLVMContext& llvm_context::get_context() {
-		return m_context;
+		return *m_context;
 	}
 
 	llvm::IRBuilder<>& llvm_context::get_builder() {
 		return m_builder;
 	}
 
-	std::shared_ptr<llvm::Module> llvm_context::get_module() {
-		return m_module;
+	llvm::Module* llvm_context::get_module() const {
+		return m_module.get();
 	}
 
-	std::shared_ptr<llvm::Module> llvm_context::get_module() const {
-		return m_module;
+	llvm::orc::ThreadSafeModule llvm_context::release_module() {
+		return llvm::orc::ThreadSafeModule(
+			std::move(m_module),
+			std::move(m_context)
+		);
 	}
 }
\ No newline at end of file
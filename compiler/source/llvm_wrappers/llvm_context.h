@@ -1,5 +1,6 @@
 #pragma once
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
 
 namespace sigma {
 	/**
@@ -12,11 +13,17 @@ namespace sigma {
 
 		llvm::LLVMContext& get_context();
 		llvm::IRBuilder<>& get_builder();
-		std::shared_ptr<llvm::Module> get_module();
-		std::shared_ptr<llvm::Module> get_module() const;
+		llvm::Module* get_module() const;
+
+		/**
+		 * \brief Transfers the ownership of the module, and of the context it lives in, into a thread safe
+		 * module which can be handed over to the JIT. The llvm_context cannot be used afterwards.
+		 * \return Thread safe module containing the generated code.
+		 */
+		llvm::orc::ThreadSafeModule release_module();
 	private:
-		llvm::LLVMContext m_context;
+		std::unique_ptr<llvm::LLVMContext> m_context;
 		llvm::IRBuilder<> m_builder;
-		std::shared_ptr<llvm::Module> m_module;
+		std::unique_ptr<llvm::Module> m_module;
 	};
 }
@@ -1,80 +1,70 @@
 #include "scope.h"
 
 namespace sigma {
-	scope::scope(
-		scope_ptr parent
-	) : m_parent(parent) {}
-
-	scope::scope(
-		scope_ptr parent,
+	scope::mark scope::enter(
 		llvm::BasicBlock* loop_end_block
-	) : m_parent(parent),
-	m_loop_end_block(loop_end_block) {}
-
-	void scope::insert_named_value(
-		const std::string& name, 
-		value_ptr value
-	) {
-		m_named_values[name] = value;
-	}
-
-	value_ptr scope::get_named_value(
-		const std::string& name
 	) {
-		const auto it = m_named_values.find(name); // try to find an llvm::Value in this scope
+		const mark scope_mark = {
+			m_undo_log.size(),
+			m_loop_end_blocks.size()
+		};
 
-		// if we've found a value in this scope, return it
-		if (it != m_named_values.end()) {
-			return it->second;
+		if (loop_end_block != nullptr) {
+			m_loop_end_blocks.push_back(loop_end_block);
 		}
 
-		// if we haven't found a value, but we have a parent scope we need to search it as well 
-		if (m_parent != nullptr) {
-			return m_parent->get_named_value(name);
+		return scope_mark;
+	}
+
+	void scope::exit(
+		const mark& scope_mark
+	) {
+		// remove the values inserted by the scope, the value slots themselves are kept for later scopes
+		while (m_undo_log.size() > scope_mark.undo_log_size) {
+			m_named_values[m_undo_log.back().get_id()] = value();
+			m_undo_log.pop_back();
 		}
 
-		// value does not exist in current scope
-		return nullptr;
+		m_loop_end_blocks.resize(scope_mark.loop_end_block_count);
 	}
 
-	llvm::BasicBlock* scope::get_loop_end_block() const {
-		if(m_loop_end_block != nullptr) {
-			return m_loop_end_block;
+	bool scope::add_named_value(
+		symbol name,
+		const value& value
+	) {
+		// values cannot shadow values of enclosing scopes
+		if (contains_named_value(name)) {
+			return false;
 		}
 
-		if(m_parent != nullptr) {
-			return m_parent->get_loop_end_block();
+		if (name.get_id() >= m_named_values.size()) {
+			m_named_values.resize(name.get_id() + 1);
 		}
 
-		return nullptr;
+		m_named_values[name.get_id()] = value;
+		m_undo_log.push_back(name);
+		return true;
 	}
 
 	bool scope::contains_named_value(
-		const std::string& name
-	) const	{
-		// check in the current scopes
-		if (m_named_values.contains(name)) {
-			return true;
-		}
+		symbol name
+	) const {
+		return get_named_value(name) != nullptr;
+	}
 
-		// if we have a parent scope check in there as well
-		if (m_parent != nullptr) {
-			return m_parent->contains_named_value(name);
+	const value* scope::get_named_value(
+		symbol name
+	) const {
+		// symbols interned after the last insertion cannot have a value yet
+		if (name.get_id() >= m_named_values.size()) {
+			return nullptr;
 		}
 
-		// variable does not exist in the current scope
-		return false;
+		const value& named_value = m_named_values[name.get_id()];
+		return named_value.get_value() != nullptr ? &named_value : nullptr;
 	}
 
-	std::pair<std::unordered_map<std::string, value_ptr>::iterator, bool> scope::add_named_value(
-		const std::string& name, 
-		value_ptr value
-	) {
-		// check parent scopes
-		if (contains_named_value(name)) {
-			return { {}, false };
-		}
-
-		return m_named_values.insert({ name, value });
+	llvm::BasicBlock* scope::get_loop_end_block() const {
+		return m_loop_end_blocks.empty() ? nullptr : m_loop_end_blocks.back();
 	}
 }
\ No newline at end of file
@@ -1,77 +1,86 @@
 #pragma once
 #include "llvm_wrappers/value.h"
+#include "utility/containers/symbol_table.h"
 
 namespace sigma {
-	class scope;
-	using scope_ptr = std::shared_ptr<scope>;
-
+	/**
+	 * \brief Flat table of the named values visible at the current point of a function. Values are stored in a
+	 * single array indexed by their symbol ids, nested scopes are tracked by an undo log of the inserted symbols:
+	 * entering a scope records a mark, leaving it removes everything that was inserted after the mark. Lookups
+	 * therefore cost a single indexed load, no matter how deeply the scopes are nested.
+	 */
 	class scope	{
 	public:
 		/**
-		 * \brief Constructs the scope using the given parent scope and the loop end block.
-		 * \param parent Enclosing scope in which this scope is defined
+		 * \brief State of the scope at the time a nested scope was entered.
 		 */
-		scope(
-			scope_ptr parent
-		);
+		struct mark {
+			u64 undo_log_size;
+			u64 loop_end_block_count;
+		};
+
+		scope() = default;
 
 		/**
-		 * \brief Constructs the scope using the given parent scope and the loop end block.
-		 * \param parent Enclosing scope in which this scope is defined
-		 * \param loop_end_block Basic LLVM block where the current loop ends
+		 * \brief Enters a nested scope.
+		 * \param loop_end_block Basic LLVM block where the loop the scope belongs to ends, nullptr if the scope
+		 * doesn't belong to a loop
+		 * \return Mark which restores the enclosing scope when passed to exit().
 		 */
-		scope(
-			scope_ptr parent,
-			llvm::BasicBlock* loop_end_block
+		mark enter(
+			llvm::BasicBlock* loop_end_block = nullptr
 		);
 
 		/**
-		 * \brief Inserts a new named value into the scope.
-		 * \param name Name of the value
-		 * \param value Value to insert
+		 * \brief Leaves the scope entered by the enter() call which returned the given \a scope_mark, removes
+		 * all named values which have been added since.
+		 * \param scope_mark Mark of the scope to leave
 		 */
-		void insert_named_value(
-			const std::string& name, 
-			value_ptr value
+		void exit(
+			const mark& scope_mark
 		);
 
 		/**
-		 * \brief Inserts a new named value into the scope.
+		 * \brief Inserts a new named value into the current scope, unless a value with the given name is already
+		 * visible.
 		 * \param name Name of the value
 		 * \param value Value to insert
-		 * \return Pair, where the first element is an iterator to the added element, and the second element is a boolean that is true if the insertion took place, and false if the value already existed.
+		 * \return True if the insertion took place, false if the value already existed.
 		 */
-		std::pair<std::unordered_map<std::string, value_ptr>::iterator, bool> add_named_value(
-			const std::string& name,
-			value_ptr value
+		bool add_named_value(
+			symbol name,
+			const value& value
 		);
 
 		/**
-		 * \brief Checks if a named value exists in the scope.
+		 * \brief Checks if a named value is visible in the current scope.
 		 * \param name Name of the named value to look for
 		 * \return True if the named value exists.
 		 */
 		bool contains_named_value(
-			const std::string& name
+			symbol name
 		) const;
 
 		/**
 		 * \brief Returns the named value from the scope. If the named value does not exist, a nullptr is returned.
 		 * \param name Name of the named value to look for
-		 * \return Pointer to the value of our named value, may be nullptr if the value does not exist.
+		 * \return Pointer to the value of our named value, may be nullptr if the value does not exist. The pointer
+		 * is invalidated by the next insertion.
 		 */
-		value_ptr get_named_value(
-			const std::string& name
-		);
+		const value* get_named_value(
+			symbol name
+		) const;
 
 		/**
-		 * \brief Returns the current loop end block.
-		 * \return Current loop end block, may be nullptr if the loop end block has not been set.
+		 * \brief Returns the end block of the innermost enclosing loop.
+		 * \return Current loop end block, may be nullptr if the scope isn't inside a loop.
 		 */
 		llvm::BasicBlock* get_loop_end_block() const;
 	private:
-		scope_ptr m_parent = nullptr;
-		llvm::BasicBlock* m_loop_end_block = nullptr;
-		std::unordered_map<std::string, value_ptr> m_named_values;
+		// visible values, indexed by symbol id, empty values mark free slots
+		std::vector<value> m_named_values;
+		// symbols in order of insertion
+		std::vector<symbol> m_undo_log;
+		std::vector<llvm::BasicBlock*> m_loop_end_blocks;
 	};
 }
@@ -283,7 +283,8 @@ namespace sigma {
 			return (left_type.get_base() == type::base::f64 || right_type.get_base() == type::base::f64) ? type(type::base::f64, 0) : type(type::base::f32, 0);
 		}
 
-		static std::unordered_map<type::base, i32> type_priority = {
+		// shared between concurrent compilations, and therefore never modified
+		static const std::unordered_map<type::base, i32> type_priority = {
 			// { type::base::boolean, 1 }, { type::base::boolean, 1 },
 			{ type::base::i8     , 1 }, { type::base::u8     , 1 },
 			{ type::base::i16    , 2 }, { type::base::u16    , 2 },
@@ -291,6 +292,11 @@ namespace sigma {
 			{ type::base::i64    , 4 }, { type::base::u64    , 4 }
 		};
 
-		return type_priority[left_type.get_base()] > type_priority[right_type.get_base()] ? left_type : right_type;
+		const auto get_priority = [](type::base base) {
+			const auto it = type_priority.find(base);
+			return it == type_priority.end() ? 0 : it->second;
+		};
+
+		return get_priority(left_type.get_base()) > get_priority(right_type.get_base()) ? left_type : right_type;
 	}
 }
\ No newline at end of file
@@ -2,12 +2,12 @@
 
 namespace sigma {
 	value::value(
-		const std::string& name, 
 		type type,
-		llvm::Value* value
-	) : m_name(name),
-	m_type(type),
-	m_value(value) {}
+		llvm::Value* value,
+		llvm::Value* pointer
+	) : m_type(type),
+	m_value(value),
+	m_pointer(pointer) {}
 
 	type value::get_type() const {
 		return m_type;
@@ -32,8 +32,4 @@ namespace sigma {
 	void value::set_pointer(llvm::Value* pointer) {
 		m_pointer = pointer;
 	}
-
-	const std::string& value::get_name() const {
-		return m_name;
-	}
 }
\ No newline at end of file
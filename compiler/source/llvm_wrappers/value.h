@@ -2,24 +2,25 @@
 #include "llvm_wrappers/type.h"
 
 namespace sigma {
-	class value;
-	using value_ptr = std::shared_ptr<value>;
-
 	/**
-	 * \brief Wrapper around an llvm::Value*, provides utilities such as additional type information
+	 * \brief Wrapper around an llvm::Value*, provides utilities such as additional type information. Values are
+	 * small and trivially copyable, expression results are therefore passed around by value.
 	 */
 	class value {
 	public:
+		value() = default;
+
 		/**
-		 * \brief Constructs a new value. 
-		 * \param name Name of the value
+		 * \brief Constructs a new value.
 		 * \param type Type of the value
 		 * \param value LLVM value* of the value
+		 * \param pointer LLVM value* pointing to the store location of the value, nullptr if the value isn't
+		 * stored anywhere
 		 */
 		value(
-			const std::string& name,
-			type type, 
-			llvm::Value* value
+			type type,
+			llvm::Value* value,
+			llvm::Value* pointer = nullptr
 		);
 
 		/**
@@ -63,16 +64,9 @@ namespace sigma {
 		void set_pointer(
 			llvm::Value* pointer
 		);
-
-		/**
-		 * \brief Gets the name of the value.
-		 * \return Name of the value.
-		 */
-		const std::string& get_name() const;
 	private:
-		std::string m_name;
-		type m_type;
-		llvm::Value* m_value;
-		llvm::Value* m_pointer;
+		type m_type = {};
+		llvm::Value* m_value = nullptr;
+		llvm::Value* m_pointer = nullptr;
 	};
 }
@@ -131,10 +131,10 @@ namespace sigma {
 
 		const file_position location = m_current_token.get_token_location();
 		get_next_token(); // identifier (guaranteed)
-		const std::string identifier = m_current_token.get_value();
+		const symbol identifier = m_current_token.get_symbol();
 		get_next_token(); // l_parenthesis (guaranteed)
 
-		std::vector<std::pair<std::string, type>> arguments;
+		std::vector<std::pair<symbol, type>> arguments;
 
 		// parse arguments
 		token next_token = peek_next_token();
@@ -149,7 +149,7 @@ namespace sigma {
 					return type_parse_error; // return on failure
 				}
 
-				std::string argument_name = m_current_token.get_value();
+				symbol argument_name = m_current_token.get_symbol();
 				arguments.emplace_back(argument_name, argument_type);
 
 				// get_next_token(); // comma || type || other
@@ -179,7 +179,7 @@ namespace sigma {
 			return local_statement_parse_error; // return on failure
 		}
 
-		out_node = new function_node(
+		out_node = m_abstract_syntax_tree->make<function_node>(
 			location,
 			return_type, 
 			false, 
@@ -208,7 +208,7 @@ namespace sigma {
 		}
 
 		const token_data file_token = m_current_token;
-		out_node = new file_include_node(m_current_token.get_token_location(), m_current_token.get_value());
+		out_node = m_abstract_syntax_tree->make<file_include_node>(m_current_token.get_token_location(), m_current_token.get_value());
 		return {};
 	}
 
@@ -381,7 +381,7 @@ namespace sigma {
 		else {
 			// create a simple access node
 			get_next_token(); // identifier (guaranteed)
-			out_node = new variable_access_node(m_current_token.get_token_location(), m_current_token.get_value());
+			out_node = m_abstract_syntax_tree->make<variable_access_node>(m_current_token.get_token_location(), m_current_token.get_symbol());
 		}
 
 		// check for post unary operators after identifier, deep expression, or array index access
@@ -449,7 +449,7 @@ namespace sigma {
 			}
 		}
 
-		out_node = new if_else_node(location, conditions, branches);
+		out_node = m_abstract_syntax_tree->make<if_else_node>(location, conditions, branches);
 		return {};
 	}
 
@@ -485,7 +485,7 @@ namespace sigma {
 		}
 
 		get_next_token(); // r_brace (guaranteed)
-		out_node = new while_node(location, loop_condition_node, loop_statements);
+		out_node = m_abstract_syntax_tree->make<while_node>(location, loop_condition_node, loop_statements);
 		return {};
 	}
 
@@ -619,7 +619,7 @@ namespace sigma {
 		}
 
 		get_next_token(); // r_brace (guaranteed)
-		out_node = new for_node(location, loop_initialization_node, loop_condition_node, post_iteration_nodes, loop_statements);
+		out_node = m_abstract_syntax_tree->make<for_node>(location, loop_initialization_node, loop_condition_node, post_iteration_nodes, loop_statements);
 		return {};
 	}
 
@@ -640,35 +640,35 @@ namespace sigma {
 
 		switch (op) {
 		case token::operator_addition_assignment:
-			out_node = new operator_addition_assignment_node(
+			out_node = m_abstract_syntax_tree->make<operator_addition_assignment_node>(
 				m_current_token.get_token_location(),
 				left_operand,
 				expression
 			);
 			break;
 		case token::operator_subtraction_assignment:
-			out_node = new operator_subtraction_assignment_node(
+			out_node = m_abstract_syntax_tree->make<operator_subtraction_assignment_node>(
 				m_current_token.get_token_location(),
 				left_operand,
 				expression
 			);
 			break;
 		case token::operator_multiplication_assignment:
-			out_node = new operator_multiplication_assignment_node(
+			out_node = m_abstract_syntax_tree->make<operator_multiplication_assignment_node>(
 				m_current_token.get_token_location(),
 				left_operand,
 				expression
 			);
 			break;
 		case token::operator_division_assignment:
-			out_node = new operator_division_assignment_node(
+			out_node = m_abstract_syntax_tree->make<operator_division_assignment_node>(
 				m_current_token.get_token_location(), 
 				left_operand, 
 				expression
 			);
 			break;
 		case token::operator_modulo_assignment:
-			out_node = new operator_modulo_assignment_node(
+			out_node = m_abstract_syntax_tree->make<operator_modulo_assignment_node>(
 				m_current_token.get_token_location(), 
 				left_operand,
 				expression
@@ -681,7 +681,7 @@ namespace sigma {
 
 	error_result recursive_descent_parser::parse_array_assignment(node*& out_node) {
 		get_next_token(); // identifier (guaranteed)
-		const std::string identifier = m_current_token.get_value();
+		const symbol identifier = m_current_token.get_symbol();
 		const file_position location = m_current_token.get_token_location();
 
 		std::vector<node*> index_nodes;
@@ -717,12 +717,12 @@ namespace sigma {
 				}
 			}
 
-			node* array_node = new variable_node(m_current_token.get_token_location(), identifier);
-			out_node = new array_assignment_node(location, array_node, index_nodes, value);
+			node* array_node = m_abstract_syntax_tree->make<variable_node>(m_current_token.get_token_location(), identifier);
+			out_node = m_abstract_syntax_tree->make<array_assignment_node>(location, array_node, index_nodes, value);
 		}
 		else if (next_token == token::operator_increment || next_token == token::operator_decrement) {
-			node* array_node = new variable_node(m_current_token.get_token_location(), identifier);
-			out_node = new array_access_node(location, array_node, index_nodes);
+			node* array_node = m_abstract_syntax_tree->make<variable_node>(m_current_token.get_token_location(), identifier);
+			out_node = m_abstract_syntax_tree->make<array_access_node>(location, array_node, index_nodes);
 
 			if (auto post_operator_parse_error = parse_post_operator(out_node, out_node)) {
 				return post_operator_parse_error; // return on failure
@@ -734,7 +734,7 @@ namespace sigma {
 
 	error_result recursive_descent_parser::parse_assignment(node*& out_node) {
 		get_next_token(); // identifier (guaranteed)
-		node* variable = new variable_node(m_current_token.get_token_location(), m_current_token.get_value());
+		node* variable = m_abstract_syntax_tree->make<variable_node>(m_current_token.get_token_location(), m_current_token.get_symbol());
 
 		if (auto next_token_error = expect_next_token(token::operator_assignment)) {
 			return next_token_error;  // return on failure
@@ -753,15 +753,15 @@ namespace sigma {
 			}
 		}
 
-		out_node = new assignment_node(m_current_token.get_token_location(), variable, value);
+		out_node = m_abstract_syntax_tree->make<assignment_node>(m_current_token.get_token_location(), variable, value);
 		return {};
 	}
 
 	error_result recursive_descent_parser::parse_array_access(node*& out_node) {
 		get_next_token(); // identifier (guaranteed)
-		const std::string identifier = m_current_token.get_value();
+		const symbol identifier = m_current_token.get_symbol();
 
-		node* array_node = new variable_node(m_current_token.get_token_location(), identifier);
+		node* array_node = m_abstract_syntax_tree->make<variable_node>(m_current_token.get_token_location(), identifier);
 		std::vector<node*> index_nodes;
 
 		get_next_token(); // l_bracket (guaranteed)
@@ -786,13 +786,13 @@ namespace sigma {
 			get_next_token(); // l_bracket(guaranteed)
 		}
 
-		out_node = new array_access_node(m_current_token.get_token_location(), array_node, index_nodes);
+		out_node = m_abstract_syntax_tree->make<array_access_node>(m_current_token.get_token_location(), array_node, index_nodes);
 		return {};
 	}
 
 	error_result recursive_descent_parser::parse_function_call(node*& out_node) {
 		get_next_token(); // identifier (guaranteed)
-		const std::string identifier = m_current_token.get_value();
+		const symbol identifier = m_current_token.get_symbol();
 		get_next_token(); // l_parenthesis (guaranteed)
 		std::vector<node*> arguments;
 
@@ -827,7 +827,7 @@ namespace sigma {
 			return next_token_error; // return on failure
 		}
 
-		out_node = new function_call_node(m_current_token.get_token_location(), identifier, arguments);
+		out_node = m_abstract_syntax_tree->make<function_call_node>(m_current_token.get_token_location(), identifier, arguments);
 		return  {};
 	}
 
@@ -837,7 +837,7 @@ namespace sigma {
 
 		// allow return statements without any expressions
 		if(peek_next_token() == token::semicolon) {
-			out_node = new return_node(location, nullptr);
+			out_node = m_abstract_syntax_tree->make<return_node>(location, nullptr);
 		}
 		else {
 			node* expression;
@@ -845,7 +845,7 @@ namespace sigma {
 				return expression_parse_error; // return on failure
 			}
 
-			out_node = new return_node(location, expression);
+			out_node = m_abstract_syntax_tree->make<return_node>(location, expression);
 		}
 	
 		return {};
@@ -863,7 +863,7 @@ namespace sigma {
 			return next_token_error; // return on failure
 		}
 
-		const std::string identifier = m_current_token.get_value();
+		const symbol identifier = m_current_token.get_symbol();
 
 		node* value = nullptr;
 		if (peek_next_token() == token::operator_assignment) {
@@ -874,11 +874,11 @@ namespace sigma {
 		}
 
 		if (is_global) {
-			out_node = new global_declaration_node(location, declaration_type, identifier, value);
+			out_node = m_abstract_syntax_tree->make<global_declaration_node>(location, declaration_type, identifier, value);
 			return {};
 		}
 
-		out_node = new local_declaration_node(location, declaration_type, identifier, value);
+		out_node = m_abstract_syntax_tree->make<local_declaration_node>(location, declaration_type, identifier, value);
 		return {};
 	}
 
@@ -901,7 +901,7 @@ namespace sigma {
 				return logical_disjunction_parse_error; // return on failure
 			}
 
-			left = new operator_conjunction_node(op.get_token_location(), left, right);
+			left = m_abstract_syntax_tree->make<operator_conjunction_node>(op.get_token_location(), left, right);
 		}
 
 		out_node = left;
@@ -923,7 +923,7 @@ namespace sigma {
 				return comparison_parse_error; // return on failure
 			}
 
-			left = new operator_disjunction_node(op.get_token_location(), left, right);
+			left = m_abstract_syntax_tree->make<operator_disjunction_node>(op.get_token_location(), left, right);
 		}
 
 		out_node = left;
@@ -953,22 +953,22 @@ namespace sigma {
 
 			switch (op.get_token()) {
 			case token::operator_greater_than:
-				left = new operator_greater_than_node(m_current_token.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_greater_than_node>(m_current_token.get_token_location(), left, right);
 				break;
 			case token::operator_greater_than_equal_to:
-				left = new operator_greater_than_equal_to_node(m_current_token.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_greater_than_equal_to_node>(m_current_token.get_token_location(), left, right);
 				break;
 			case token::operator_less_than:
-				left = new operator_less_than_node(m_current_token.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_less_than_node>(m_current_token.get_token_location(), left, right);
 				break;
 			case token::operator_less_than_equal_to:
-				left = new operator_less_than_equal_to_node(m_current_token.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_less_than_equal_to_node>(m_current_token.get_token_location(), left, right);
 				break;
 			case token::operator_equals:
-				left = new operator_equals_node(m_current_token.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_equals_node>(m_current_token.get_token_location(), left, right);
 				break;
 			case token::operator_not_equals:
-				left = new operator_not_equals_node(m_current_token.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_not_equals_node>(m_current_token.get_token_location(), left, right);
 				break;
 			}
 		}
@@ -996,10 +996,10 @@ namespace sigma {
 
 			switch (op.get_token()) {
 			case token::operator_addition:
-				left = new operator_addition_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_addition_node>(op.get_token_location(), left, right);
 				break;
 			case token::operator_subtraction:
-				left = new operator_subtraction_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_subtraction_node>(op.get_token_location(), left, right);
 				break;
 			}
 		}
@@ -1034,28 +1034,28 @@ namespace sigma {
 
 			switch (op.get_token()) {
 			case token::operator_multiplication:
-				left = new operator_multiplication_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_multiplication_node>(op.get_token_location(), left, right);
 				break;
 			case token::operator_division:
-				left = new operator_division_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_division_node>(op.get_token_location(), left, right);
 				break;
 			case token::operator_modulo:
-				left = new operator_modulo_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_modulo_node>(op.get_token_location(), left, right);
 				break;
 			case token::operator_bitwise_and:
-				left = new operator_bitwise_and_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_bitwise_and_node>(op.get_token_location(), left, right);
 				break;
 			case token::operator_bitwise_or:
-				left = new operator_bitwise_or_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_bitwise_or_node>(op.get_token_location(), left, right);
 				break;
 			case token::operator_bitwise_left_shift:
-				left = new operator_bitwise_left_shift_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_bitwise_left_shift_node>(op.get_token_location(), left, right);
 				break;
 			case token::operator_bitwise_right_shift:
-				left = new operator_bitwise_right_shift_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_bitwise_right_shift_node>(op.get_token_location(), left, right);
 				break;
 			case token::operator_bitwise_xor:
-				left = new operator_bitwise_xor_node(op.get_token_location(), left, right);
+				left = m_abstract_syntax_tree->make<operator_bitwise_xor_node>(op.get_token_location(), left, right);
 				break;
 			}
 		}
@@ -1121,33 +1121,33 @@ namespace sigma {
 
 	error_result recursive_descent_parser::parse_number(node*& out_node, type expression_type) {
 		get_next_token(); // type
-		const std::string str_value = m_current_token.get_value();
+		const std::string str_value(m_current_token.get_value());
 		const type ty = expression_type.is_unknown() ? type(m_current_token.get_token(), 0) : expression_type;
-		out_node = new numerical_literal_node(m_current_token.get_token_location(), str_value, ty);
+		out_node = m_abstract_syntax_tree->make<numerical_literal_node>(m_current_token.get_token_location(), str_value, ty);
 		return {};
 	}
 
 	error_result recursive_descent_parser::parse_char(node*& out_node) {
 		get_next_token(); // char_literal (guaranteed)
-		out_node = new char_node(m_current_token.get_token_location(), m_current_token.get_value()[0]);
+		out_node = m_abstract_syntax_tree->make<char_node>(m_current_token.get_token_location(), m_current_token.get_value()[0]);
 		return {};
 	}
 
 	error_result recursive_descent_parser::parse_string(node*& out_node) {
 		get_next_token(); // string_literal (guaranteed)
-		out_node = new string_node(m_current_token.get_token_location(), m_current_token.get_value());
+		out_node = m_abstract_syntax_tree->make<string_node>(m_current_token.get_token_location(), std::string(m_current_token.get_value()));
 		return {};
 	}
 
 	error_result recursive_descent_parser::parse_bool(node*& out_node) {
 		get_next_token(); // bool_literal_true || bool_literal_false (guaranteed)
-		out_node = new bool_node(m_current_token.get_token_location(), m_current_token.get_token() == token::bool_literal_true);
+		out_node = m_abstract_syntax_tree->make<bool_node>(m_current_token.get_token_location(), m_current_token.get_token() == token::bool_literal_true);
 		return {};
 	}
 
 	error_result recursive_descent_parser::parse_break_keyword(node*& out_node) {
 		get_next_token(); // keyword_break (guaranteed)
-		out_node = new break_node(m_current_token.get_token_location());
+		out_node = m_abstract_syntax_tree->make<break_node>(m_current_token.get_token_location());
 		return {};
 	}
 
@@ -1155,10 +1155,10 @@ namespace sigma {
 		get_next_token();
 
 		if (m_current_token.get_token() == token::operator_increment) {
-			out_node = new operator_post_increment_node(m_current_token.get_token_location(), operand);
+			out_node = m_abstract_syntax_tree->make<operator_post_increment_node>(m_current_token.get_token_location(), operand);
 		}
 		else {
-			out_node = new operator_post_decrement_node(m_current_token.get_token_location(), operand);
+			out_node = m_abstract_syntax_tree->make<operator_post_decrement_node>(m_current_token.get_token_location(), operand);
 		}
 
 		return {};
@@ -1175,16 +1175,16 @@ namespace sigma {
 
 		switch (op.get_token()) {
 		case token::operator_increment:
-			out_node = new operator_pre_increment_node(op.get_token_location(), operand);
+			out_node = m_abstract_syntax_tree->make<operator_pre_increment_node>(op.get_token_location(), operand);
 			break;
 		case token::operator_decrement:
-			out_node = new operator_pre_decrement_node(op.get_token_location(), operand);
+			out_node = m_abstract_syntax_tree->make<operator_pre_decrement_node>(op.get_token_location(), operand);
 			break;
 		case token::operator_not:
-			out_node = new operator_not_node(op.get_token_location(), operand);
+			out_node = m_abstract_syntax_tree->make<operator_not_node>(op.get_token_location(), operand);
 			break;
 		case token::operator_bitwise_not:
-			out_node = new operator_bitwise_not_node(op.get_token_location(), operand);
+			out_node = m_abstract_syntax_tree->make<operator_bitwise_not_node>(op.get_token_location(), operand);
 			break;
 		}
 
@@ -1202,7 +1202,7 @@ namespace sigma {
 			return number_parse_error; // return on failure
 		}
 
-		out_node = new operator_subtraction_node(m_current_token.get_token_location(), zero_node, number);
+		out_node = m_abstract_syntax_tree->make<operator_subtraction_node>(m_current_token.get_token_location(), zero_node, number);
 		return {};
 	}
 
@@ -1231,7 +1231,7 @@ namespace sigma {
 			return next_token_error; // return on failure
 		}
 
-		out_node = new array_allocation_node(location, allocation_type, array_size);
+		out_node = m_abstract_syntax_tree->make<array_allocation_node>(location, allocation_type, array_size);
 		return {};
 	}
 
@@ -1248,8 +1248,8 @@ namespace sigma {
 		else {
 			// parse an assignment
 			get_next_token();
-			const std::string identifier = m_current_token.get_value();
-			out_node = new variable_access_node(m_current_token.get_token_location(), identifier);
+			const symbol identifier = m_current_token.get_symbol();
+			out_node = m_abstract_syntax_tree->make<variable_access_node>(m_current_token.get_token_location(), identifier);
 		}
 
 		const token next_token = peek_next_token();
@@ -1388,7 +1388,7 @@ namespace sigma {
 	}
 
 	node* recursive_descent_parser::create_zero_node(type expression_type) const {
-		return new numerical_literal_node(m_current_token.get_token_location(), "0", expression_type);
+		return m_abstract_syntax_tree->make<numerical_literal_node>(m_current_token.get_token_location(), "0", expression_type);
 	}
 
 	error_result recursive_descent_parser::parse_type(type& ty) {
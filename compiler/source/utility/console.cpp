@@ -1,6 +1,11 @@
 #include "console.h"
 
 namespace sigma {
+	namespace {
+		// stream the console output of the current thread is redirected to, nullptr for the console
+		thread_local std::wostream* redirected_stream = nullptr;
+	}
+
 	console& console::out = *new console();
 
 	void console::init() {
@@ -40,11 +45,29 @@ namespace sigma {
 
 	console& console::operator<<(const std::string& value) {
 		const std::wstring wide_string(value.begin(), value.end());
-		std::wcout << wide_string;
+		get_stream() << wide_string;
 		return *this;
 	}
 
+	std::wostream& console::get_stream() {
+		return redirected_stream ? *redirected_stream : std::wcout;
+	}
+
 	void console::set_color(WORD color) {
+		if (redirected_stream) {
+			return;
+		}
+
 		SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), color);
 	}
+
+	console_redirect::console_redirect(
+		std::wostream* stream
+	) : m_previous_stream(redirected_stream) {
+		redirected_stream = stream;
+	}
+
+	console_redirect::~console_redirect() {
+		redirected_stream = m_previous_stream;
+	}
 }
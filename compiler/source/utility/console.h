@@ -29,14 +29,39 @@ namespace sigma {
 
 		template <typename T>
 		console& operator<<(const T& value);
+
+		/**
+		 * \brief Gets the stream output of the calling thread is written to, which is either the stream
+		 * selected by a console_redirect, or std::wcout.
+		 */
+		static std::wostream& get_stream();
 	private:
 		console() = default;
 		static void set_color(WORD color);
 	};
 
+	/**
+	 * \brief Redirects the console output of the calling thread into another stream for the lifetime of the
+	 * redirect, other threads keep writing to their own streams. Colors are dropped from redirected output.
+	 */
+	class console_redirect {
+	public:
+		/**
+		 * \brief Constructs the redirect.
+		 * \param stream Stream to write to, nullptr writes to the console
+		 */
+		console_redirect(std::wostream* stream);
+		~console_redirect();
+
+		console_redirect(const console_redirect&) = delete;
+		console_redirect& operator=(const console_redirect&) = delete;
+	private:
+		std::wostream* m_previous_stream;
+	};
+
 	template<typename T>
 	console& console::operator<<(const T& value) {
-		std::wcout << value;
+		get_stream() << value;
 		return *this;
 	}
 
@@ -1,7 +1,63 @@
 #pragma once
 #include "utility/macros.h"
+#include <algorithm>
+#include <bit>
 
 namespace sigma {
+	namespace detail {
+		/**
+		 * \brief Seeded 64-bit hash, usable in constant expressions. Strings are hashed using FNV-1a, the result is
+		 * mixed using the splitmix64 finalizer so that different seeds produce independent hashes.
+		 */
+		struct compile_time_hash {
+			[[nodiscard]] static constexpr u64 mix(u64 value) noexcept {
+				value ^= value >> 30;
+				value *= 0xbf58476d1ce4e5b9ull;
+				value ^= value >> 27;
+				value *= 0x94d049bb133111ebull;
+				value ^= value >> 31;
+				return value;
+			}
+
+			[[nodiscard]] static constexpr u64 hash(std::string_view key, u64 seed) noexcept {
+				u64 value = 0xcbf29ce484222325ull ^ seed;
+
+				for (const char c : key) {
+					value ^= static_cast<u8>(c);
+					value *= 0x100000001b3ull;
+				}
+
+				return mix(value + seed);
+			}
+
+			template<typename T>
+				requires std::is_integral_v<T> || std::is_enum_v<T>
+			[[nodiscard]] static constexpr u64 hash(T key, u64 seed) noexcept {
+				return mix(static_cast<u64>(key) * 0x9e3779b97f4a7c15ull + seed);
+			}
+		};
+
+		/**
+		 * \brief Key type used by the hash map, string literal keys are stored as string views so that they can
+		 * be compared by value.
+		 */
+		template<typename K>
+		using hash_map_key = std::conditional_t<
+			std::is_convertible_v<K, const char*>,
+			std::string_view,
+			K
+		>;
+	}
+
+	/**
+	 * \brief Immutable perfect hash map. The hash function is generated at compile time from the given key set
+	 * using the hash and displace scheme: keys are first distributed into buckets, then every bucket gets a seed
+	 * (displacement) which places all of its keys into distinct slots. Every lookup therefore takes at most two
+	 * hashes and a single key comparison, and never allocates.
+	 * \tparam N Element count
+	 * \tparam K Key type
+	 * \tparam V Value type
+	 */
 	template <std::size_t N, typename K, typename V>
 	class hash_map {
 	public:
@@ -12,10 +68,13 @@ namespace sigma {
 		using const_iterator = typename data_type::const_iterator;
 
 		constexpr hash_map(const std::array<std::pair<K, V>, N>& init_list)
-			: data(init_list) {}
+			: data(init_list) {
+			build();
+		}
 
 		[[nodiscard]] constexpr const_iterator find(const K& key) const noexcept {
-			return search<0, N>(key);
+			const index_type index = search(key);
+			return index == N ? cend() : std::next(cbegin(), index);
 		}
 
 		[[nodiscard]] constexpr std::pair<bool, const V&> at(const K& key) const noexcept {
@@ -33,7 +92,7 @@ namespace sigma {
 		}
 
 		[[nodiscard]] constexpr bool contains(const K& key) const noexcept {
-			return search<0, N>(key) != cend();
+			return search(key) != N;
 		}
 
 		[[nodiscard]] constexpr size_type size() const noexcept {
@@ -63,39 +122,124 @@ namespace sigma {
 	protected:
 		using index_type = size_type;
 
-		template <index_type L, index_type R>
-		[[nodiscard]] constexpr const_iterator search(const K& key) const noexcept {
-			if constexpr (L < R) {
-				if (equal(data[L].first, key)) {
-					return std::next(cbegin(), L);
-				}
+		static constexpr size_type bucket_count = std::bit_ceil(N);
+		static constexpr size_type slot_count = std::bit_ceil(N) * 2;
+		static constexpr u64 bucket_seed = 0x5bd1e995ull;
+
+		/**
+		 * \brief Locates the slot of the given key.
+		 * \return Index of the matching element in the data array, N if the key isn't present.
+		 */
+		[[nodiscard]] constexpr index_type search(const K& key) const noexcept {
+			const i64 displacement = displacements[bucket_of(key)];
+
+			// buckets with a single key point to their slot directly, other buckets store the seed used to
+			// hash their keys into slots
+			const size_type slot = displacement < 0
+				? static_cast<size_type>(-displacement - 1)
+				: slot_of(key, static_cast<u64>(displacement));
 
-				return search<L + 1, R>(key);
+			const index_type index = slots[slot];
+
+			if (index != N && data[index].first == key) {
+				return index;
 			}
 
-			return cend();
+			return N;
+		}
+
+		[[nodiscard]] static constexpr size_type bucket_of(const K& key) noexcept {
+			return detail::compile_time_hash::hash(key, bucket_seed) & (bucket_count - 1);
 		}
 
-		template <typename T = K>
-		[[nodiscard]] constexpr bool equal(const T& lhs, const T& rhs) const noexcept {
-			return lhs == rhs;
+		[[nodiscard]] static constexpr size_type slot_of(const K& key, u64 seed) noexcept {
+			return detail::compile_time_hash::hash(key, seed) & (slot_count - 1);
 		}
 
-		[[nodiscard]] constexpr bool equal(const char* lhs, const char* rhs) const noexcept {
-			return *lhs == *rhs && (*lhs == '\0' || equal(lhs + 1, rhs + 1));
+		/**
+		 * \brief Generates the displacement and slot tables, only ever evaluated at compile time for constexpr
+		 * maps. Duplicate keys cannot be placed, and thus cause a compilation error.
+		 */
+		constexpr void build() {
+			std::array<size_type, bucket_count> bucket_sizes{};
+			std::array<std::array<index_type, N>, bucket_count> buckets{};
+
+			for (index_type i = 0; i < N; i++) {
+				const size_type bucket = bucket_of(data[i].first);
+				buckets[bucket][bucket_sizes[bucket]++] = i;
+			}
+
+			// place the largest buckets first, while most of the slots are still free
+			std::array<size_type, bucket_count> bucket_order{};
+			for (size_type i = 0; i < bucket_count; i++) {
+				bucket_order[i] = i;
+			}
+
+			std::sort(bucket_order.begin(), bucket_order.end(), [&](size_type left, size_type right) {
+				return bucket_sizes[left] > bucket_sizes[right];
+			});
+
+			slots.fill(N);
+			displacements.fill(0);
+
+			for (const size_type bucket : bucket_order) {
+				const size_type bucket_size = bucket_sizes[bucket];
+
+				if (bucket_size == 0) {
+					break;
+				}
+
+				if (bucket_size == 1) {
+					// take the first free slot
+					size_type slot = 0;
+					while (slots[slot] != N) {
+						slot++;
+					}
+
+					slots[slot] = buckets[bucket][0];
+					displacements[bucket] = -static_cast<i64>(slot) - 1;
+					continue;
+				}
+
+				// find a seed which places every key of the bucket into a distinct free slot
+				for (u64 seed = 1;; seed++) {
+					std::array<size_type, N> candidate_slots{};
+					bool placed = true;
+
+					for (size_type i = 0; i < bucket_size && placed; i++) {
+						candidate_slots[i] = slot_of(data[buckets[bucket][i]].first, seed);
+						placed = slots[candidate_slots[i]] == N;
+
+						for (size_type j = 0; j < i && placed; j++) {
+							placed = candidate_slots[i] != candidate_slots[j];
+						}
+					}
+
+					if (placed) {
+						for (size_type i = 0; i < bucket_size; i++) {
+							slots[candidate_slots[i]] = buckets[bucket][i];
+						}
+
+						displacements[bucket] = static_cast<i64>(seed);
+						break;
+					}
+				}
+			}
 		}
 
 	private:
 		data_type data;
+		std::array<i64, bucket_count> displacements{};
+		std::array<index_type, slot_count> slots{};
 	};
 
 	template <typename... Pairs>
 	constexpr auto make_hash_map(Pairs&&... pairs) {
 		static_assert(sizeof...(Pairs) > 0, "make_hash_map requires at least one argument");
-		using first_pair_type = std::tuple_element_t<0, std::tuple<Pairs...>>;
-		using key_type = typename first_pair_type::first_type;
+		using first_pair_type = std::remove_cvref_t<std::tuple_element_t<0, std::tuple<Pairs...>>>;
+		using key_type = detail::hash_map_key<typename first_pair_type::first_type>;
 		using value_type = typename first_pair_type::second_type;
 		constexpr size_t N = sizeof...(Pairs);
-		return hash_map<N, key_type, value_type>({ std::forward<Pairs>(pairs)... });
+		return hash_map<N, key_type, value_type>({ std::pair<key_type, value_type>(std::forward<Pairs>(pairs))... });
 	}
 }
@@ -0,0 +1,69 @@
+#include "memory_arena.h"
+
+namespace sigma {
+	memory_arena::memory_arena(
+		u64 block_size
+	) : m_block_size(block_size) {}
+
+	memory_arena::~memory_arena() {
+		clear();
+	}
+
+	void* memory_arena::allocate(
+		u64 size,
+		u64 alignment
+	) {
+		ASSERT((alignment & (alignment - 1)) == 0, "arena alignment has to be a power of 2");
+
+		// align the caret, and check if the allocation fits into the active block
+		u8* aligned = reinterpret_cast<u8*>(
+			(reinterpret_cast<std::uintptr_t>(m_position) + alignment - 1) & ~(alignment - 1)
+		);
+
+		if (m_position == nullptr || aligned + size > m_end) {
+			allocate_block(size + alignment);
+			aligned = reinterpret_cast<u8*>(
+				(reinterpret_cast<std::uintptr_t>(m_position) + alignment - 1) & ~(alignment - 1)
+			);
+		}
+
+		m_position = aligned + size;
+		return aligned;
+	}
+
+	void memory_arena::clear() {
+		// destroy objects in reverse order of construction
+		for (auto it = m_destructors.rbegin(); it != m_destructors.rend(); ++it) {
+			it->invoke(it->object);
+		}
+
+		for (const auto& [block, size] : m_blocks) {
+			::operator delete(block);
+		}
+
+		m_destructors.clear();
+		m_blocks.clear();
+		m_position = nullptr;
+		m_end = nullptr;
+	}
+
+	u64 memory_arena::get_reserved_size() const {
+		u64 total = 0;
+		for (const auto& [block, size] : m_blocks) {
+			total += size;
+		}
+
+		return total;
+	}
+
+	void memory_arena::allocate_block(
+		u64 minimum_size
+	) {
+		const u64 size = std::max(m_block_size, minimum_size);
+		u8* block = static_cast<u8*>(::operator new(size));
+
+		m_blocks.emplace_back(block, size);
+		m_position = block;
+		m_end = block + size;
+	}
+}
\ No newline at end of file
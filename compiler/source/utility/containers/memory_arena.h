@@ -0,0 +1,91 @@
+#pragma once
+#include "utility/macros.h"
+
+namespace sigma {
+	/**
+	 * \brief Bump allocator which hands out memory from large contiguous blocks. Individual allocations cannot
+	 * be freed, everything is released at once when the arena is cleared or destroyed.
+	 */
+	class memory_arena {
+	public:
+		/**
+		 * \brief Constructs the arena.
+		 * \param block_size Size of a single memory block, allocations larger than this get a dedicated block
+		 */
+		memory_arena(
+			u64 block_size = 64 * 1024
+		);
+
+		~memory_arena();
+
+		memory_arena(const memory_arena&) = delete;
+		memory_arena& operator=(const memory_arena&) = delete;
+
+		/**
+		 * \brief Allocates \a size bytes of uninitialized memory aligned to \a alignment.
+		 * \param size Size of the allocation in bytes
+		 * \param alignment Alignment of the allocation, has to be a power of 2
+		 * \return Pointer to the allocated memory.
+		 */
+		void* allocate(
+			u64 size,
+			u64 alignment
+		);
+
+		/**
+		 * \brief Constructs a new object of type \a T inside the arena. If \a T is not trivially destructible its
+		 * destructor is invoked when the arena is cleared.
+		 * \tparam T Type of the object to construct
+		 * \param args Constructor arguments
+		 * \return Pointer to the constructed object.
+		 */
+		template <typename T, typename... Args>
+		T* emplace(
+			Args&&... args
+		);
+
+		/**
+		 * \brief Destroys all contained objects and releases all allocated memory blocks.
+		 */
+		void clear();
+
+		/**
+		 * \brief Gets the total number of bytes that are currently reserved by the arena.
+		 * \return Reserved byte count.
+		 */
+		u64 get_reserved_size() const;
+	private:
+		void allocate_block(
+			u64 minimum_size
+		);
+	private:
+		struct destructor {
+			void (*invoke)(void*);
+			void* object;
+		};
+
+		u64 m_block_size;
+		std::vector<std::pair<u8*, u64>> m_blocks; // block base, block size
+		std::vector<destructor> m_destructors;
+
+		u8* m_position = nullptr; // next free byte in the active block
+		u8* m_end = nullptr;      // end of the active block
+	};
+
+	template<typename T, typename... Args>
+	T* memory_arena::emplace(
+		Args&&... args
+	) {
+		void* memory = allocate(sizeof(T), alignof(T));
+		T* object = new (memory) T(std::forward<Args>(args)...);
+
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			m_destructors.push_back({
+				[](void* ptr) { static_cast<T*>(ptr)->~T(); },
+				object
+			});
+		}
+
+		return object;
+	}
+}
\ No newline at end of file
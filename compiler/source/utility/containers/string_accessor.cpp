@@ -1,7 +1,7 @@
 #include "string_accessor.h"
 
 namespace sigma::detail {
-	string_accessor::string_accessor(const std::string& string)
+	string_accessor::string_accessor(std::string_view string)
 		: m_string(string) {}
 
 	void string_accessor::advance()	{
@@ -15,7 +15,9 @@ namespace sigma::detail {
 	char string_accessor::get() const {
 		// check if we are inside of our strings' bounds
 		ASSERT(m_position <= m_string.size(), "accessor out of range! (get)");
-		return m_string[m_position];
+
+		// views aren't null terminated
+		return m_position < m_string.size() ? m_string[m_position] : '\0';
 	}
 
 	char string_accessor::get_advance() {
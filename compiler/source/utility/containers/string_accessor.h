@@ -3,17 +3,18 @@
 
 namespace sigma::detail {
 	/**
-	 * \brief Utility string container class with support for caret movements.
+	 * \brief Utility string view class with support for caret movements. The viewed string has to outlive the
+	 * accessor.
 	 */
 	class string_accessor {
 	public:
 		string_accessor() = default;
 
 		/**
-		 * \brief Constructs the string accessor by filling it with the specified \a string.
+		 * \brief Constructs the string accessor from the specified \a string.
 		 * \param string String to use as the base of the string accessor
 		 */
-		string_accessor(const std::string& string);
+		string_accessor(std::string_view string);
 
 		/**
 		 * \brief Increments the caret location.
@@ -27,6 +28,7 @@ namespace sigma::detail {
 
 		/**
 		 * \brief Retrieves the character at the current caret location, if we are out of bounds an assertion is triggered.
+		 * The location right after the end of the string acts as a null terminator.
 		 * \returns Character at the current caret location
 		 */
 		inline char get() const;
@@ -46,7 +48,7 @@ namespace sigma::detail {
 		u64 get_position() const;
 		void set_position(u64 location);
 	private:
-		std::string m_string; // contained string
+		std::string_view m_string; // viewed string
 		u64 m_position = 0;   // current caret location
 	};
 }
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "symbol_table.h"
+
+namespace sigma {
+	symbol::symbol(
+		const detail::symbol_entry* entry
+	) : m_entry(entry) {}
+
+	u32 symbol::get_id() const {
+		return m_entry ? m_entry->id : 0;
+	}
+
+	const std::string& symbol::get_name() const {
+		static const std::string empty;
+		return m_entry ? m_entry->name : empty;
+	}
+
+	bool symbol::is_valid() const {
+		return m_entry != nullptr;
+	}
+
+	bool symbol::operator==(const symbol& other) const {
+		return m_entry == other.m_entry;
+	}
+
+	symbol symbol_table::intern(
+		std::string_view name
+	) {
+		// check if we've seen the identifier already
+		const auto it = m_lookup.find(name);
+		if (it != m_lookup.end()) {
+			return { it->second };
+		}
+
+		// store a new copy of the identifier, the lookup key views the stored string
+		const detail::symbol_entry& entry = m_entries.emplace_back(
+			std::string(name),
+			static_cast<u32>(m_entries.size())
+		);
+
+		m_lookup.emplace(entry.name, &entry);
+		return { &entry };
+	}
+
+	u64 symbol_table::get_symbol_count() const {
+		return m_entries.size();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+#include "utility/macros.h"
+#include <deque>
+
+namespace sigma {
+	namespace detail {
+		struct symbol_entry {
+			std::string name;
+			u32 id;
+		};
+	}
+
+	/**
+	 * \brief Handle to an identifier interned by a symbol table. Symbols are compared and hashed by their identity,
+	 * the underlying string is only touched when the name itself is needed (ie. for diagnostics and IR names).
+	 */
+	class symbol {
+	public:
+		symbol() = default;
+
+		/**
+		 * \brief Gets the unique id of the symbol, ids are dense and start at 0.
+		 * \return Symbol id.
+		 */
+		u32 get_id() const;
+
+		/**
+		 * \brief Gets the interned string the symbol refers to.
+		 * \return Symbol name, empty if the symbol is not valid.
+		 */
+		const std::string& get_name() const;
+
+		/**
+		 * \brief Checks whether the symbol has been handed out by a symbol table.
+		 * \return True if the symbol is valid.
+		 */
+		bool is_valid() const;
+
+		bool operator==(const symbol& other) const;
+	private:
+		symbol(
+			const detail::symbol_entry* entry
+		);
+
+		friend class symbol_table;
+	private:
+		const detail::symbol_entry* m_entry = nullptr; // points into the owning symbol table
+	};
+
+	/**
+	 * \brief Compilation-wide identifier interner. Every distinct identifier string is stored exactly once and
+	 * receives a compact symbol id, which the later stages use as their lookup key.
+	 */
+	class symbol_table {
+	public:
+		symbol_table() = default;
+
+		symbol_table(const symbol_table&) = delete;
+		symbol_table& operator=(const symbol_table&) = delete;
+
+		/**
+		 * \brief Interns the given \a name, if the name has been interned already its existing symbol is returned.
+		 * \param name Identifier to intern
+		 * \return Symbol referring to \a name.
+		 */
+		symbol intern(
+			std::string_view name
+		);
+
+		/**
+		 * \brief Gets the number of unique identifiers contained in the table.
+		 * \return Symbol count.
+		 */
+		u64 get_symbol_count() const;
+	private:
+		std::deque<detail::symbol_entry> m_entries; // deque keeps element addresses stable
+		std::unordered_map<std::string_view, const detail::symbol_entry*> m_lookup;
+	};
+}
+
+template<>
+struct std::hash<sigma::symbol> {
+	sigma::u64 operator()(const sigma::symbol& s) const noexcept {
+		return s.get_id();
+	}
+};
\ No newline at end of file
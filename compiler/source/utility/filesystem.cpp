@@ -1,5 +1,13 @@
 #include "filesystem.h"
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
 namespace sigma::detail {
 	std::expected<std::string, error_msg> read_file(
 		const filepath& path
@@ -44,6 +52,80 @@ namespace sigma::detail {
 		return { (contents) };
 	}
 
+	std::expected<std::shared_ptr<source_file>, error_msg> map_file(
+		const filepath& path
+	) {
+#ifdef __linux__
+		const i32 file = open(path.c_str(), O_RDONLY);
+
+		if (file == -1) {
+			// report missing files the same way as the other platforms
+			if (errno == ENOENT) {
+				return std::unexpected(
+					error::emit<1002>(path)
+				);
+			}
+
+			return std::unexpected(
+				error::emit<1000>(path)
+			);
+		}
+
+		struct stat file_status;
+		if (fstat(file, &file_status) == -1) {
+			close(file);
+
+			return std::unexpected(
+				error::emit<1005>(path)
+			);
+		}
+
+		// directories can be opened, but not mapped
+		if (!S_ISREG(file_status.st_mode)) {
+			close(file);
+
+			return std::unexpected(
+				error::emit<1003>(path)
+			);
+		}
+
+		const u64 size = static_cast<u64>(file_status.st_size);
+
+		// empty files cannot be mapped
+		if (size == 0) {
+			close(file);
+			return std::make_shared<source_file>(path, std::string());
+		}
+
+		void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+		// the mapping stays valid after the descriptor is closed
+		close(file);
+
+		if (mapping == MAP_FAILED) {
+			return std::unexpected(
+				error::emit<1006>(path)
+			);
+		}
+
+		// the lexer reads the source front to back, let the kernel read ahead aggressively
+		madvise(mapping, size, MADV_SEQUENTIAL);
+		return std::make_shared<source_file>(path, mapping, size);
+#else
+		auto file_read_result = read_file(path);
+		if (!file_read_result.has_value()) {
+			return std::unexpected(
+				file_read_result.error()
+			);
+		}
+
+		return std::make_shared<source_file>(
+			path,
+			std::move(file_read_result.value())
+		);
+#endif
+	}
+
 	bool delete_file(const filepath& path) {
 		return std::remove(path.string().c_str()) == 0;
 	}
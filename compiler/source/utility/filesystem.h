@@ -1,6 +1,7 @@
 #pragma once
 #include "compiler/diagnostics/error.h"
 #include "utility/macros.h"
+#include "utility/source_file.h"
 
 template <>
 struct std::formatter<sigma::types::filepath> : std::formatter<std::string> {
@@ -19,6 +20,16 @@ namespace sigma::detail {
 		const filepath& path
 	);
 
+	/**
+	 * \brief Loads the specified source file without copying its contents. On Linux the file is memory mapped
+	 * (and read sequentially), other platforms fall back to reading the file into memory.
+	 * \param path Source file path
+	 * \return Expected - shared source file, or, in the case of an erroneous state, an error message.
+	 */
+	std::expected<std::shared_ptr<source_file>, error_msg> map_file(
+		const filepath& path
+	);
+
 	/**
 	 * \brief Attempts to delete the given file.
 	 * \param path Filepath of the file to delete
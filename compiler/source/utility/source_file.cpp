@@ -0,0 +1,38 @@
+#include "source_file.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace sigma {
+	source_file::source_file(
+		const filepath& path,
+		std::string contents
+	) : m_path(path),
+	m_contents(std::move(contents)),
+	m_source(m_contents) {}
+
+	source_file::source_file(
+		const filepath& path,
+		const void* mapping,
+		u64 size
+	) : m_path(path),
+	m_mapping(mapping),
+	m_source(static_cast<const char*>(mapping), size) {}
+
+	source_file::~source_file() {
+#ifdef __linux__
+		if (m_mapping) {
+			munmap(const_cast<void*>(m_mapping), m_source.size());
+		}
+#endif
+	}
+
+	std::string_view source_file::get_source() const {
+		return m_source;
+	}
+
+	const filepath& source_file::get_path() const {
+		return m_path;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+#include "utility/macros.h"
+
+namespace sigma {
+	/**
+	 * \brief Read-only source text of a single file. The text is either memory mapped or owned by the instance,
+	 * and is shared by everything that refers to it (lexers, token buffers, diagnostic locations), so that it
+	 * exists exactly once. Source files are always owned by a shared pointer.
+	 */
+	class source_file : public std::enable_shared_from_this<source_file> {
+	public:
+		/**
+		 * \brief Constructs the source file from already loaded contents.
+		 * \param path Path of the source file
+		 * \param contents Contents of the source file
+		 */
+		source_file(
+			const filepath& path,
+			std::string contents
+		);
+
+		/**
+		 * \brief Constructs the source file from a read-only memory mapping, which gets unmapped once the
+		 * source file is destroyed.
+		 * \param path Path of the source file
+		 * \param mapping Base of the mapping
+		 * \param size Size of the mapping, and thus of the source text, in bytes
+		 */
+		source_file(
+			const filepath& path,
+			const void* mapping,
+			u64 size
+		);
+
+		~source_file();
+
+		source_file(const source_file&) = delete;
+		source_file& operator=(const source_file&) = delete;
+
+		/**
+		 * \brief Gets the source text. Note that, unlike std::string, the text is not null terminated.
+		 * \return View of the entire source text.
+		 */
+		std::string_view get_source() const;
+		const filepath& get_path() const;
+	private:
+		filepath m_path;
+		std::string m_contents;          // used when the file isn't memory mapped
+		const void* m_mapping = nullptr;
+		std::string_view m_source;
+	};
+}
\ No newline at end of file
@@ -4,39 +4,10 @@
 local llvm_root = os.getenv("LLVM_ROOT")
 local script_root = path.getabsolute(".")
 
-workspace "sigma"
-    configurations { "Release" }
-    architecture "x64"
-    startproject "compiler"
-    
-project "compiler"
-    kind "ConsoleApp"
-    language "C++"
-    cppdialect "C++latest"
-
-    location "compiler"
-    -- dependson "external_functions"
-
-    targetdir ("bin/%{cfg.buildcfg}/%{prj.name}")
-    objdir ("bin-int/%{cfg.buildcfg}/%{prj.name}")
-
-    externalanglebrackets "On"
-    externalwarnings "Off"
-    
-    flags 
-    {
-        "MultiProcessorCompile"
-    }
-
-    files
-    {
-        "compiler/source/**.*",
-        "compiler/main.cpp"
-    }
-
+-- LLVM include directories, library directories and libraries shared by all projects
+local function use_llvm()
     includedirs
     {
-        "compiler/source",
         path.join(llvm_root, "include")
     }
 
@@ -270,6 +241,8 @@ project "compiler"
         "delayimp.lib",
         "gdi32.lib",
         "kernel32.lib",
+        "lldCommon.lib",
+        "lldELF.lib",
         "ole32.dll",
         "ole32.lib",
         "oleaut32.lib",
@@ -280,8 +253,134 @@ project "compiler"
         "uuid.lib",
         "version.lib",
         "winspool.lib",
+        "ws2_32.lib",
         --"external_functions" -- external funcs
     }
+end
+
+workspace "sigma"
+    configurations { "Release" }
+    architecture "x64"
+    startproject "compiler"
+
+-- compiler library, contains the entire compilation pipeline and can be embedded into other applications
+project "sigma"
+    kind "StaticLib"
+    language "C++"
+    cppdialect "C++latest"
+
+    location "compiler"
+
+    targetdir ("bin/%{cfg.buildcfg}/%{prj.name}")
+    objdir ("bin-int/%{cfg.buildcfg}/%{prj.name}")
+
+    externalanglebrackets "On"
+    externalwarnings "Off"
+    
+    flags 
+    {
+        "MultiProcessorCompile"
+    }
+
+    files
+    {
+        "compiler/source/**.*"
+    }
+
+    includedirs
+    {
+        "compiler/source"
+    }
+
+    use_llvm()
+
+    filter "configurations:Release"
+        defines { "NDEBUG" }
+        optimize "On"
+        warnings "High"
+
+    filter "platforms:Windows"
+        systemversion "latest"
+
+project "compiler"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++latest"
+
+    location "compiler"
+    -- dependson "external_functions"
+
+    targetdir ("bin/%{cfg.buildcfg}/%{prj.name}")
+    objdir ("bin-int/%{cfg.buildcfg}/%{prj.name}")
+
+    externalanglebrackets "On"
+    externalwarnings "Off"
+    
+    flags 
+    {
+        "MultiProcessorCompile"
+    }
+
+    files
+    {
+        "compiler/main.cpp"
+    }
+
+    includedirs
+    {
+        "compiler/source"
+    }
+
+    links
+    {
+        "sigma"
+    }
+
+    use_llvm()
+
+    filter "configurations:Release"
+        defines { "NDEBUG" }
+        optimize "On"
+        warnings "High"
+
+    filter "platforms:Windows"
+        systemversion "latest"
+
+project "benchmark"
+    kind "ConsoleApp"
+    language "C++"
+    cppdialect "C++latest"
+
+    location "benchmark"
+
+    targetdir ("bin/%{cfg.buildcfg}/%{prj.name}")
+    objdir ("bin-int/%{cfg.buildcfg}/%{prj.name}")
+
+    externalanglebrackets "On"
+    externalwarnings "Off"
+    
+    flags 
+    {
+        "MultiProcessorCompile"
+    }
+
+    files
+    {
+        "benchmark/**.h",
+        "benchmark/**.cpp"
+    }
+
+    includedirs
+    {
+        "compiler/source"
+    }
+
+    links
+    {
+        "sigma"
+    }
+
+    use_llvm()
 
     filter "configurations:Release"
         defines { "NDEBUG" }